@@ -513,6 +513,17 @@ namespace Utilities
        * communication that will be finalized in the
        * export_to_ghosted_array_finish() call.
        *
+       * @param use_persistent_requests If `true`, the messages are set up as
+       * persistent requests by `MPI_Recv_init` and `MPI_Send_init` when
+       * @p requests is empty, and only restarted by `MPI_Startall` when
+       * @p requests contains the requests of a previous exchange. This saves
+       * the setup cost of the individual messages when the same exchange is
+       * done many times, like in an iterative solver. In this mode, the
+       * requests remain in @p requests after the call to
+       * export_to_ghosted_array_finish() and must eventually be released by
+       * `MPI_Request_free`. All calls with the same @p requests must use the
+       * same communication channel, temporary storage, and ghost array.
+       *
        * This functionality is used in
        * LinearAlgebra::distributed::Vector::update_ghost_values().
        */
@@ -523,7 +534,8 @@ namespace Utilities
         const ArrayView<const Number, MemorySpaceType> &locally_owned_array,
         const ArrayView<Number, MemorySpaceType>       &temporary_storage,
         const ArrayView<Number, MemorySpaceType>       &ghost_array,
-        std::vector<MPI_Request>                       &requests) const;
+        std::vector<MPI_Request>                       &requests,
+        const bool use_persistent_requests = false) const;
 
       /**
        * Finish the exportation of the data in a locally owned array to the
@@ -539,6 +551,10 @@ namespace Utilities
        * export_to_ghosted_array_start() call. This must be the same array as
        * passed to that function, otherwise MPI will likely throw an error.
        *
+       * @param use_persistent_requests Must be the same value as passed to
+       * export_to_ghosted_array_start(). If `true`, the (inactive) requests
+       * are kept in @p requests for the next exchange.
+       *
        * This functionality is used in
        * LinearAlgebra::distributed::Vector::update_ghost_values().
        */
@@ -546,7 +562,8 @@ namespace Utilities
       void
       export_to_ghosted_array_finish(
         const ArrayView<Number, MemorySpaceType> &ghost_array,
-        std::vector<MPI_Request>                 &requests) const;
+        std::vector<MPI_Request>                 &requests,
+        const bool use_persistent_requests = false) const;
 
       /**
        * Start importing the data on an array indexed by the ghost indices of
@@ -582,6 +599,10 @@ namespace Utilities
        * communication that will be finalized in the
        * export_to_ghosted_array_finish() call.
        *
+       * @param use_persistent_requests If `true`, the requests are set up as
+       * persistent requests and reused in subsequent calls, see the
+       * description of export_to_ghosted_array_start().
+       *
        * This functionality is used in
        * LinearAlgebra::distributed::Vector::compress().
        */
@@ -592,7 +613,8 @@ namespace Utilities
         const unsigned int                        communication_channel,
         const ArrayView<Number, MemorySpaceType> &ghost_array,
         const ArrayView<Number, MemorySpaceType> &temporary_storage,
-        std::vector<MPI_Request>                 &requests) const;
+        std::vector<MPI_Request>                 &requests,
+        const bool use_persistent_requests = false) const;
 
       /**
        * Finish importing the data from an array indexed by the ghost
@@ -625,6 +647,10 @@ namespace Utilities
        * import_to_ghosted_array_finish() call. This must be the same array as
        * passed to that function, otherwise MPI will likely throw an error.
        *
+       * @param use_persistent_requests Must be the same value as passed to
+       * import_from_ghosted_array_start(). If `true`, the (inactive) requests
+       * are kept in @p requests for the next exchange.
+       *
        * This functionality is used in
        * LinearAlgebra::distributed::Vector::compress().
        */
@@ -635,7 +661,8 @@ namespace Utilities
         const ArrayView<const Number, MemorySpaceType> &temporary_storage,
         const ArrayView<Number, MemorySpaceType>       &locally_owned_storage,
         const ArrayView<Number, MemorySpaceType>       &ghost_array,
-        std::vector<MPI_Request>                       &requests) const;
+        std::vector<MPI_Request>                       &requests,
+        const bool use_persistent_requests = false) const;
 #endif
 
       /**
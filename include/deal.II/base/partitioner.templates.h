@@ -43,7 +43,8 @@ namespace Utilities
       const ArrayView<const Number, MemorySpaceType> &locally_owned_array,
       const ArrayView<Number, MemorySpaceType>       &temporary_storage,
       const ArrayView<Number, MemorySpaceType>       &ghost_array,
-      std::vector<MPI_Request>                       &requests) const
+      std::vector<MPI_Request>                       &requests,
+      const bool use_persistent_requests) const
     {
       AssertDimension(temporary_storage.size(), n_import_indices());
       AssertIndexRange(communication_channel, 200);
@@ -59,7 +60,7 @@ namespace Utilities
       if (n_import_targets > 0)
         AssertDimension(locally_owned_array.size(), locally_owned_size());
 
-      Assert(requests.empty(),
+      Assert(requests.empty() || use_persistent_requests,
              ExcMessage("Another operation seems to still be running. "
                         "Call update_ghost_values_finish() first."));
 
@@ -71,8 +72,14 @@ namespace Utilities
 
       // Need to send and receive the data. Use non-blocking communication,
       // where it is usually less overhead to first initiate the receive and
-      // then actually send the data
-      requests.resize(n_import_targets + n_ghost_targets);
+      // then actually send the data. Persistent requests are only set up
+      // once and then restarted in the same order.
+      const bool setup_requests =
+        (use_persistent_requests == false || requests.empty());
+      if (setup_requests)
+        requests.resize(n_import_targets + n_ghost_targets);
+      else
+        AssertDimension(requests.size(), n_import_targets + n_ghost_targets);
 
       // as a ghost array pointer, put the data at the end of the given ghost
       // array in case we want to fill only a subset of the ghosts so that we
@@ -87,21 +94,34 @@ namespace Utilities
                            n_ghost_indices() :
                          ghost_array.data();
 
-      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+      for (unsigned int i = 0; setup_requests && i < n_ghost_targets; ++i)
         {
           // allow writing into ghost indices even though we are in a
           // const function
           const int ierr =
-            MPI_Irecv(ghost_array_ptr,
-                      ghost_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      ghost_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[i]);
+            use_persistent_requests ?
+              MPI_Recv_init(ghost_array_ptr,
+                            ghost_targets_data[i].second * sizeof(Number),
+                            MPI_BYTE,
+                            ghost_targets_data[i].first,
+                            mpi_tag,
+                            communicator,
+                            &requests[i]) :
+              MPI_Irecv(ghost_array_ptr,
+                        ghost_targets_data[i].second * sizeof(Number),
+                        MPI_BYTE,
+                        ghost_targets_data[i].first,
+                        mpi_tag,
+                        communicator,
+                        &requests[i]);
           AssertThrowMPI(ierr);
           ghost_array_ptr += ghost_targets_data[i].second;
         }
+      if (use_persistent_requests && n_ghost_targets > 0)
+        {
+          const int ierr = MPI_Startall(n_ghost_targets, requests.data());
+          AssertThrowMPI(ierr);
+        }
 
       Number *temp_array_ptr = temporary_storage.data();
 #    if defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
@@ -163,17 +183,34 @@ namespace Utilities
             }
 
           // start the send operations
-          const int ierr =
-            MPI_Isend(temp_array_ptr,
-                      import_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      import_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[n_ghost_targets + i]);
-          AssertThrowMPI(ierr);
+          if (setup_requests)
+            {
+              const int ierr =
+                use_persistent_requests ?
+                  MPI_Send_init(temp_array_ptr,
+                                import_targets_data[i].second * sizeof(Number),
+                                MPI_BYTE,
+                                import_targets_data[i].first,
+                                mpi_tag,
+                                communicator,
+                                &requests[n_ghost_targets + i]) :
+                  MPI_Isend(temp_array_ptr,
+                            import_targets_data[i].second * sizeof(Number),
+                            MPI_BYTE,
+                            import_targets_data[i].first,
+                            mpi_tag,
+                            communicator,
+                            &requests[n_ghost_targets + i]);
+              AssertThrowMPI(ierr);
+            }
           temp_array_ptr += import_targets_data[i].second;
         }
+      if (use_persistent_requests && n_import_targets > 0)
+        {
+          const int ierr = MPI_Startall(n_import_targets,
+                                        requests.data() + n_ghost_targets);
+          AssertThrowMPI(ierr);
+        }
     }
 
 
@@ -182,7 +219,8 @@ namespace Utilities
     void
     Partitioner::export_to_ghosted_array_finish(
       const ArrayView<Number, MemorySpaceType> &ghost_array,
-      std::vector<MPI_Request>                 &requests) const
+      std::vector<MPI_Request>                 &requests,
+      const bool                                use_persistent_requests) const
     {
       Assert(ghost_array.size() == n_ghost_indices() ||
                ghost_array.size() == n_ghost_indices_in_larger_set,
@@ -200,7 +238,8 @@ namespace Utilities
             MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
           AssertThrowMPI(ierr);
         }
-      requests.resize(0);
+      if (use_persistent_requests == false)
+        requests.resize(0);
 
       // in case we only sent a subset of indices, we now need to move the data
       // to the correct positions and delete the old content
@@ -294,7 +333,8 @@ namespace Utilities
       const unsigned int                        communication_channel,
       const ArrayView<Number, MemorySpaceType> &ghost_array,
       const ArrayView<Number, MemorySpaceType> &temporary_storage,
-      std::vector<MPI_Request>                 &requests) const
+      std::vector<MPI_Request>                 &requests,
+      const bool                                use_persistent_requests) const
     {
       AssertDimension(temporary_storage.size(), n_import_indices());
       AssertIndexRange(communication_channel, 200);
@@ -323,24 +363,30 @@ namespace Utilities
       const unsigned int n_import_targets = import_targets_data.size();
       const unsigned int n_ghost_targets  = ghost_targets_data.size();
 
-      Assert(requests.empty(),
+      Assert(requests.empty() || use_persistent_requests,
              ExcMessage("Another compress operation seems to still be running. "
                         "Call compress_finish() first."));
 
       // Need to send and receive the data. Use non-blocking communication,
       // where it is generally less overhead to first initiate the receive and
-      // then actually send the data
+      // then actually send the data. Persistent requests are only set up
+      // once and then restarted in the same order.
 
       const unsigned int mpi_tag =
         Utilities::MPI::internal::Tags::partitioner_import_start +
         communication_channel;
       Assert(mpi_tag <= Utilities::MPI::internal::Tags::partitioner_import_end,
              ExcInternalError());
-      requests.resize(n_import_targets + n_ghost_targets);
+      const bool setup_requests =
+        (use_persistent_requests == false || requests.empty());
+      if (setup_requests)
+        requests.resize(n_import_targets + n_ghost_targets);
+      else
+        AssertDimension(requests.size(), n_import_targets + n_ghost_targets);
 
       // initiate the receive operations
       Number *temp_array_ptr = temporary_storage.data();
-      for (unsigned int i = 0; i < n_import_targets; ++i)
+      for (unsigned int i = 0; setup_requests && i < n_import_targets; ++i)
         {
           AssertThrow(
             static_cast<std::size_t>(import_targets_data[i].second) *
@@ -350,16 +396,29 @@ namespace Utilities
                        "The number of ghost entries times the size of 'Number' "
                        "exceeds this value. This is not supported."));
           const int ierr =
-            MPI_Irecv(temp_array_ptr,
-                      import_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      import_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[i]);
+            use_persistent_requests ?
+              MPI_Recv_init(temp_array_ptr,
+                            import_targets_data[i].second * sizeof(Number),
+                            MPI_BYTE,
+                            import_targets_data[i].first,
+                            mpi_tag,
+                            communicator,
+                            &requests[i]) :
+              MPI_Irecv(temp_array_ptr,
+                        import_targets_data[i].second * sizeof(Number),
+                        MPI_BYTE,
+                        import_targets_data[i].first,
+                        mpi_tag,
+                        communicator,
+                        &requests[i]);
           AssertThrowMPI(ierr);
           temp_array_ptr += import_targets_data[i].second;
         }
+      if (use_persistent_requests && n_import_targets > 0)
+        {
+          const int ierr = MPI_Startall(n_import_targets, requests.data());
+          AssertThrowMPI(ierr);
+        }
 
       // initiate the send operations
 
@@ -448,18 +507,35 @@ namespace Utilities
                        "exceeds this value. This is not supported."));
           if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
             Kokkos::fence();
-          const int ierr =
-            MPI_Isend(ghost_array_ptr,
-                      ghost_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      ghost_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[n_import_targets + i]);
-          AssertThrowMPI(ierr);
+          if (setup_requests)
+            {
+              const int ierr =
+                use_persistent_requests ?
+                  MPI_Send_init(ghost_array_ptr,
+                                ghost_targets_data[i].second * sizeof(Number),
+                                MPI_BYTE,
+                                ghost_targets_data[i].first,
+                                mpi_tag,
+                                communicator,
+                                &requests[n_import_targets + i]) :
+                  MPI_Isend(ghost_array_ptr,
+                            ghost_targets_data[i].second * sizeof(Number),
+                            MPI_BYTE,
+                            ghost_targets_data[i].first,
+                            mpi_tag,
+                            communicator,
+                            &requests[n_import_targets + i]);
+              AssertThrowMPI(ierr);
+            }
 
           ghost_array_ptr += ghost_targets_data[i].second;
         }
+      if (use_persistent_requests && n_ghost_targets > 0)
+        {
+          const int ierr = MPI_Startall(n_ghost_targets,
+                                        requests.data() + n_import_targets);
+          AssertThrowMPI(ierr);
+        }
     }
 
 
@@ -533,7 +609,8 @@ namespace Utilities
       const ArrayView<const Number, MemorySpaceType> &temporary_storage,
       const ArrayView<Number, MemorySpaceType>       &locally_owned_array,
       const ArrayView<Number, MemorySpaceType>       &ghost_array,
-      std::vector<MPI_Request>                       &requests) const
+      std::vector<MPI_Request>                       &requests,
+      const bool use_persistent_requests) const
     {
       AssertDimension(temporary_storage.size(), n_import_indices());
       Assert(ghost_array.size() == n_ghost_indices() ||
@@ -547,7 +624,7 @@ namespace Utilities
       if constexpr (running_in_debug_mode() == false)
         if (vector_operation == VectorOperation::insert)
           {
-            Assert(requests.empty(),
+            Assert(requests.empty() || use_persistent_requests,
                    ExcInternalError(
                      "Did not expect a non-empty communication "
                      "request when inserting. Check that the same "
@@ -786,8 +863,9 @@ namespace Utilities
             }
         }
 
-      // clear the compress requests
-      requests.resize(0);
+      // clear the compress requests, unless they are kept for reuse
+      if (use_persistent_requests == false)
+        requests.resize(0);
     }
 
 
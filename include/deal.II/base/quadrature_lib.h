@@ -911,6 +911,41 @@ public:
   explicit QGaussSimplex(const unsigned int n_points_1D);
 };
 
+/**
+ * Gauss-type quadrature formula for simplex entities that is the image of a
+ * tensor-product formula on the unit hypercube under the collapsed (Duffy)
+ * transformation $x = a (1-b) (1-c)$, $y = b (1-c)$, $z = c$ in 3d and
+ * $x = a (1-b)$, $y = b$ in 2d. A Gauss-Legendre formula is used for the
+ * coordinate $a$, whereas the coordinates $b$ and $c$ use Gauss-Jacobi
+ * formulas whose weight functions $(1-b)$ and $(1-c)^2$ contain the
+ * Jacobian of the transformation. With @p n_points_1D points per coordinate,
+ * the formula integrates polynomials of degree $2 n - 1$ exactly, like
+ * QGauss, using $n^{dim}$ points.
+ *
+ * The quadrature points are enumerated with $a$ running fastest and $c$
+ * slowest. This product structure allows FEEvaluation to evaluate FE_SimplexP
+ * and FE_SimplexDGP by sum factorization in the collapsed coordinates, which
+ * is considerably cheaper than the multiplication with the full matrices of
+ * shape values and gradients needed for QGaussSimplex and
+ * QWitherdenVincentSimplex, even though the latter formulas use fewer points.
+ *
+ * For 1d, the quadrature rule degenerates to a
+ * `dealii::QGauss<1>(n_points_1d)`.
+ *
+ * Also see
+ * @ref simplex "Simplex support".
+ */
+template <int dim>
+class QCollapsedGaussSimplex : public QSimplex<dim>
+{
+public:
+  /**
+   * Constructor taking the number of quadrature points @p n_points_1D in each
+   * of the collapsed coordinates.
+   */
+  explicit QCollapsedGaussSimplex(const unsigned int n_points_1D);
+};
+
 /**
  * Witherden-Vincent rules for simplex entities.
  *
@@ -21,6 +21,12 @@
 
 DEAL_II_NAMESPACE_OPEN
 
+// Forward declarations
+#ifndef DOXYGEN
+template <int dim, int spacedim>
+class FiniteElement;
+#endif
+
 /**
  * A namespace with repartitioning policies. These classes return vectors
  * of the new owners of the active locally owned and ghost cells of a
@@ -138,6 +144,23 @@ namespace RepartitioningPolicyTools
      */
     MinimalGranularityPolicy(const unsigned int n_min_cells);
 
+    /**
+     * Constructor taking the minimum number of degrees of freedom per process
+     * for the finite element @p fe. The number of degrees of freedom per cell
+     * is estimated by the number of unknowns a cell contributes in the
+     * interior of a mesh of hypercube cells, i.e., each cell adds one vertex,
+     * @p dim lines, and so on, which is exact for discontinuous elements and
+     * accurate for continuous elements on meshes that are not too small.
+     *
+     * This variant is useful on the coarse levels of global-coarsening
+     * multigrid, where the number of unknowns rather than the number of cells
+     * determines when the communication latency dominates the work on a
+     * process, so that the remaining cells should be agglomerated on fewer
+     * processes.
+     */
+    MinimalGranularityPolicy(const FiniteElement<dim, spacedim> &fe,
+                             const unsigned int                  n_min_dofs);
+
     virtual LinearAlgebra::distributed::Vector<double>
     partition(const Triangulation<dim, spacedim> &tria_in) const override;
 
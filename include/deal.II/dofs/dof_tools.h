@@ -417,6 +417,12 @@ namespace DoFTools
    * need to remember using SparsityPattern::compress() after generating the
    * pattern.
    *
+   * @note If the memory needed for the intermediate DynamicSparsityPattern
+   * is a concern, this function can be called through
+   * SparsityPattern::build_in_row_chunks(), which only ever stores a part of
+   * the rows in such an object. If many threads are available,
+   * a SparsityPatternBuilder allows to run this function in parallel.
+   *
    * @ingroup constraints
    */
   template <int dim, int spacedim, typename number = double>
@@ -529,6 +535,37 @@ namespace DoFTools
                         const DoFHandler<dim, spacedim> &dof_col,
                         SparsityPatternBase             &sparsity);
 
+  /**
+   * Return a chunk size for a ChunkSparsityPattern and ChunkSparseMatrix
+   * built on the given @p dof_handler such that the chunks are completely
+   * filled.
+   *
+   * With the numbering created by DoFHandler::distribute_dofs(), the degrees
+   * of freedom located on a vertex, line, quad, or hex are numbered
+   * consecutively. For an FESystem composed of several copies of the same
+   * scalar element, such as <code>FESystem<dim>(FE_Q<dim>(2), dim)</code>
+   * for elasticity, the number of degrees of freedom on each of these
+   * objects is a multiple of the number of vector components. Chunks of
+   * that size then only contain degrees of freedom of a single object, which
+   * all couple to the same set of other degrees of freedom, so the chunks
+   * of the matrix do not contain padding zeros. This is the same
+   * block-compressed layout that is sometimes referred to as "block CSR"
+   * or "BAIJ" format.
+   *
+   * The function returns the number of vector components if it divides the
+   * number of degrees of freedom on each kind of object for all elements of
+   * the DoFHandler's hp::FECollection. Otherwise, it returns one.
+   *
+   * @note The result is only meaningful if the degrees of freedom of each
+   * object are numbered consecutively, as done by
+   * DoFHandler::distribute_dofs(). Renumberings such as
+   * DoFRenumbering::component_wise() or DoFRenumbering::Cuthill_McKee()
+   * destroy this structure.
+   */
+  template <int dim, int spacedim>
+  unsigned int
+  suggest_chunk_size(const DoFHandler<dim, spacedim> &dof_handler);
+
   /**
    * Compute which entries of a matrix built on the given @p dof_handler may
    * possibly be nonzero, and create a sparsity pattern object that represents
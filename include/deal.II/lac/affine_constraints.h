@@ -1468,7 +1468,8 @@ public:
    * simultaneous access and the access is not to rows with the same global
    * index at the same time. This needs to be made sure from the caller's
    * site. There is no locking mechanism inside this method to prevent data
-   * races.
+   * races. The class ConcurrentVectorAdder wraps a vector into an object
+   * that can be written to by several threads at the same time.
    */
   template <typename VectorType>
   void
@@ -1605,7 +1606,8 @@ public:
    * simultaneous access and the access is not to rows with the same global
    * index at the same time. This needs to be made sure from the caller's
    * site. There is no locking mechanism inside this method to prevent data
-   * races.
+   * races. The class ConcurrentSparseMatrixAdder wraps a SparseMatrix into an
+   * object that can be written to by several threads at the same time.
    */
   template <typename MatrixType>
   void
@@ -1689,7 +1691,9 @@ public:
    * for simultaneous access and the access is not to rows with the same
    * global index at the same time. This needs to be made sure from the
    * caller's site. There is no locking mechanism inside this method to
-   * prevent data races.
+   * prevent data races. The classes ConcurrentSparseMatrixAdder and
+   * ConcurrentVectorAdder wrap a SparseMatrix and a vector into objects that
+   * can be written to by several threads at the same time.
    */
   template <typename MatrixType, typename VectorType>
   void
@@ -1832,6 +1836,12 @@ public:
    *
    * @note If this function is called with a parallel vector @p vec, then the
    * vector must not contain ghost elements.
+   *
+   * @note If the same constraints are applied to many vectors of type Vector
+   * or LinearAlgebra::distributed::Vector, the class
+   * CompiledAffineConstraints provides a faster, vectorized and
+   * multithreaded implementation of this function as well as of set_zero()
+   * and condense().
    */
   template <typename VectorType>
   void
@@ -38,10 +38,6 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace internal
 {
-  // TODO: the goal of the ChunkSparseMatrix class is to stream data and use
-  // the vectorization features of modern processors. to make this happen,
-  // we will have to vectorize the functions in the following namespace, either
-  // by hand or by using, for example, optimized BLAS versions for them.
   namespace ChunkSparseMatrixImplementation
   {
     /**
@@ -53,8 +49,14 @@ namespace internal
      * Add the result of multiplying a chunk of size chunk_size times
      * chunk_size by a source vector fragment of size chunk_size to the
      * destination vector fragment.
+     *
+     * If the template argument @p n_static is positive, it is used as the
+     * chunk size instead of the run time argument @p chunk_size. This
+     * allows the compiler to completely unroll the loops and to keep the
+     * source vector fragment and the partial sums in registers.
      */
-    template <typename MatrixIterator,
+    template <int n_static = 0,
+              typename MatrixIterator,
               typename SrcIterator,
               typename DstIterator>
     inline void
@@ -63,16 +65,36 @@ namespace internal
                     const SrcIterator    src,
                     DstIterator          dst)
     {
-      MatrixIterator matrix_row = matrix;
+      using value_type = typename std::iterator_traits<DstIterator>::value_type;
 
-      for (size_type i = 0; i < chunk_size; ++i, matrix_row += chunk_size)
+      if constexpr (n_static > 0)
         {
-          typename std::iterator_traits<DstIterator>::value_type sum = 0;
+          (void)chunk_size;
+          value_type src_values[n_static];
+          for (int j = 0; j < n_static; ++j)
+            src_values[j] = src[j];
 
-          for (size_type j = 0; j < chunk_size; ++j)
-            sum += matrix_row[j] * src[j];
+          for (int i = 0; i < n_static; ++i)
+            {
+              value_type sum = 0;
+              for (int j = 0; j < n_static; ++j)
+                sum += matrix[i * n_static + j] * src_values[j];
+              dst[i] += sum;
+            }
+        }
+      else
+        {
+          MatrixIterator matrix_row = matrix;
+
+          for (size_type i = 0; i < chunk_size; ++i, matrix_row += chunk_size)
+            {
+              value_type sum = 0;
 
-          dst[i] += sum;
+              for (size_type j = 0; j < chunk_size; ++j)
+                sum += matrix_row[j] * src[j];
+
+              dst[i] += sum;
+            }
         }
     }
 
@@ -82,7 +104,8 @@ namespace internal
      * Like the previous function, but subtract. We need this for computing
      * the residual.
      */
-    template <typename MatrixIterator,
+    template <int n_static = 0,
+              typename MatrixIterator,
               typename SrcIterator,
               typename DstIterator>
     inline void
@@ -91,16 +114,36 @@ namespace internal
                          const SrcIterator    src,
                          DstIterator          dst)
     {
-      MatrixIterator matrix_row = matrix;
+      using value_type = typename std::iterator_traits<DstIterator>::value_type;
 
-      for (size_type i = 0; i < chunk_size; ++i, matrix_row += chunk_size)
+      if constexpr (n_static > 0)
         {
-          typename std::iterator_traits<DstIterator>::value_type sum = 0;
+          (void)chunk_size;
+          value_type src_values[n_static];
+          for (int j = 0; j < n_static; ++j)
+            src_values[j] = src[j];
 
-          for (size_type j = 0; j < chunk_size; ++j)
-            sum += matrix_row[j] * src[j];
+          for (int i = 0; i < n_static; ++i)
+            {
+              value_type sum = 0;
+              for (int j = 0; j < n_static; ++j)
+                sum += matrix[i * n_static + j] * src_values[j];
+              dst[i] -= sum;
+            }
+        }
+      else
+        {
+          MatrixIterator matrix_row = matrix;
 
-          dst[i] -= sum;
+          for (size_type i = 0; i < chunk_size; ++i, matrix_row += chunk_size)
+            {
+              value_type sum = 0;
+
+              for (size_type j = 0; j < chunk_size; ++j)
+                sum += matrix_row[j] * src[j];
+
+              dst[i] -= sum;
+            }
         }
     }
 
@@ -108,9 +151,11 @@ namespace internal
     /**
      * Add the result of multiplying the transpose of a chunk of size
      * chunk_size times chunk_size by a source vector fragment of size
-     * chunk_size to the destination vector fragment.
+     * chunk_size to the destination vector fragment. The template argument
+     * @p n_static has the same meaning as in chunk_vmult_add().
      */
-    template <typename MatrixIterator,
+    template <int n_static = 0,
+              typename MatrixIterator,
               typename SrcIterator,
               typename DstIterator>
     inline void
@@ -119,15 +164,33 @@ namespace internal
                      const SrcIterator    src,
                      DstIterator          dst)
     {
-      for (size_type i = 0; i < chunk_size; ++i)
+      using value_type = typename std::iterator_traits<DstIterator>::value_type;
+
+      if constexpr (n_static > 0)
         {
-          typename std::iterator_traits<DstIterator>::value_type sum = 0;
+          (void)chunk_size;
+          // accumulate row by row to walk through the chunk in the order it
+          // is stored in memory
+          value_type sums[n_static] = {};
+          for (int j = 0; j < n_static; ++j)
+            {
+              const value_type src_value = src[j];
+              for (int i = 0; i < n_static; ++i)
+                sums[i] += matrix[j * n_static + i] * src_value;
+            }
+          for (int i = 0; i < n_static; ++i)
+            dst[i] += sums[i];
+        }
+      else
+        for (size_type i = 0; i < chunk_size; ++i)
+          {
+            value_type sum = 0;
 
-          for (size_type j = 0; j < chunk_size; ++j)
-            sum += matrix[j * chunk_size + i] * src[j];
+            for (size_type j = 0; j < chunk_size; ++j)
+              sum += matrix[j * chunk_size + i] * src[j];
 
-          dst[i] += sum;
-        }
+            dst[i] += sum;
+          }
     }
 
 
@@ -166,13 +229,23 @@ namespace internal
 
     /**
      * Perform a vmult_add using the ChunkSparseMatrix data structures, but
-     * only using a subinterval of the matrix rows.
+     * only using a subinterval of the matrix rows. If @p subtract is set,
+     * the product is subtracted from rather than added to @p dst, which is
+     * what we need for the residual.
      *
      * In the sequential case, this function is called on all rows, in the
      * parallel case it may be called on a subrange, at the discretion of the
      * task scheduler.
+     *
+     * A positive template argument @p n_static must equal the chunk size of
+     * the sparsity pattern and selects the kernels specialized for this
+     * chunk size.
      */
-    template <typename number, typename InVector, typename OutVector>
+    template <int  n_static,
+              bool subtract,
+              typename number,
+              typename InVector,
+              typename OutVector>
     void
     vmult_add_on_subrange(const ChunkSparsityPattern &cols,
                           const unsigned int          begin_row,
@@ -183,9 +256,13 @@ namespace internal
                           const InVector             &src,
                           OutVector                  &dst)
     {
-      const size_type m          = cols.n_rows();
-      const size_type n          = cols.n_cols();
-      const size_type chunk_size = cols.get_chunk_size();
+      Assert(n_static <= 0 || cols.get_chunk_size() == size_type(n_static),
+             ExcInternalError());
+
+      const size_type m = cols.n_rows();
+      const size_type n = cols.n_cols();
+      const size_type chunk_size =
+        n_static > 0 ? size_type(n_static) : cols.get_chunk_size();
 
       // loop over all chunks. note that we need to treat the last chunk row
       // and column differently if they have padding elements
@@ -198,6 +275,13 @@ namespace internal
           end_row;
       const size_type irregular_col = n / chunk_size;
 
+      const auto add_entry = [](auto &dst_entry, const auto product) {
+        if constexpr (subtract)
+          dst_entry -= product;
+        else
+          dst_entry += product;
+      };
+
       typename OutVector::iterator dst_ptr =
         dst.begin() + chunk_size * begin_row;
       const number *val_ptr =
@@ -211,16 +295,27 @@ namespace internal
           while (val_ptr != val_end_of_row)
             {
               if (*colnum_ptr != irregular_col)
-                chunk_vmult_add(chunk_size,
-                                val_ptr,
-                                src.begin() + *colnum_ptr * chunk_size,
-                                dst_ptr);
+                {
+                  if constexpr (subtract)
+                    chunk_vmult_subtract<n_static>(chunk_size,
+                                                   val_ptr,
+                                                   src.begin() +
+                                                     *colnum_ptr * chunk_size,
+                                                   dst_ptr);
+                  else
+                    chunk_vmult_add<n_static>(chunk_size,
+                                              val_ptr,
+                                              src.begin() +
+                                                *colnum_ptr * chunk_size,
+                                              dst_ptr);
+                }
               else
                 // we're at a chunk column that has padding
                 for (size_type r = 0; r < chunk_size; ++r)
                   for (size_type c = 0; c < n_filled_last_cols; ++c)
-                    dst_ptr[r] += (val_ptr[r * chunk_size + c] *
-                                   src(*colnum_ptr * chunk_size + c));
+                    add_entry(dst_ptr[r],
+                              val_ptr[r * chunk_size + c] *
+                                src(*colnum_ptr * chunk_size + c));
 
               ++colnum_ptr;
               val_ptr += chunk_size * chunk_size;
@@ -243,15 +338,17 @@ namespace internal
                   // we're at a chunk row but not column that has padding
                   for (size_type r = 0; r < n_filled_last_rows; ++r)
                     for (size_type c = 0; c < chunk_size; ++c)
-                      dst_ptr[r] += (val_ptr[r * chunk_size + c] *
-                                     src(*colnum_ptr * chunk_size + c));
+                      add_entry(dst_ptr[r],
+                                val_ptr[r * chunk_size + c] *
+                                  src(*colnum_ptr * chunk_size + c));
                 }
               else
                 // we're at a chunk row and column that has padding
                 for (size_type r = 0; r < n_filled_last_rows; ++r)
                   for (size_type c = 0; c < n_filled_last_cols; ++c)
-                    dst_ptr[r] += (val_ptr[r * chunk_size + c] *
-                                   src(*colnum_ptr * chunk_size + c));
+                    add_entry(dst_ptr[r],
+                              val_ptr[r * chunk_size + c] *
+                                src(*colnum_ptr * chunk_size + c));
 
               ++colnum_ptr;
               val_ptr += chunk_size * chunk_size;
@@ -263,6 +360,164 @@ namespace internal
                rowstart[end_row] * chunk_size * chunk_size,
              ExcInternalError());
     }
+
+
+
+    /**
+     * Select the variant of vmult_add_on_subrange() with kernels specialized
+     * for the chunk size of the given sparsity pattern. Specializations are
+     * provided for the chunk sizes that typically appear for vector-valued
+     * problems, i.e., when the chunk size matches the number of components
+     * of an FESystem; all other chunk sizes use the generic kernels.
+     */
+    template <bool subtract,
+              typename number,
+              typename InVector,
+              typename OutVector>
+    void
+    vmult_add_on_subrange_select(const ChunkSparsityPattern &cols,
+                                 const unsigned int          begin_row,
+                                 const unsigned int          end_row,
+                                 const number               *values,
+                                 const std::size_t          *rowstart,
+                                 const size_type            *colnums,
+                                 const InVector             &src,
+                                 OutVector                  &dst)
+    {
+      switch (cols.get_chunk_size())
+        {
+          case 1:
+            vmult_add_on_subrange<1, subtract>(
+              cols, begin_row, end_row, values, rowstart, colnums, src, dst);
+            break;
+          case 2:
+            vmult_add_on_subrange<2, subtract>(
+              cols, begin_row, end_row, values, rowstart, colnums, src, dst);
+            break;
+          case 3:
+            vmult_add_on_subrange<3, subtract>(
+              cols, begin_row, end_row, values, rowstart, colnums, src, dst);
+            break;
+          case 4:
+            vmult_add_on_subrange<4, subtract>(
+              cols, begin_row, end_row, values, rowstart, colnums, src, dst);
+            break;
+          case 6:
+            vmult_add_on_subrange<6, subtract>(
+              cols, begin_row, end_row, values, rowstart, colnums, src, dst);
+            break;
+          case 8:
+            vmult_add_on_subrange<8, subtract>(
+              cols, begin_row, end_row, values, rowstart, colnums, src, dst);
+            break;
+          default:
+            vmult_add_on_subrange<0, subtract>(
+              cols, begin_row, end_row, values, rowstart, colnums, src, dst);
+        }
+    }
+
+
+
+    /**
+     * Perform a Tvmult_add using the ChunkSparseMatrix data structures. A
+     * positive template argument @p n_static must equal the chunk size of
+     * the sparsity pattern and selects the kernels specialized for this
+     * chunk size.
+     */
+    template <int n_static,
+              typename number,
+              typename InVector,
+              typename OutVector>
+    void
+    Tvmult_add(const ChunkSparsityPattern &cols,
+               const size_type             n_chunk_rows,
+               const size_type             n_chunk_cols,
+               const number               *values,
+               const std::size_t          *rowstart,
+               const size_type            *colnums,
+               const InVector             &src,
+               OutVector                  &dst)
+    {
+      Assert(n_static <= 0 || cols.get_chunk_size() == size_type(n_static),
+             ExcInternalError());
+
+      const size_type m = cols.n_rows();
+      const size_type n = cols.n_cols();
+      const size_type chunk_size =
+        n_static > 0 ? size_type(n_static) : cols.get_chunk_size();
+
+      // loop over all chunks. note that we need to treat the last chunk row
+      // and column differently if they have padding elements
+      const bool rows_have_padding = (m % chunk_size != 0),
+                 cols_have_padding = (n % chunk_size != 0);
+
+      const size_type n_regular_chunk_rows =
+        (rows_have_padding ? n_chunk_rows - 1 : n_chunk_rows);
+
+      // like in vmult_add, but don't keep an iterator into dst around since
+      // we're not traversing it sequentially this time
+      const number    *val_ptr    = values;
+      const size_type *colnum_ptr = colnums;
+
+      for (size_type chunk_row = 0; chunk_row < n_regular_chunk_rows;
+           ++chunk_row)
+        {
+          const number *const val_end_of_row =
+            &values[rowstart[chunk_row + 1] * chunk_size * chunk_size];
+          while (val_ptr != val_end_of_row)
+            {
+              if ((cols_have_padding == false) ||
+                  (*colnum_ptr != n_chunk_cols - 1))
+                chunk_Tvmult_add<n_static>(chunk_size,
+                                           val_ptr,
+                                           src.begin() + chunk_row * chunk_size,
+                                           dst.begin() +
+                                             *colnum_ptr * chunk_size);
+              else
+                // we're at a chunk column that has padding
+                for (size_type r = 0; r < chunk_size; ++r)
+                  for (size_type c = 0; c < n % chunk_size; ++c)
+                    dst(*colnum_ptr * chunk_size + c) +=
+                      (val_ptr[r * chunk_size + c] *
+                       src(chunk_row * chunk_size + r));
+
+              ++colnum_ptr;
+              val_ptr += chunk_size * chunk_size;
+            }
+        }
+
+      // now deal with last chunk row if necessary
+      if (rows_have_padding)
+        {
+          const size_type chunk_row = n_chunk_rows - 1;
+
+          const number *const val_end_of_row =
+            &values[rowstart[chunk_row + 1] * chunk_size * chunk_size];
+          while (val_ptr != val_end_of_row)
+            {
+              if ((cols_have_padding == false) ||
+                  (*colnum_ptr != n_chunk_cols - 1))
+                {
+                  // we're at a chunk row but not column that has padding
+                  for (size_type r = 0; r < m % chunk_size; ++r)
+                    for (size_type c = 0; c < chunk_size; ++c)
+                      dst(*colnum_ptr * chunk_size + c) +=
+                        (val_ptr[r * chunk_size + c] *
+                         src(chunk_row * chunk_size + r));
+                }
+              else
+                // we're at a chunk row and column that has padding
+                for (size_type r = 0; r < m % chunk_size; ++r)
+                  for (size_type c = 0; c < n % chunk_size; ++c)
+                    dst(*colnum_ptr * chunk_size + c) +=
+                      (val_ptr[r * chunk_size + c] *
+                       src(chunk_row * chunk_size + r));
+
+              ++colnum_ptr;
+              val_ptr += chunk_size * chunk_size;
+            }
+        }
+    }
   } // namespace ChunkSparseMatrixImplementation
 } // namespace internal
 
@@ -707,15 +962,15 @@ ChunkSparseMatrix<number>::vmult_add(OutVector &dst, const InVector &src) const
     cols->sparsity_pattern.n_rows(),
     [this, &src, &dst](const unsigned int begin_row,
                        const unsigned int end_row) {
-      internal::ChunkSparseMatrixImplementation::vmult_add_on_subrange(
-        *cols,
-        begin_row,
-        end_row,
-        val.get(),
-        cols->sparsity_pattern.rowstart.get(),
-        cols->sparsity_pattern.colnums.get(),
-        src,
-        dst);
+      internal::ChunkSparseMatrixImplementation::vmult_add_on_subrange_select<
+        false>(*cols,
+               begin_row,
+               end_row,
+               val.get(),
+               cols->sparsity_pattern.rowstart.get(),
+               cols->sparsity_pattern.colnums.get(),
+               src,
+               dst);
     },
     internal::SparseMatrixImplementation::minimum_parallel_grain_size /
         cols->chunk_size +
@@ -735,79 +990,42 @@ ChunkSparseMatrix<number>::Tvmult_add(OutVector &dst, const InVector &src) const
 
   Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
 
-  const size_type n_chunk_rows = cols->sparsity_pattern.n_rows();
-
-  // loop over all chunks. note that we need to treat the last chunk row and
-  // column differently if they have padding elements
-  const bool rows_have_padding = (m() % cols->chunk_size != 0),
-             cols_have_padding = (n() % cols->chunk_size != 0);
-
-  const size_type n_regular_chunk_rows =
-    (rows_have_padding ? n_chunk_rows - 1 : n_chunk_rows);
-
-  // like in vmult_add, but don't keep an iterator into dst around since we're
-  // not traversing it sequentially this time
-  const number    *val_ptr    = val.get();
-  const size_type *colnum_ptr = cols->sparsity_pattern.colnums.get();
-
-  for (size_type chunk_row = 0; chunk_row < n_regular_chunk_rows; ++chunk_row)
+  const auto apply_Tvmult_add = [&](const auto n_static) {
+    internal::ChunkSparseMatrixImplementation::Tvmult_add<
+      decltype(n_static)::value>(*cols,
+                                 cols->sparsity_pattern.n_rows(),
+                                 cols->sparsity_pattern.n_cols(),
+                                 val.get(),
+                                 cols->sparsity_pattern.rowstart.get(),
+                                 cols->sparsity_pattern.colnums.get(),
+                                 src,
+                                 dst);
+  };
+
+  // select the kernels specialized for the chunk size, see
+  // internal::ChunkSparseMatrixImplementation::vmult_add_on_subrange_select()
+  switch (cols->chunk_size)
     {
-      const number *const val_end_of_row =
-        &val[cols->sparsity_pattern.rowstart[chunk_row + 1] * cols->chunk_size *
-             cols->chunk_size];
-      while (val_ptr != val_end_of_row)
-        {
-          if ((cols_have_padding == false) ||
-              (*colnum_ptr != cols->sparsity_pattern.n_cols() - 1))
-            internal::ChunkSparseMatrixImplementation::chunk_Tvmult_add(
-              cols->chunk_size,
-              val_ptr,
-              src.begin() + chunk_row * cols->chunk_size,
-              dst.begin() + *colnum_ptr * cols->chunk_size);
-          else
-            // we're at a chunk column that has padding
-            for (size_type r = 0; r < cols->chunk_size; ++r)
-              for (size_type c = 0; c < n() % cols->chunk_size; ++c)
-                dst(*colnum_ptr * cols->chunk_size + c) +=
-                  (val_ptr[r * cols->chunk_size + c] *
-                   src(chunk_row * cols->chunk_size + r));
-
-          ++colnum_ptr;
-          val_ptr += cols->chunk_size * cols->chunk_size;
-        }
-    }
-
-  // now deal with last chunk row if necessary
-  if (rows_have_padding)
-    {
-      const size_type chunk_row = n_chunk_rows - 1;
-
-      const number *const val_end_of_row =
-        &val[cols->sparsity_pattern.rowstart[chunk_row + 1] * cols->chunk_size *
-             cols->chunk_size];
-      while (val_ptr != val_end_of_row)
-        {
-          if ((cols_have_padding == false) ||
-              (*colnum_ptr != cols->sparsity_pattern.n_cols() - 1))
-            {
-              // we're at a chunk row but not column that has padding
-              for (size_type r = 0; r < m() % cols->chunk_size; ++r)
-                for (size_type c = 0; c < cols->chunk_size; ++c)
-                  dst(*colnum_ptr * cols->chunk_size + c) +=
-                    (val_ptr[r * cols->chunk_size + c] *
-                     src(chunk_row * cols->chunk_size + r));
-            }
-          else
-            // we're at a chunk row and column that has padding
-            for (size_type r = 0; r < m() % cols->chunk_size; ++r)
-              for (size_type c = 0; c < n() % cols->chunk_size; ++c)
-                dst(*colnum_ptr * cols->chunk_size + c) +=
-                  (val_ptr[r * cols->chunk_size + c] *
-                   src(chunk_row * cols->chunk_size + r));
-
-          ++colnum_ptr;
-          val_ptr += cols->chunk_size * cols->chunk_size;
-        }
+      case 1:
+        apply_Tvmult_add(std::integral_constant<int, 1>());
+        break;
+      case 2:
+        apply_Tvmult_add(std::integral_constant<int, 2>());
+        break;
+      case 3:
+        apply_Tvmult_add(std::integral_constant<int, 3>());
+        break;
+      case 4:
+        apply_Tvmult_add(std::integral_constant<int, 4>());
+        break;
+      case 6:
+        apply_Tvmult_add(std::integral_constant<int, 6>());
+        break;
+      case 8:
+        apply_Tvmult_add(std::integral_constant<int, 8>());
+        break;
+      default:
+        apply_Tvmult_add(std::integral_constant<int, 0>());
     }
 }
 
@@ -1114,89 +1332,25 @@ ChunkSparseMatrix<number>::residual(Vector<somenumber>       &dst,
   // access patterns, breaking things up into two loops may be reasonable
   dst = b;
 
-  /////////
   // the rest of this function is like vmult_add, except that we subtract
   // rather than add A*u
-  /////////
-  const size_type n_chunk_rows = cols->sparsity_pattern.n_rows();
-
-  // loop over all chunks. note that we need to treat the last chunk row and
-  // column differently if they have padding elements
-  const bool rows_have_padding = (m() % cols->chunk_size != 0),
-             cols_have_padding = (n() % cols->chunk_size != 0);
-
-  const size_type n_regular_chunk_rows =
-    (rows_have_padding ? n_chunk_rows - 1 : n_chunk_rows);
-
-  const number    *val_ptr    = val.get();
-  const size_type *colnum_ptr = cols->sparsity_pattern.colnums.get();
-  typename Vector<somenumber>::iterator dst_ptr = dst.begin();
-
-  for (size_type chunk_row = 0; chunk_row < n_regular_chunk_rows; ++chunk_row)
-    {
-      const number *const val_end_of_row =
-        &val[cols->sparsity_pattern.rowstart[chunk_row + 1] * cols->chunk_size *
-             cols->chunk_size];
-      while (val_ptr != val_end_of_row)
-        {
-          if ((cols_have_padding == false) ||
-              (*colnum_ptr != cols->sparsity_pattern.n_cols() - 1))
-            internal::ChunkSparseMatrixImplementation::chunk_vmult_subtract(
-              cols->chunk_size,
-              val_ptr,
-              u.begin() + *colnum_ptr * cols->chunk_size,
-              dst_ptr);
-          else
-            // we're at a chunk column that has padding
-            for (size_type r = 0; r < cols->chunk_size; ++r)
-              for (size_type c = 0; c < n() % cols->chunk_size; ++c)
-                dst(chunk_row * cols->chunk_size + r) -=
-                  (val_ptr[r * cols->chunk_size + c] *
-                   u(*colnum_ptr * cols->chunk_size + c));
-
-          ++colnum_ptr;
-          val_ptr += cols->chunk_size * cols->chunk_size;
-        }
-
-
-      dst_ptr += cols->chunk_size;
-    }
-
-  // now deal with last chunk row if necessary
-  if (rows_have_padding)
-    {
-      const size_type chunk_row = n_chunk_rows - 1;
-
-      const number *const val_end_of_row =
-        &val[cols->sparsity_pattern.rowstart[chunk_row + 1] * cols->chunk_size *
-             cols->chunk_size];
-      while (val_ptr != val_end_of_row)
-        {
-          if ((cols_have_padding == false) ||
-              (*colnum_ptr != cols->sparsity_pattern.n_cols() - 1))
-            {
-              // we're at a chunk row but not column that has padding
-              for (size_type r = 0; r < m() % cols->chunk_size; ++r)
-                for (size_type c = 0; c < cols->chunk_size; ++c)
-                  dst(chunk_row * cols->chunk_size + r) -=
-                    (val_ptr[r * cols->chunk_size + c] *
-                     u(*colnum_ptr * cols->chunk_size + c));
-            }
-          else
-            // we're at a chunk row and column that has padding
-            for (size_type r = 0; r < m() % cols->chunk_size; ++r)
-              for (size_type c = 0; c < n() % cols->chunk_size; ++c)
-                dst(chunk_row * cols->chunk_size + r) -=
-                  (val_ptr[r * cols->chunk_size + c] *
-                   u(*colnum_ptr * cols->chunk_size + c));
-
-          ++colnum_ptr;
-          val_ptr += cols->chunk_size * cols->chunk_size;
-        }
-
-
-      dst_ptr += cols->chunk_size;
-    }
+  parallel::apply_to_subranges(
+    0U,
+    cols->sparsity_pattern.n_rows(),
+    [this, &u, &dst](const unsigned int begin_row, const unsigned int end_row) {
+      internal::ChunkSparseMatrixImplementation::vmult_add_on_subrange_select<
+        true>(*cols,
+              begin_row,
+              end_row,
+              val.get(),
+              cols->sparsity_pattern.rowstart.get(),
+              cols->sparsity_pattern.colnums.get(),
+              u,
+              dst);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        cols->chunk_size +
+      1);
 
   // finally compute the norm
   return dst.l2_norm();
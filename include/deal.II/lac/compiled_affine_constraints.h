@@ -0,0 +1,365 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_compiled_affine_constraints_h
+#define dealii_compiled_affine_constraints_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A read-only, "compiled" form of an AffineConstraints object that applies
+ * the constraints to vectors with considerably less overhead than the
+ * functions of AffineConstraints itself.
+ *
+ * AffineConstraints stores each constraint as a separate object with its own
+ * array of entries, indexed by global indices. AffineConstraints::distribute()
+ * and AffineConstraints::set_zero() therefore follow one pointer per
+ * constraint and translate every index into the local storage of the vector,
+ * one entry at a time. In nonlinear or time-dependent problems on adaptively
+ * refined meshes, where the same constraints are applied to many vectors,
+ * this can take a noticeable share of the run time.
+ *
+ * This class converts the constraints once into flat arrays of weights and
+ * of indices into the local storage of the vectors they are later applied
+ * to, in a similar way as the matrix-free framework does internally in
+ * internal::MatrixFreeFunctions::ConstraintInfo. Since
+ * AffineConstraints::close() resolves chains of constraints, no constraint
+ * refers to another constrained degree of freedom, so all constraints can be
+ * applied independently of each other. The constraints are sorted by their
+ * number of entries and grouped into batches of VectorizedArray::size()
+ * constraints of equal length, which distribute() and set_zero() process
+ * with SIMD gather and scatter instructions. The remaining constraints that
+ * do not fill a complete batch are handled one at a time. The batches are
+ * distributed among several threads using parallel::apply_to_subranges().
+ *
+ * The class can be used with vectors of type Vector and
+ * LinearAlgebra::distributed::Vector. For the latter, the class must be set
+ * up with the Utilities::MPI::Partitioner of the vectors it is later applied
+ * to, and all degrees of freedom that the locally owned constrained degrees
+ * of freedom depend on must be either locally owned or ghost entries of this
+ * partitioner. This is typically the case for vectors set up with the
+ * locally relevant degrees of freedom. Only the constraints of locally owned
+ * degrees of freedom are applied; the ghost values are updated as described
+ * in the documentation of the individual functions.
+ *
+ * Typical usage looks as follows:
+ * @code
+ * constraints.close();
+ *
+ * CompiledAffineConstraints<double> compiled_constraints(
+ *   constraints, solution.get_partitioner());
+ *
+ * // in each nonlinear iteration:
+ * compiled_constraints.distribute(solution);
+ * @endcode
+ *
+ * The object holds a copy of the constraints and does not observe the
+ * AffineConstraints object it was created from, so it needs to be set up
+ * again by reinit() if the constraints or the partitioning of the vectors
+ * change.
+ *
+ * @tparam Number The number type of the vectors the constraints are applied
+ * to. The weights are stored in this type, so a
+ * CompiledAffineConstraints<float> may be created from an
+ * AffineConstraints<double> object to be applied to single-precision
+ * vectors.
+ *
+ * @ingroup constraints
+ */
+template <typename Number>
+class CompiledAffineConstraints
+{
+public:
+  /**
+   * Declare the type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  static_assert(std::is_same_v<Number, double> || std::is_same_v<Number, float>,
+                "This class is only implemented for double and float.");
+
+  /**
+   * Default constructor. The object does not represent any constraints
+   * until reinit() is called.
+   */
+  CompiledAffineConstraints() = default;
+
+  /**
+   * Constructor. Calls reinit() with the given arguments.
+   */
+  template <typename number2>
+  CompiledAffineConstraints(
+    const AffineConstraints<number2>                          &constraints,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner =
+      nullptr);
+
+  /**
+   * Set up the data structures for the given @p constraints, which must
+   * have been closed.
+   *
+   * If @p partitioner is a null pointer, the object can be applied to
+   * vectors of type Vector whose entries are indexed by the global indices
+   * of the constraints. Otherwise, the object can be applied to vectors of
+   * type LinearAlgebra::distributed::Vector whose partitioner is compatible
+   * with @p partitioner. Only the constraints of the locally owned indices
+   * of @p partitioner are kept in that case, and the indices they depend on
+   * must be locally owned or ghost indices of @p partitioner.
+   */
+  template <typename number2>
+  void
+  reinit(const AffineConstraints<number2>                          &constraints,
+         const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner =
+           nullptr);
+
+  /**
+   * Release all memory and return to a state as if the default constructor
+   * had been called.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of constraints stored by this object.
+   */
+  unsigned int
+  n_constraints() const;
+
+  /**
+   * Set the values of all constrained entries of @p vec to the values
+   * prescribed by the constraints. This does the same as
+   * AffineConstraints::distribute().
+   */
+  void
+  distribute(Vector<Number> &vec) const;
+
+  /**
+   * Set the values of all locally owned constrained entries of @p vec to the
+   * values prescribed by the constraints. This does the same as
+   * AffineConstraints::distribute().
+   *
+   * The ghost values of @p vec needed to evaluate the constraints are
+   * imported with LinearAlgebra::distributed::Vector::update_ghost_values()
+   * if @p vec does not have ghost values on entry. In that case, the ghost
+   * values are zeroed again at the end. If @p vec has ghost values on entry,
+   * they are assumed to be up to date and are updated again at the end,
+   * since some of them may refer to constrained entries owned by other
+   * processes.
+   */
+  void
+  distribute(
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec) const;
+
+  /**
+   * Set all constrained entries of @p vec to zero. This does the same as
+   * AffineConstraints::set_zero().
+   */
+  void
+  set_zero(Vector<Number> &vec) const;
+
+  /**
+   * Set all locally owned constrained entries of @p vec to zero. This does
+   * the same as AffineConstraints::set_zero(). Ghost values are not touched.
+   */
+  void
+  set_zero(
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec) const;
+
+  /**
+   * Add the values of the constrained entries of @p vec, multiplied by the
+   * weights of the constraints, to the entries they depend on, and set the
+   * constrained entries to zero. This does the same as
+   * AffineConstraints::condense() for a vector and is the transpose
+   * operation of distribute() for homogeneous constraints. Consequently, the
+   * constraints must not have inhomogeneities.
+   *
+   * Since several constraints may add to the same entry, this operation is
+   * not done in parallel.
+   */
+  void
+  condense(Vector<Number> &vec) const;
+
+  /**
+   * Same as above for a distributed vector. The vector must not have ghost
+   * values on entry. Contributions to entries owned by other processes are
+   * sent there with
+   * LinearAlgebra::distributed::Vector::compress(VectorOperation::add), so
+   * unlike the variant of AffineConstraints::condense() for parallel
+   * vectors, no ghosted copy of the vector is needed.
+   */
+  void
+  condense(
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception.
+   */
+  DeclExceptionMsg(ExcPartitionerMismatch,
+                   "The partitioner of the vector is not compatible with the "
+                   "partitioner this object was set up with.");
+
+  /**
+   * Exception.
+   */
+  DeclException1(ExcIndexNotAvailable,
+                 size_type,
+                 << "A constraint depends on the degree of freedom " << arg1
+                 << ", which is neither locally owned nor a ghost index of "
+                 << "the partitioner. Set up the partitioner with all "
+                 << "locally relevant degrees of freedom.");
+
+private:
+  /**
+   * Apply the constraints to the local values of a vector. Both the
+   * constrained entries and the entries they depend on are given as indices
+   * into @p values.
+   */
+  void
+  apply_distribute(Number *values) const;
+
+  /**
+   * Set the constrained entries in @p values to zero.
+   */
+  void
+  apply_set_zero(Number *values) const;
+
+  /**
+   * Transpose of apply_distribute() for homogeneous constraints.
+   */
+  void
+  apply_condense(Number *values) const;
+
+  /**
+   * The partitioner this object was set up with, or a null pointer if it is
+   * used with serial vectors.
+   */
+  std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
+
+  /**
+   * One more than the largest index into the vector accessed by this
+   * object. Used to check the size of serial vectors.
+   */
+  size_type max_index = 0;
+
+  /**
+   * Whether any of the constraints is inhomogeneous.
+   */
+  bool has_inhomogeneities = false;
+
+  /**
+   * The local indices of the constrained entries of all full batches, with
+   * VectorizedArray::size() entries per batch.
+   */
+  std::vector<unsigned int> batch_rows;
+
+  /**
+   * The inhomogeneities of the constraints in each full batch.
+   */
+  AlignedVector<VectorizedArray<Number>> batch_inhomogeneities;
+
+  /**
+   * For each full batch, the position of its first entry in batch_weights,
+   * with an additional entry at the end.
+   */
+  std::vector<unsigned int> batch_entry_starts;
+
+  /**
+   * The local indices of the entries the constraints of the full batches
+   * depend on, with VectorizedArray::size() indices for each entry of
+   * batch_weights.
+   */
+  std::vector<unsigned int> batch_columns;
+
+  /**
+   * The weights of the constraints in the full batches, interleaved over
+   * the constraints of each batch.
+   */
+  AlignedVector<VectorizedArray<Number>> batch_weights;
+
+  /**
+   * The local indices of the constrained entries that are not part of a
+   * full batch.
+   */
+  std::vector<unsigned int> rows;
+
+  /**
+   * The inhomogeneities of the constraints in @p rows.
+   */
+  std::vector<Number> inhomogeneities;
+
+  /**
+   * The position of the first entry of each constraint in @p rows within
+   * @p columns and @p weights, with an additional entry at the end.
+   */
+  std::vector<unsigned int> row_starts;
+
+  /**
+   * The local indices of the entries the constraints in @p rows depend on.
+   */
+  std::vector<unsigned int> columns;
+
+  /**
+   * The weights of the constraints in @p rows.
+   */
+  std::vector<Number> weights;
+};
+
+/* ---------------------------- Inline functions ---------------------------- */
+
+#ifndef DOXYGEN
+
+template <typename Number>
+template <typename number2>
+inline CompiledAffineConstraints<Number>::CompiledAffineConstraints(
+  const AffineConstraints<number2>                          &constraints,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+{
+  reinit(constraints, partitioner);
+}
+
+
+
+template <typename Number>
+inline unsigned int
+CompiledAffineConstraints<Number>::n_constraints() const
+{
+  return batch_rows.size() + rows.size();
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,470 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_concurrent_assembly_h
+#define dealii_concurrent_assembly_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/observer_pointer.h>
+
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A class that gives several threads write access to the same SparseMatrix
+ * at the same time, by adding to the matrix entries with atomic operations.
+ *
+ * The usual way to assemble a matrix with several threads is to compute the
+ * local contributions in the worker function of WorkStream::run() and to
+ * write them into the global matrix in the copier function, which is only
+ * ever run by one thread at a time. The copier thus limits how well the
+ * assembly scales with the number of threads. With this class, the worker
+ * function can instead write its contributions directly, using
+ * AffineConstraints::distribute_local_to_global() with this class as the
+ * matrix type and ConcurrentVectorAdder as the vector type. This takes care
+ * of constraints and inhomogeneities in the same way as for the underlying
+ * objects, while the copier function does nothing:
+ * @code
+ * ConcurrentSparseMatrixAdder<double>           matrix_adder(system_matrix);
+ * ConcurrentVectorAdder<Vector<double>>         rhs_adder(system_rhs);
+ *
+ * WorkStream::run(
+ *   dof_handler.begin_active(),
+ *   dof_handler.end(),
+ *   [&](const auto &cell, ScratchData &scratch, CopyData &copy_data) {
+ *     // ... compute copy_data.cell_matrix and copy_data.cell_rhs ...
+ *     constraints.distribute_local_to_global(copy_data.cell_matrix,
+ *                                            copy_data.cell_rhs,
+ *                                            copy_data.local_dof_indices,
+ *                                            matrix_adder,
+ *                                            rhs_adder);
+ *   },
+ *   [](const CopyData &) {},
+ *   ScratchData(),
+ *   CopyData());
+ * @endcode
+ *
+ * Every addition to a matrix entry is a separate atomic operation, which is
+ * more expensive than a plain addition, but needs no locks and causes
+ * contention only when two threads write to the same entry at the same
+ * time. Since the order in which the contributions are added is not fixed,
+ * the result may differ from run to run in the last digits.
+ *
+ * This class only provides the functions needed by
+ * AffineConstraints::distribute_local_to_global(), and it is only
+ * implemented for real-valued matrices.
+ */
+template <typename number>
+class ConcurrentSparseMatrixAdder : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare the type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the matrix entries.
+   */
+  using value_type = number;
+
+  static_assert(numbers::NumberTraits<number>::is_complex == false,
+                "This class is only implemented for real numbers.");
+
+  /**
+   * Constructor. The object stores a pointer to @p matrix, so the matrix
+   * must live at least as long as this object.
+   */
+  explicit ConcurrentSparseMatrixAdder(SparseMatrix<number> &matrix);
+
+  /**
+   * Return the number of rows of the underlying matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the underlying matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Atomically add @p value to the entry (@p i, @p j), which must exist in
+   * the sparsity pattern of the matrix.
+   */
+  void
+  add(const size_type i, const size_type j, const number value);
+
+  /**
+   * Atomically add the given values to the entries in row @p row and the
+   * columns given by @p col_indices. The arguments have the same meaning as
+   * for SparseMatrix::add().
+   */
+  template <typename number2>
+  void
+  add(const size_type  row,
+      const size_type  n_cols,
+      const size_type *col_indices,
+      const number2   *values,
+      const bool       elide_zero_values      = true,
+      const bool       col_indices_are_sorted = false);
+
+private:
+  /**
+   * The matrix written to.
+   */
+  ObserverPointer<SparseMatrix<number>, ConcurrentSparseMatrixAdder<number>>
+    matrix;
+};
+
+
+
+/**
+ * A class that gives several threads write access to the same vector at the
+ * same time, by adding to the vector entries with atomic operations. See
+ * ConcurrentSparseMatrixAdder for how this class is used.
+ *
+ * The template argument may be any vector type with real-valued entries that
+ * returns a reference to its entries from <code>operator()</code>, such as
+ * Vector or LinearAlgebra::distributed::Vector. For the latter, all entries
+ * written to must be locally owned or ghost entries.
+ */
+template <typename VectorType>
+class ConcurrentVectorAdder : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare the type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the vector entries.
+   */
+  using value_type = typename VectorType::value_type;
+
+  static_assert(numbers::NumberTraits<value_type>::is_complex == false,
+                "This class is only implemented for real numbers.");
+
+  /**
+   * A reference to a vector entry that only allows atomic additions and
+   * subtractions.
+   */
+  class Reference
+  {
+  public:
+    /**
+     * Constructor.
+     */
+    explicit Reference(value_type &entry);
+
+    /**
+     * Atomically add @p value to the entry.
+     */
+    const Reference &
+    operator+=(const value_type value) const;
+
+    /**
+     * Atomically subtract @p value from the entry.
+     */
+    const Reference &
+    operator-=(const value_type value) const;
+
+  private:
+    /**
+     * The entry referred to.
+     */
+    value_type &entry;
+  };
+
+  /**
+   * Constructor. The object stores a pointer to @p vector, so the vector
+   * must live at least as long as this object.
+   */
+  explicit ConcurrentVectorAdder(VectorType &vector);
+
+  /**
+   * Return the size of the underlying vector.
+   */
+  size_type
+  size() const;
+
+  /**
+   * Return whether the underlying vector has ghost elements.
+   */
+  bool
+  has_ghost_elements() const;
+
+  /**
+   * Return an object through which the entry @p i can be changed atomically.
+   */
+  Reference
+  operator()(const size_type i);
+
+  /**
+   * Atomically add the given @p values to the entries given by @p indices.
+   */
+  template <typename OtherNumber>
+  void
+  add(const std::vector<size_type>   &indices,
+      const std::vector<OtherNumber> &values);
+
+  /**
+   * Atomically add the given @p values to the entries given by @p indices.
+   */
+  template <typename OtherNumber>
+  void
+  add(const std::vector<size_type> &indices, const Vector<OtherNumber> &values);
+
+private:
+  /**
+   * The vector written to.
+   */
+  ObserverPointer<VectorType, ConcurrentVectorAdder<VectorType>> vector;
+};
+
+/**
+ * @}
+ */
+
+
+/* ---------------------------- Inline functions ---------------------------- */
+
+#ifndef DOXYGEN
+
+template <typename number>
+inline ConcurrentSparseMatrixAdder<number>::ConcurrentSparseMatrixAdder(
+  SparseMatrix<number> &matrix)
+  : matrix(&matrix)
+{}
+
+
+
+template <typename number>
+inline typename ConcurrentSparseMatrixAdder<number>::size_type
+ConcurrentSparseMatrixAdder<number>::m() const
+{
+  return matrix->m();
+}
+
+
+
+template <typename number>
+inline typename ConcurrentSparseMatrixAdder<number>::size_type
+ConcurrentSparseMatrixAdder<number>::n() const
+{
+  return matrix->n();
+}
+
+
+
+template <typename number>
+inline void
+ConcurrentSparseMatrixAdder<number>::add(const size_type i,
+                                         const size_type j,
+                                         const number    value)
+{
+  AssertIsFinite(value);
+
+  // SparseMatrix::operator() checks that the entry exists
+  Kokkos::atomic_add(&(*matrix)(i, j), value);
+}
+
+
+
+template <typename number>
+template <typename number2>
+inline void
+ConcurrentSparseMatrixAdder<number>::add(
+  const size_type  row,
+  const size_type  n_cols,
+  const size_type *col_indices,
+  const number2   *values,
+  const bool       elide_zero_values,
+  const bool       col_indices_are_sorted)
+{
+  // for few or unsorted columns, search each entry separately
+  if (col_indices_are_sorted == false || n_cols <= 3)
+    {
+      for (size_type j = 0; j < n_cols; ++j)
+        if (!elide_zero_values || values[j] != number2())
+          add(row, col_indices[j], static_cast<number>(values[j]));
+      return;
+    }
+
+  // otherwise, walk through the sorted column indices and the entries of
+  // the matrix row in parallel, like SparseMatrix::add() does. for square
+  // matrices, the diagonal is stored first and the other entries of the row
+  // are sorted
+  AssertIndexRange(row, m());
+  if constexpr (running_in_debug_mode())
+    {
+      for (size_type j = 1; j < n_cols; ++j)
+        Assert(col_indices[j] > col_indices[j - 1],
+               ExcMessage(
+                 "List of indices is unsorted or contains duplicates."));
+    }
+
+  const SparsityPattern &sparsity       = matrix->get_sparsity_pattern();
+  const size_type        row_length     = sparsity.row_length(row);
+  const bool             diagonal_first = (m() == n());
+  number *const          row_values =
+    matrix->val.get() + sparsity.begin(row)->global_index();
+
+  size_type counter = diagonal_first ? 1 : 0;
+  for (size_type j = 0; j < n_cols; ++j)
+    {
+      if (elide_zero_values && values[j] == number2())
+        continue;
+
+      const size_type column = col_indices[j];
+      if (diagonal_first && column == row)
+        {
+          AssertIsFinite(values[j]);
+          Kokkos::atomic_add(&row_values[0], static_cast<number>(values[j]));
+          continue;
+        }
+
+      while (counter + 1 < row_length &&
+             sparsity.column_number(row, counter) < column)
+        ++counter;
+
+      if (counter < row_length &&
+          sparsity.column_number(row, counter) == column)
+        {
+          AssertIsFinite(values[j]);
+          Kokkos::atomic_add(&row_values[counter],
+                             static_cast<number>(values[j]));
+        }
+      else
+        Assert(values[j] == number2(),
+               typename SparseMatrix<number>::ExcInvalidIndex(row, column));
+    }
+}
+
+
+
+template <typename VectorType>
+inline ConcurrentVectorAdder<VectorType>::Reference::Reference(
+  value_type &entry)
+  : entry(entry)
+{}
+
+
+
+template <typename VectorType>
+inline const typename ConcurrentVectorAdder<VectorType>::Reference &
+ConcurrentVectorAdder<VectorType>::Reference::operator+=(
+  const value_type value) const
+{
+  AssertIsFinite(value);
+  Kokkos::atomic_add(&entry, value);
+  return *this;
+}
+
+
+
+template <typename VectorType>
+inline const typename ConcurrentVectorAdder<VectorType>::Reference &
+ConcurrentVectorAdder<VectorType>::Reference::operator-=(
+  const value_type value) const
+{
+  AssertIsFinite(value);
+  Kokkos::atomic_add(&entry, -value);
+  return *this;
+}
+
+
+
+template <typename VectorType>
+inline ConcurrentVectorAdder<VectorType>::ConcurrentVectorAdder(
+  VectorType &vector)
+  : vector(&vector)
+{}
+
+
+
+template <typename VectorType>
+inline typename ConcurrentVectorAdder<VectorType>::size_type
+ConcurrentVectorAdder<VectorType>::size() const
+{
+  return vector->size();
+}
+
+
+
+template <typename VectorType>
+inline bool
+ConcurrentVectorAdder<VectorType>::has_ghost_elements() const
+{
+  return vector->has_ghost_elements();
+}
+
+
+
+template <typename VectorType>
+inline typename ConcurrentVectorAdder<VectorType>::Reference
+ConcurrentVectorAdder<VectorType>::operator()(const size_type i)
+{
+  return Reference((*vector)(i));
+}
+
+
+
+template <typename VectorType>
+template <typename OtherNumber>
+inline void
+ConcurrentVectorAdder<VectorType>::add(const std::vector<size_type>   &indices,
+                                       const std::vector<OtherNumber> &values)
+{
+  AssertDimension(indices.size(), values.size());
+  for (size_type i = 0; i < indices.size(); ++i)
+    (*this)(indices[i]) += static_cast<value_type>(values[i]);
+}
+
+
+
+template <typename VectorType>
+template <typename OtherNumber>
+inline void
+ConcurrentVectorAdder<VectorType>::add(const std::vector<size_type> &indices,
+                                       const Vector<OtherNumber>    &values)
+{
+  AssertDimension(indices.size(), values.size());
+  for (size_type i = 0; i < indices.size(); ++i)
+    (*this)(indices[i]) += static_cast<value_type>(values[i]);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -57,6 +57,17 @@ namespace LinearAlgebra
   class ReadWriteVector;
 } // namespace LinearAlgebra
 
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    namespace VectorDataExchange
+    {
+      class Full;
+    }
+  } // namespace MatrixFreeFunctions
+} // namespace internal
+
 #  ifdef DEAL_II_WITH_PETSC
 namespace PETScWrappers
 {
@@ -249,6 +260,22 @@ namespace LinearAlgebra
      *   MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
      *                       &comm_sm);
      * @endcode
+     *
+     * By default, the shared-memory domain is also used for the ghost
+     * exchange in update_ghost_values() and compress() with
+     * VectorOperation::add: Ghost values owned by processes of the same
+     * shared-memory domain are copied directly from (and added directly
+     * into) the memory of those processes, whereas only ghost values of
+     * processes on other nodes are sent by point-to-point messages. Only the
+     * processes that actually share vector entries synchronize with each
+     * other. This applies to all vectors of type `float` and `double` in Host
+     * mode that are set up with a Utilities::MPI::Partitioner, also when no
+     * `comm_sm` argument is given, in which case a communicator of the processes on the same node is
+     * created once per partitioner. As a consequence, creating and
+     * destroying such vectors is a collective operation among the processes
+     * of a node. After a call to set_shared_memory_ghost_exchange() with
+     * argument `false`, the ghost exchange is done by point-to-point messages
+     * only, also when `comm_sm` is given.
      */
     template <typename Number, typename MemorySpace = MemorySpace::Host>
     class Vector : public ::dealii::ReadVector<Number>
@@ -1422,19 +1449,40 @@ namespace LinearAlgebra
 #ifdef DEAL_II_WITH_MPI
       /**
        * A vector that collects all requests from compress() operations.
-       * This class uses persistent MPI communicators, i.e., the communication
-       * channels are stored during successive calls to a given function. This
+       * In Host mode, this class uses persistent MPI requests, i.e., the
+       * messages are set up in the first call and only restarted in
+       * successive calls with the same communication channel. This
        * reduces the overhead involved with setting up the MPI machinery, but
        * it does not remove the need for a receive operation to be posted
-       * before the data can actually be sent.
+       * before the data can actually be sent. The requests are released in
+       * reinit() and in the destructor.
        */
       std::vector<MPI_Request> compress_requests;
 
       /**
        * A vector that collects all requests from update_ghost_values()
-       * operations. This class uses persistent MPI communicators.
+       * operations. In Host mode, this class uses persistent MPI requests.
        */
       mutable std::vector<MPI_Request> update_ghost_values_requests;
+
+      /**
+       * The communication channel the persistent requests in
+       * @p compress_requests have been set up with.
+       */
+      unsigned int compress_requests_channel = numbers::invalid_unsigned_int;
+
+      /**
+       * The communication channel the persistent requests in
+       * @p update_ghost_values_requests have been set up with.
+       */
+      mutable unsigned int update_ghost_values_requests_channel =
+        numbers::invalid_unsigned_int;
+
+      /**
+       * The MPI tag of the exchange through shared memory started last,
+       * which is used again to finish it.
+       */
+      mutable unsigned int sm_exchange_tag = 0;
 #endif
 
       /**
@@ -1451,6 +1499,16 @@ namespace LinearAlgebra
        */
       MPI_Comm comm_sm;
 
+      /**
+       * Object to exchange ghost values directly through the memory of the
+       * processes in `comm_sm` and with point-to-point messages with all
+       * other processes. This is a null pointer if the ghost values are
+       * exchanged with the functions of the partitioner only.
+       */
+      std::shared_ptr<
+        const ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::Full>
+        ghost_exchanger_sm;
+
       /**
        * A helper function that clears the compress_requests and
        * update_ghost_values_requests field. Used in reinit() functions.
@@ -1476,6 +1534,27 @@ namespace LinearAlgebra
     /** @} */
 
 
+
+    /**
+     * Select whether vectors of type Vector exchange ghost values among the
+     * processes of the same node directly through MPI-3 shared memory, see
+     * the section on shared-memory support in the documentation of the
+     * Vector class. The default is `true`. The setting affects vectors that
+     * are set up with a new partitioner after this call and must be the same
+     * on all MPI processes.
+     */
+    void
+    set_shared_memory_ghost_exchange(const bool enable);
+
+    /**
+     * Return whether vectors of type Vector exchange ghost values among the
+     * processes of the same node through MPI-3 shared memory, as set by
+     * set_shared_memory_ghost_exchange().
+     */
+    bool
+    get_shared_memory_ghost_exchange();
+
+
     /*-------------------- Inline functions ---------------------------------*/
 
 #ifndef DOXYGEN
@@ -27,6 +27,8 @@
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_operations_internal.h>
 
+#include <deal.II/matrix_free/vector_data_exchange.h>
+
 #include <memory>
 
 
@@ -39,6 +41,65 @@ namespace LinearAlgebra
   {
     namespace internal
     {
+      // The exchange of ghost values through shared memory is implemented
+      // for vectors in host memory with the number types supported by
+      // VectorDataExchange::Full.
+      template <typename Number, typename MemorySpaceType>
+      constexpr bool supports_shared_memory_ghost_exchange =
+        std::is_same_v<MemorySpaceType, ::dealii::MemorySpace::Host> &&
+        (std::is_same_v<Number, double> || std::is_same_v<Number, float>);
+
+
+
+      /**
+       * Return an object that exchanges the ghost values of vectors with the
+       * parallel layout given by @p partitioner directly through the memory
+       * of the processes in @p comm_sm and by point-to-point messages with
+       * all other processes. If @p comm_sm is MPI_COMM_SELF, a communicator
+       * of the processes on the same node is created. A null pointer is
+       * returned if the exchange through shared memory is disabled (see
+       * set_shared_memory_ghost_exchange()) or if no other process shares the
+       * memory with the present one.
+       *
+       * The result is cached for the lifetime of @p partitioner, such that
+       * all vectors with the same layout share the object. The function
+       * must be called by all processes of the communicator of
+       * @p partitioner.
+       */
+      std::shared_ptr<
+        const ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::Full>
+      get_shared_memory_ghost_exchanger(
+        const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+        const MPI_Comm                                            comm_sm);
+
+
+
+#ifdef DEAL_II_WITH_MPI
+      // Release the (persistent) MPI requests in the given vector. Nothing
+      // can be released any more once MPI has been finalized, e.g. for
+      // vectors destroyed at the end of the program.
+      inline void
+      free_mpi_requests(std::vector<MPI_Request> &requests)
+      {
+        if (requests.empty())
+          return;
+
+        int       mpi_is_finalized = 0;
+        const int ierr             = MPI_Finalized(&mpi_is_finalized);
+        AssertThrowMPI(ierr);
+        if (mpi_is_finalized == 0)
+          for (MPI_Request &request : requests)
+            if (request != MPI_REQUEST_NULL)
+              {
+                const int ierr = MPI_Request_free(&request);
+                AssertThrowMPI(ierr);
+              }
+        requests.clear();
+      }
+#endif
+
+
+
       // In the import_from_ghosted_array_finish we might need to calculate the
       // maximal and minimal value for the given number type, which is not
       // straightforward for complex numbers. Therefore, comparison of complex
@@ -510,18 +571,10 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::clear_mpi_requests()
     {
 #ifdef DEAL_II_WITH_MPI
-      for (auto &compress_request : compress_requests)
-        {
-          const int ierr = MPI_Request_free(&compress_request);
-          AssertThrowMPI(ierr);
-        }
-      compress_requests.clear();
-      for (auto &update_ghost_values_request : update_ghost_values_requests)
-        {
-          const int ierr = MPI_Request_free(&update_ghost_values_request);
-          AssertThrowMPI(ierr);
-        }
-      update_ghost_values_requests.clear();
+      internal::free_mpi_requests(compress_requests);
+      compress_requests_channel = numbers::invalid_unsigned_int;
+      internal::free_mpi_requests(update_ghost_values_requests);
+      update_ghost_values_requests_channel = numbers::invalid_unsigned_int;
 #endif
     }
 
@@ -552,6 +605,14 @@ namespace LinearAlgebra
     {
       clear_mpi_requests();
 
+      // a serial vector does not exchange data, so do not use the
+      // shared-memory domain set up for the ghost exchange
+      if (ghost_exchanger_sm != nullptr)
+        {
+          ghost_exchanger_sm.reset();
+          comm_sm = MPI_COMM_SELF;
+        }
+
       // check whether we need to reallocate
       resize_val(size, comm_sm);
 
@@ -582,6 +643,7 @@ namespace LinearAlgebra
       clear_mpi_requests();
 
       this->comm_sm = comm_sm;
+      ghost_exchanger_sm.reset();
 
       // check whether we need to reallocate
       resize_val(local_size + ghost_size, comm_sm);
@@ -618,7 +680,8 @@ namespace LinearAlgebra
       // different)
       if (partitioner.get() != v.partitioner.get())
         {
-          partitioner = v.partitioner;
+          partitioner        = v.partitioner;
+          ghost_exchanger_sm = v.ghost_exchanger_sm;
           const size_type new_allocated_size =
             partitioner->locally_owned_size() + partitioner->n_ghost_indices();
           resize_val(new_allocated_size, this->comm_sm);
@@ -683,10 +746,28 @@ namespace LinearAlgebra
       if (partitioner.get() != partitioner_in.get())
         {
           partitioner = partitioner_in;
+
+          // check whether the ghost values can be exchanged through shared
+          // memory, which also determines the communicator to allocate the
+          // memory with
+          ghost_exchanger_sm.reset();
+          if constexpr (internal::supports_shared_memory_ghost_exchange<
+                          Number,
+                          MemorySpaceType>)
+            {
+              ghost_exchanger_sm =
+                internal::get_shared_memory_ghost_exchanger(partitioner,
+                                                            comm_sm);
+              if (ghost_exchanger_sm != nullptr)
+                this->comm_sm = ghost_exchanger_sm->get_sm_mpi_communicator();
+            }
+
           const size_type new_allocated_size =
             partitioner->locally_owned_size() + partitioner->n_ghost_indices();
-          resize_val(new_allocated_size, comm_sm);
+          resize_val(new_allocated_size, this->comm_sm);
         }
+      else if (ghost_exchanger_sm != nullptr)
+        this->comm_sm = ghost_exchanger_sm->get_sm_mpi_communicator();
 
       // initialize to zero
       *this = Number();
@@ -882,6 +963,11 @@ namespace LinearAlgebra
       else
         must_update_ghost_values |= vector_is_ghosted;
 
+      // the memory of a vector that exchanges its ghost values through
+      // shared memory lives on the communicator of the exchanger
+      if (ghost_exchanger_sm != nullptr)
+        this->comm_sm = ghost_exchanger_sm->get_sm_mpi_communicator();
+
       thread_loop_partitioner = c.thread_loop_partitioner;
 
       copy_locally_owned_data_from(c);
@@ -1016,6 +1102,34 @@ namespace LinearAlgebra
             }
         }
 
+      if constexpr (internal::supports_shared_memory_ghost_exchange<
+                      Number,
+                      MemorySpaceType>)
+        if (ghost_exchanger_sm != nullptr && operation == VectorOperation::add)
+          {
+            // release the persistent requests of a previous compress with
+            // another operation
+            internal::free_mpi_requests(compress_requests);
+            compress_requests_channel = numbers::invalid_unsigned_int;
+
+            sm_exchange_tag =
+              Utilities::MPI::internal::Tags::partitioner_import_start +
+              communication_channel;
+            ghost_exchanger_sm->import_from_ghosted_array_start(
+              operation,
+              sm_exchange_tag,
+              ArrayView<const Number>(data.values.data(),
+                                      partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<Number>(import_data.values.data(),
+                                ghost_exchanger_sm->n_import_indices()),
+              compress_requests);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, dealii::MemorySpace::Default>)
         {
@@ -1046,6 +1160,14 @@ namespace LinearAlgebra
       else
 #  endif
         {
+          // the messages of the requests set up in a previous call refer to
+          // the tag of the old channel, so set them up anew on a change
+          if (compress_requests_channel != communication_channel)
+            {
+              internal::free_mpi_requests(compress_requests);
+              compress_requests_channel = communication_channel;
+            }
+
           partitioner->import_from_ghosted_array_start(
             operation,
             communication_channel,
@@ -1054,7 +1176,8 @@ namespace LinearAlgebra
               partitioner->n_ghost_indices()),
             ArrayView<Number, MemorySpaceType>(import_data.values.data(),
                                                partitioner->n_import_indices()),
-            compress_requests);
+            compress_requests,
+            std::is_same_v<MemorySpaceType, MemorySpace::Host>);
         }
 #else
       (void)communication_channel;
@@ -1078,6 +1201,38 @@ namespace LinearAlgebra
 
       // make this function thread safe
       std::lock_guard<std::mutex> lock(mutex);
+
+      if constexpr (internal::supports_shared_memory_ghost_exchange<
+                      Number,
+                      MemorySpaceType>)
+        if (ghost_exchanger_sm != nullptr && operation == VectorOperation::add)
+          {
+            ghost_exchanger_sm->import_from_ghosted_array_finish(
+              operation,
+              ArrayView<Number>(data.values.data(),
+                                partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<const Number>(import_data.values.data(),
+                                      ghost_exchanger_sm->n_import_indices()),
+              compress_requests);
+            compress_requests.clear();
+
+            // the owners of our ghost entries read and reset them directly
+            // in our memory, so we must not write into the ghost range again
+            // before they are done
+            ghost_exchanger_sm->finish_shared_memory_access(operation,
+                                                            sm_exchange_tag);
+
+            std::fill(data.values.data() + partitioner->locally_owned_size(),
+                      data.values.data() + partitioner->locally_owned_size() +
+                        partitioner->n_ghost_indices(),
+                      Number());
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1121,7 +1276,8 @@ namespace LinearAlgebra
               ArrayView<Number, MemorySpaceType>(
                 data.values.data() + partitioner->locally_owned_size(),
                 partitioner->n_ghost_indices()),
-              compress_requests);
+              compress_requests,
+              std::is_same_v<MemorySpaceType, MemorySpace::Host>);
         }
 #else
       (void)operation;
@@ -1176,6 +1332,28 @@ namespace LinearAlgebra
             }
         }
 
+      if constexpr (internal::supports_shared_memory_ghost_exchange<
+                      Number,
+                      MemorySpaceType>)
+        if (ghost_exchanger_sm != nullptr)
+          {
+            sm_exchange_tag =
+              Utilities::MPI::internal::Tags::partitioner_export_start +
+              communication_channel;
+            ghost_exchanger_sm->export_to_ghosted_array_start(
+              sm_exchange_tag,
+              ArrayView<const Number>(data.values.data(),
+                                      partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<Number>(import_data.values.data(),
+                                ghost_exchanger_sm->n_import_indices()),
+              update_ghost_values_requests);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1209,6 +1387,12 @@ namespace LinearAlgebra
       else
 #  endif
         {
+          if (update_ghost_values_requests_channel != communication_channel)
+            {
+              internal::free_mpi_requests(update_ghost_values_requests);
+              update_ghost_values_requests_channel = communication_channel;
+            }
+
           partitioner->export_to_ghosted_array_start<Number, MemorySpaceType>(
             communication_channel,
             ArrayView<const Number, MemorySpaceType>(
@@ -1218,7 +1402,8 @@ namespace LinearAlgebra
             ArrayView<Number, MemorySpaceType>(
               data.values.data() + partitioner->locally_owned_size(),
               partitioner->n_ghost_indices()),
-            update_ghost_values_requests);
+            update_ghost_values_requests,
+            std::is_same_v<MemorySpaceType, MemorySpace::Host>);
         }
 
 #else
@@ -1233,6 +1418,36 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::update_ghost_values_finish() const
     {
 #ifdef DEAL_II_WITH_MPI
+      if constexpr (internal::supports_shared_memory_ghost_exchange<
+                      Number,
+                      MemorySpaceType>)
+        if (ghost_exchanger_sm != nullptr)
+          {
+            {
+              // make this function thread safe
+              std::lock_guard<std::mutex> lock(mutex);
+
+              ghost_exchanger_sm->export_to_ghosted_array_finish(
+                ArrayView<const Number>(data.values.data(),
+                                        partitioner->locally_owned_size()),
+                data.values_sm,
+                ArrayView<Number>(data.values.data() +
+                                    partitioner->locally_owned_size(),
+                                  partitioner->n_ghost_indices()),
+                update_ghost_values_requests);
+              update_ghost_values_requests.clear();
+
+              // the ghost values are read directly from the memory of the
+              // owners, so they must not modify their entries before all
+              // processes reading from them are done
+              ghost_exchanger_sm->finish_shared_memory_access(
+                VectorOperation::insert, sm_exchange_tag);
+            }
+
+            vector_is_ghosted = true;
+            return;
+          }
+
       // wait for both sends and receives to complete, even though only
       // receives are really necessary. this gives (much) better performance
       AssertDimension(partitioner->ghost_targets().size() +
@@ -1271,7 +1486,8 @@ namespace LinearAlgebra
                 ArrayView<Number, MemorySpaceType>(
                   data.values.data() + partitioner->locally_owned_size(),
                   partitioner->n_ghost_indices()),
-                update_ghost_values_requests);
+                update_ghost_values_requests,
+                std::is_same_v<MemorySpaceType, MemorySpace::Host>);
             }
         }
 
@@ -1410,10 +1626,15 @@ namespace LinearAlgebra
 
       std::swap(compress_requests, v.compress_requests);
       std::swap(update_ghost_values_requests, v.update_ghost_values_requests);
+      std::swap(compress_requests_channel, v.compress_requests_channel);
+      std::swap(update_ghost_values_requests_channel,
+                v.update_ghost_values_requests_channel);
+      std::swap(sm_exchange_tag, v.sm_exchange_tag);
       std::swap(comm_sm, v.comm_sm);
 #endif
 
       std::swap(partitioner, v.partitioner);
+      std::swap(ghost_exchanger_sm, v.ghost_exchanger_sm);
       std::swap(thread_loop_partitioner, v.thread_loop_partitioner);
       std::swap(allocated_size, v.allocated_size);
       std::swap(data, v.data);
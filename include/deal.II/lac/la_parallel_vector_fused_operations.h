@@ -0,0 +1,149 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_la_parallel_vector_fused_operations_h
+#define dealii_la_parallel_vector_fused_operations_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector_operations_internal.h>
+
+#include <array>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    /**
+     * Perform a user-defined operation that updates several vectors and
+     * computes several global sums, such as inner products, in a single pass
+     * through memory.
+     *
+     * Most vector operations are limited by memory bandwidth. Krylov
+     * solvers typically call a sequence of functions like Vector::add(),
+     * Vector::sadd(), Vector::operator*() and Vector::l2_norm() in every
+     * iteration, each of which loads and possibly stores complete vectors.
+     * When the same operations are written as a single loop, every vector
+     * entry is transferred only once, and all sums are communicated with a
+     * single MPI_Allreduce. The function Vector::add_and_dot() is a
+     * predefined example of this technique; this function allows to express
+     * arbitrary combinations.
+     *
+     * The @p operation is called with the signature
+     * @code
+     * void operation(const types::global_dof_index begin,
+     *                const types::global_dof_index end,
+     *                std::array<VectorizedArray<Number>, n_sums> &sums);
+     * @endcode
+     * for non-overlapping ranges of the locally owned indices of @p vector,
+     * possibly in parallel. The indices are of type Vector::size_type, which
+     * is the same as types::global_dof_index. The operation must only
+     * access the entries in the range [begin, end) of the vectors it works
+     * on, which must all have the same parallel layout as @p vector, and add
+     * its contributions to the entries of @p sums, which are zero on entry.
+     * The individual lanes of the VectorizedArray objects are summed after
+     * the loop, which allows the operation to process
+     * <code>VectorizedArray<Number>::size()</code> entries at once and to
+     * accumulate the remainder into any lane.
+     *
+     * The function returns the sums over all locally owned entries of all
+     * MPI processes. The ghost values of the vectors are neither used nor
+     * updated. The result does not depend on the number of threads used.
+     *
+     * As an example, the following code fuses the updates of the solution
+     * and the residual in a conjugate gradient method with the computation of
+     * the norm of the new residual and its inner product with the
+     * preconditioned residual of the previous step:
+     * @code
+     * const std::array<double, 2> sums =
+     *   LinearAlgebra::distributed::fused_vector_operation<2>(
+     *     [&](const types::global_dof_index begin,
+     *         const types::global_dof_index end,
+     *         std::array<VectorizedArray<double>, 2> &sums) {
+     *       constexpr unsigned int n_lanes = VectorizedArray<double>::size();
+     *       const auto end_regular = begin + (end - begin) / n_lanes * n_lanes;
+     *       for (auto i = begin; i < end_regular; i += n_lanes)
+     *         {
+     *           VectorizedArray<double> xi, pi, ri, vi, zi;
+     *           xi.load(x.begin() + i);
+     *           pi.load(p.begin() + i);
+     *           xi += alpha * pi;
+     *           xi.store(x.begin() + i);
+     *           ri.load(r.begin() + i);
+     *           vi.load(v.begin() + i);
+     *           ri -= alpha * vi;
+     *           ri.store(r.begin() + i);
+     *           zi.load(z.begin() + i);
+     *           sums[0] += ri * ri;
+     *           sums[1] += ri * zi;
+     *         }
+     *       for (auto i = end_regular; i < end; ++i)
+     *         {
+     *           x.local_element(i) += alpha * p.local_element(i);
+     *           r.local_element(i) -= alpha * v.local_element(i);
+     *           sums[0][0] += r.local_element(i) * r.local_element(i);
+     *           sums[1][0] += r.local_element(i) * z.local_element(i);
+     *         }
+     *     },
+     *     r);
+     * @endcode
+     *
+     * @note This function is only implemented for vectors in host memory
+     * with real-valued entries.
+     *
+     * @relatesalso Vector
+     */
+    template <std::size_t n_sums, typename Number, typename Operation>
+    std::array<Number, n_sums>
+    fused_vector_operation(const Operation                         &operation,
+                           const Vector<Number, MemorySpace::Host> &vector);
+
+
+
+#ifndef DOXYGEN
+
+    template <std::size_t n_sums, typename Number, typename Operation>
+    std::array<Number, n_sums>
+    fused_vector_operation(const Operation                         &operation,
+                           const Vector<Number, MemorySpace::Host> &vector)
+    {
+      static_assert(numbers::NumberTraits<Number>::is_complex == false,
+                    "This function is only implemented for real numbers.");
+
+      std::array<Number, n_sums> sums = {};
+      dealii::internal::VectorOperations::parallel_fused_reduce(
+        operation, 0, vector.locally_owned_size(), sums);
+
+      if constexpr (n_sums > 0)
+        Utilities::MPI::sum(ArrayView<const Number>(sums.data(), n_sums),
+                            vector.get_mpi_communicator(),
+                            ArrayView<Number>(sums.data(), n_sums));
+
+      return sums;
+    }
+
+#endif
+
+  } // namespace distributed
+} // namespace LinearAlgebra
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
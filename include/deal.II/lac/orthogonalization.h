@@ -53,7 +53,29 @@ namespace LinearAlgebra
      * done on cached data. For these beneficial reasons, this is the default
      * algorithm in the SolverGMRES class.
      */
-    delayed_classical_gram_schmidt
+    delayed_classical_gram_schmidt,
+    /**
+     * Use an s-step Arnoldi process that first generates a block of
+     * several Krylov vectors by repeated application of the (preconditioned)
+     * operator, and then orthogonalizes the whole block at once. The block
+     * is orthogonalized against the previous basis vectors with block
+     * classical Gram-Schmidt, and within itself by a Cholesky factorization
+     * of its Gram matrix (CholQR). Both steps are repeated once for
+     * stability (BCGS2 with CholQR2, see @cite Hoemmen2010). All inner
+     * products of one such pass are computed in a single sweep through the
+     * vectors and combined with a single global reduction, so only two
+     * global reductions are needed per block, independent of the block size.
+     * This reduces the number of synchronization points compared to the
+     * other strategies, which need at least one reduction per vector.
+     *
+     * The monomial Krylov basis becomes ill-conditioned for large blocks,
+     * which is why the block size, controlled by
+     * SolverGMRES::AdditionalData::s_step_size, should be kept small. If the
+     * Cholesky factorization detects a numerically rank-deficient block,
+     * the block is automatically truncated. This strategy is currently only
+     * supported by SolverGMRES, not by SolverFGMRES.
+     */
+    s_step_cholesky_qr2
   };
 } // namespace LinearAlgebra
 
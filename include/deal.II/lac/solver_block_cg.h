@@ -0,0 +1,565 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_block_cg_h
+#define dealii_solver_block_cg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * Block conjugate gradient method for solving a symmetric positive definite
+ * linear system with several right hand sides at once, $AX=B$.
+ *
+ * Unlike the other solvers, this class interprets the blocks of a
+ * LinearAlgebra::distributed::BlockVector as the columns of a multivector:
+ * block $c$ of @p b is the $c$-th right hand side, and block $c$ of @p x the
+ * associated solution. All blocks must have the same size and parallel
+ * layout. This is the interpretation used by
+ * LinearAlgebra::distributed::BlockVector::multivector_inner_product() and
+ * LinearAlgebra::distributed::BlockVector::mmult(), which the solver uses for
+ * its vector operations.
+ *
+ * <h3>Why solve for several right hand sides at once</h3>
+ *
+ * The matrix-vector product of sparse matrices and of matrix-free operators
+ * is usually limited by the memory bandwidth for loading the matrix entries
+ * or the geometry data, not by arithmetic. Applying the operator to several
+ * vectors at once loads this data only once for all vectors, which can
+ * increase the throughput of the operator application almost by the number
+ * of vectors. To this end, the solver calls
+ * @code
+ * A.vmult(dst, src);
+ * preconditioner.vmult(dst, src);
+ * @endcode
+ * once per iteration with the complete multivectors, expecting the operator
+ * to be applied to every block independently. For a SparseMatrix, be it the
+ * matrix or the preconditioner, the solver automatically calls
+ * SparseMatrix::multivector_vmult() instead of SparseMatrix::vmult(), which
+ * would interpret the block vector as a single long vector. Matrix-free
+ * operators can process all right hand sides in a single cell loop with an
+ * FEEvaluation object with as many components as there are right hand
+ * sides, because FEEvaluation::read_dof_values() and
+ * FEEvaluation::distribute_local_to_global() map the components of a
+ * multi-component FEEvaluation to the blocks of a block vector.
+ *
+ * Besides the better throughput, the block method minimizes the error over
+ * the sum of the Krylov spaces of all right hand sides, and therefore needs
+ * fewer iterations than the conjugate gradient method applied to each right
+ * hand side separately, in particular when the right hand sides are related
+ * @cite OLeary1980.
+ *
+ * <h3>Algorithm</h3>
+ *
+ * The implementation follows the breakdown-free block conjugate gradient
+ * method by @cite Ji2017: After every iteration, the new block of search
+ * directions is orthonormalized by a Cholesky factorization of its Gram
+ * matrix, and directions that are numerically linearly dependent on the
+ * other ones are dropped. This happens when the right hand sides are linearly
+ * dependent or when some of the systems have converged faster than others,
+ * situations where the original algorithm by O'Leary breaks down. Dropped
+ * directions are represented by zero blocks, such that the number of blocks
+ * passed to the operator stays the same throughout the iteration.
+ *
+ * The convergence criterion is applied to the largest $l_2$ norm of the
+ * (unpreconditioned) residuals of all right hand sides, i.e., the solver
+ * iterates until all systems are converged. Each iteration involves four
+ * global reductions, independent of the number of right hand sides: one for
+ * the inner products of the search directions with the operator applied to
+ * them and with the residuals, one for the residual norms, one for the
+ * inner products that determine the new search directions, and one for
+ * their orthonormalization.
+ *
+ * The work in the vector operations grows with the square of the number $k$
+ * of right hand sides, compared to the linear growth of the work in the
+ * operator application. For $k$ beyond 10 to 30, depending on the cost of
+ * the operator and preconditioner, it is therefore more efficient to split
+ * the right hand sides into several groups solved one after the other.
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ */
+template <typename VectorType = LinearAlgebra::distributed::BlockVector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverBlockCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor. By default, search directions are dropped if the square
+     * of their component orthogonal to the previous directions falls below
+     * $10^{-12}$ times their squared norm.
+     */
+    explicit AdditionalData(const double rank_tolerance = 1e-12)
+      : rank_tolerance(rank_tolerance)
+    {}
+
+    /**
+     * Relative tolerance for detecting linearly dependent search directions
+     * in the Cholesky factorization of their Gram matrix.
+     */
+    double rank_tolerance;
+  };
+
+  /**
+   * Constructor.
+   */
+  SolverBlockCG(SolverControl            &cn,
+                VectorMemory<VectorType> &mem,
+                const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverBlockCG(SolverControl        &cn,
+                const AdditionalData &data = AdditionalData());
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~SolverBlockCG() override = default;
+
+  /**
+   * Solve the linear systems $AX=B$ for all blocks of @p x and @p b, which
+   * must have the same number of blocks.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+/** @} */
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverBlockCGImplementation
+  {
+    /**
+     * Apply an operator to all columns of a multivector.
+     */
+    template <typename MatrixType, typename VectorType>
+    void
+    multivector_vmult(const MatrixType &matrix,
+                      VectorType       &dst,
+                      const VectorType &src)
+    {
+      matrix.vmult(dst, src);
+    }
+
+
+
+    /**
+     * Same as above, but for a SparseMatrix, whose vmult() would treat the
+     * block vector as a single vector.
+     */
+    template <typename number, typename Number>
+    void
+    multivector_vmult(
+      const SparseMatrix<number>                            &matrix,
+      LinearAlgebra::distributed::BlockVector<Number>       &dst,
+      const LinearAlgebra::distributed::BlockVector<Number> &src)
+    {
+      matrix.multivector_vmult(dst, src);
+    }
+
+
+
+    /**
+     * Compute the $l_2$ norms of all blocks of a multivector with a single
+     * global reduction.
+     */
+    template <typename VectorType>
+    std::vector<double>
+    compute_column_norms(const VectorType &vector)
+    {
+      std::vector<double> norms(vector.n_blocks());
+      for (unsigned int c = 0; c < vector.n_blocks(); ++c)
+        {
+          const auto &column = vector.block(c);
+          for (unsigned int i = 0; i < column.locally_owned_size(); ++i)
+            norms[c] += numbers::NumberTraits<typename VectorType::value_type>::
+              abs_square(column.local_element(i));
+        }
+
+      Utilities::MPI::sum(norms, vector.block(0).get_mpi_communicator(), norms);
+      for (double &norm : norms)
+        norm = std::sqrt(norm);
+      return norms;
+    }
+
+
+
+    /**
+     * Compute the matrices of inner products $P^T Q$ and $P^T R$ between
+     * the blocks of three multivectors with a single global reduction. The
+     * former matrix is assumed to be symmetric.
+     */
+    template <typename VectorType, typename number>
+    void
+    compute_projections(const VectorType   &p,
+                        const VectorType   &q,
+                        const VectorType   &r,
+                        FullMatrix<number> &p_times_q,
+                        FullMatrix<number> &p_times_r)
+    {
+      const unsigned int n_columns = p.n_blocks();
+      const unsigned int offset    = n_columns * n_columns;
+      const unsigned int local_size =
+        n_columns > 0 ? p.block(0).locally_owned_size() : 0;
+
+      // collect the local contributions of both matrices in one array
+      std::vector<number> products(2 * offset);
+      for (unsigned int i = 0; i < n_columns; ++i)
+        {
+          const number *p_i = p.block(i).begin();
+          for (unsigned int j = 0; j < n_columns; ++j)
+            {
+              const number *q_j = q.block(j).begin();
+              const number *r_j = r.block(j).begin();
+
+              number p_q = 0., p_r = 0.;
+              if (j >= i)
+                for (unsigned int k = 0; k < local_size; ++k)
+                  {
+                    p_q += p_i[k] * q_j[k];
+                    p_r += p_i[k] * r_j[k];
+                  }
+              else
+                for (unsigned int k = 0; k < local_size; ++k)
+                  p_r += p_i[k] * r_j[k];
+
+              if (j >= i)
+                {
+                  products[i * n_columns + j] = p_q;
+                  products[j * n_columns + i] = p_q;
+                }
+              products[offset + i * n_columns + j] = p_r;
+            }
+        }
+
+      if (n_columns > 0)
+        Utilities::MPI::sum(products,
+                            p.block(0).get_mpi_communicator(),
+                            products);
+
+      for (unsigned int i = 0; i < n_columns; ++i)
+        for (unsigned int j = 0; j < n_columns; ++j)
+          {
+            p_times_q(i, j) = products[i * n_columns + j];
+            p_times_r(i, j) = products[offset + i * n_columns + j];
+          }
+    }
+
+
+
+    /**
+     * Compute the inverse of the submatrix of @p matrix given by the rows
+     * and columns with an active flag, padding the inactive rows and columns
+     * with zeros.
+     */
+    inline void
+    invert_active_submatrix(const FullMatrix<double> &matrix,
+                            const std::vector<bool>  &active,
+                            FullMatrix<double>       &inverse)
+    {
+      std::vector<unsigned int> indices;
+      for (unsigned int i = 0; i < active.size(); ++i)
+        if (active[i])
+          indices.push_back(i);
+
+      FullMatrix<double> submatrix(indices.size(), indices.size());
+      for (unsigned int i = 0; i < indices.size(); ++i)
+        for (unsigned int j = 0; j < indices.size(); ++j)
+          submatrix(i, j) = matrix(indices[i], indices[j]);
+      if (indices.size() > 0)
+        submatrix.gauss_jordan();
+
+      inverse.reinit(matrix.m(), matrix.n());
+      for (unsigned int i = 0; i < indices.size(); ++i)
+        for (unsigned int j = 0; j < indices.size(); ++j)
+          inverse(indices[i], indices[j]) = submatrix(i, j);
+    }
+
+
+
+    /**
+     * Compute an orthonormal basis @p p of the space spanned by the blocks of
+     * @p w by a Cholesky factorization of the Gram matrix of @p w. Blocks
+     * that are numerically linearly dependent on the preceding ones are
+     * skipped in the factorization, and the respective blocks of @p p are set
+     * to zero and marked as inactive. Return the number of active blocks.
+     */
+    template <typename VectorType>
+    unsigned int
+    orthonormalize(const VectorType  &w,
+                   VectorType        &p,
+                   std::vector<bool> &active,
+                   const double       rank_tolerance)
+    {
+      using number = typename VectorType::value_type;
+
+      const unsigned int n_columns = w.n_blocks();
+      FullMatrix<number> gram_matrix(n_columns, n_columns);
+      w.multivector_inner_product(gram_matrix, w, true);
+
+      FullMatrix<double> triangular(n_columns, n_columns);
+      active.assign(n_columns, false);
+      unsigned int n_active = 0;
+      for (unsigned int c = 0; c < n_columns; ++c)
+        {
+          double pivot = gram_matrix(c, c);
+          for (unsigned int l = 0; l < c; ++l)
+            if (active[l])
+              {
+                double entry = gram_matrix(l, c);
+                for (unsigned int m = 0; m < l; ++m)
+                  if (active[m])
+                    entry -= triangular(m, l) * triangular(m, c);
+                triangular(l, c) = entry / triangular(l, l);
+                pivot -= triangular(l, c) * triangular(l, c);
+              }
+
+          if (gram_matrix(c, c) > 0. &&
+              pivot > rank_tolerance * gram_matrix(c, c))
+            {
+              triangular(c, c) = std::sqrt(pivot);
+              active[c]        = true;
+              ++n_active;
+            }
+        }
+
+      // p = w R^{-1}, with zero columns for the inactive blocks
+      FullMatrix<number> inverse(n_columns, n_columns);
+      for (unsigned int c = 0; c < n_columns; ++c)
+        if (active[c])
+          {
+            inverse(c, c) = 1. / triangular(c, c);
+            for (int i = c - 1; i >= 0; --i)
+              if (active[i])
+                {
+                  double sum = 0.;
+                  for (unsigned int l = i + 1; l <= c; ++l)
+                    if (active[l])
+                      sum += triangular(i, l) * inverse(l, c);
+                  inverse(i, c) = -sum / triangular(i, i);
+                }
+          }
+      w.mmult(p, inverse, number(0.), number(1.));
+
+      return n_active;
+    }
+  } // namespace SolverBlockCGImplementation
+} // namespace internal
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverBlockCG<VectorType>::SolverBlockCG(SolverControl            &cn,
+                                         VectorMemory<VectorType> &mem,
+                                         const AdditionalData     &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverBlockCG<VectorType>::SolverBlockCG(SolverControl        &cn,
+                                         const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverBlockCG<VectorType>::solve(const MatrixType         &A,
+                                      VectorType               &x,
+                                      const VectorType         &b,
+                                      const PreconditionerType &preconditioner)
+{
+  using number = typename VectorType::value_type;
+  static_assert(numbers::NumberTraits<number>::is_complex == false,
+                "SolverBlockCG is only implemented for real numbers.");
+
+  LogStream::Prefix prefix("blockcg");
+
+  const unsigned int n_columns = b.n_blocks();
+  AssertDimension(x.n_blocks(), n_columns);
+
+  // Memory allocation
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer z_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer q_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer w_pointer(this->memory);
+
+  VectorType &r = *r_pointer;
+  VectorType &z = *z_pointer;
+  VectorType &p = *p_pointer;
+  VectorType &q = *q_pointer;
+  VectorType &w = *w_pointer;
+
+  r.reinit(x, true);
+  z.reinit(x, true);
+  p.reinit(x);
+  q.reinit(x, true);
+  w.reinit(x, true);
+
+  // R = B - AX
+  internal::SolverBlockCGImplementation::multivector_vmult(A, r, x);
+  r.sadd(-1., 1., b);
+
+  std::vector<double> residual_norms =
+    internal::SolverBlockCGImplementation::compute_column_norms(r);
+  double residual_norm =
+    *std::max_element(residual_norms.begin(), residual_norms.end());
+
+  SolverControl::State solver_state =
+    this->iteration_status(0, residual_norm, x);
+
+  // P = orth(M R)
+  std::vector<bool> active;
+  if (solver_state == SolverControl::iterate)
+    {
+      internal::SolverBlockCGImplementation::multivector_vmult(preconditioner,
+                                                               z,
+                                                               r);
+      internal::SolverBlockCGImplementation::orthonormalize(
+        z, p, active, additional_data.rank_tolerance);
+    }
+
+  // small matrices of inner products and coefficients; the latter are
+  // computed in double precision
+  FullMatrix<number> p_times_q(n_columns, n_columns);
+  FullMatrix<number> p_times_r(n_columns, n_columns);
+  FullMatrix<number> q_times_z(n_columns, n_columns);
+  FullMatrix<number> coefficients(n_columns, n_columns);
+  FullMatrix<double> inverse_p_times_q;
+  FullMatrix<double> products(n_columns, n_columns);
+  FullMatrix<double> result(n_columns, n_columns);
+
+  unsigned int it = 0;
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      // Q = AP, alpha = (P^T Q)^{-1} P^T R
+      internal::SolverBlockCGImplementation::multivector_vmult(A, q, p);
+      internal::SolverBlockCGImplementation::compute_projections(
+        p, q, r, p_times_q, p_times_r);
+
+      products.copy_from(p_times_q);
+      internal::SolverBlockCGImplementation::invert_active_submatrix(
+        products, active, inverse_p_times_q);
+      products.copy_from(p_times_r);
+      inverse_p_times_q.mmult(result, products);
+      coefficients.copy_from(result);
+
+      // X = X + P alpha, R = R - Q alpha
+      p.mmult(x, coefficients, number(1.), number(1.));
+      q.mmult(r, coefficients, number(1.), number(-1.));
+
+      residual_norms =
+        internal::SolverBlockCGImplementation::compute_column_norms(r);
+      residual_norm =
+        *std::max_element(residual_norms.begin(), residual_norms.end());
+
+      solver_state = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      // Z = M R, beta = -(P^T Q)^{-1} Q^T Z
+      internal::SolverBlockCGImplementation::multivector_vmult(preconditioner,
+                                                               z,
+                                                               r);
+      q.multivector_inner_product(q_times_z, z);
+      products.copy_from(q_times_z);
+      inverse_p_times_q.mmult(result, products);
+      result *= -1.;
+      coefficients.copy_from(result);
+
+      // P = orth(Z + P beta)
+      w = z;
+      p.mmult(w, coefficients, number(1.), number(1.));
+      const unsigned int n_active =
+        internal::SolverBlockCGImplementation::orthonormalize(
+          w, p, active, additional_data.rank_tolerance);
+
+      // all new search directions are linearly dependent on the previous
+      // ones, which means that the iteration stagnates
+      AssertThrow(n_active > 0,
+                  SolverControl::NoConvergence(it, residual_norm));
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -24,6 +24,7 @@
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/vectorization.h>
 
+#include <deal.II/lac/la_parallel_vector_fused_operations.h>
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/tridiagonal_matrix.h>
@@ -37,14 +38,6 @@ DEAL_II_NAMESPACE_OPEN
 // forward declaration
 #ifndef DOXYGEN
 class PreconditionIdentity;
-namespace LinearAlgebra
-{
-  namespace distributed
-  {
-    template <typename, typename>
-    class Vector;
-  }
-} // namespace LinearAlgebra
 #endif
 
 
@@ -553,6 +546,83 @@ namespace internal
 
   namespace SolverCG
   {
+    // Update the solution x += alpha * p and the residual r -= alpha * v,
+    // and return the l2 norm of the updated residual
+    template <typename VectorType>
+    double
+    update_solution_and_residual(const typename VectorType::value_type alpha,
+                                 const VectorType                     &p,
+                                 const VectorType                     &v,
+                                 VectorType                           &x,
+                                 VectorType                           &r)
+    {
+      x.add(alpha, p);
+      return std::sqrt(std::abs(r.add_and_dot(-alpha, v, r)));
+    }
+
+
+
+    // Specialization of the above function for host vectors of type
+    // LinearAlgebra::distributed::Vector with real entries, which performs
+    // both updates and the computation of the norm in a single pass through
+    // memory
+    template <typename Number>
+    double
+    update_solution_and_residual(
+      const Number                                                       alpha,
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &p,
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &v,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>       &x,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>       &r)
+    {
+      if constexpr (numbers::NumberTraits<Number>::is_complex)
+        {
+          x.add(alpha, p);
+          return std::sqrt(std::abs(r.add_and_dot(-alpha, v, r)));
+        }
+      else
+        {
+          const Number *p_ptr = p.begin();
+          const Number *v_ptr = v.begin();
+          Number       *x_ptr = x.begin();
+          Number       *r_ptr = r.begin();
+
+          const std::array<Number, 1> r_dot_r =
+            LinearAlgebra::distributed::fused_vector_operation<1>(
+              [&](const types::global_dof_index          begin,
+                  const types::global_dof_index          end,
+                  std::array<VectorizedArray<Number>, 1> &sums) {
+                constexpr unsigned int n_lanes =
+                  VectorizedArray<Number>::size();
+                const auto end_regular =
+                  begin + (end - begin) / n_lanes * n_lanes;
+                for (auto i = begin; i < end_regular; i += n_lanes)
+                  {
+                    VectorizedArray<Number> pi, vi, xi, ri;
+                    pi.load(p_ptr + i);
+                    xi.load(x_ptr + i);
+                    xi += alpha * pi;
+                    xi.store(x_ptr + i);
+                    vi.load(v_ptr + i);
+                    ri.load(r_ptr + i);
+                    ri -= alpha * vi;
+                    ri.store(r_ptr + i);
+                    sums[0] += ri * ri;
+                  }
+                for (auto i = end_regular; i < end; ++i)
+                  {
+                    x_ptr[i] += alpha * p_ptr[i];
+                    r_ptr[i] -= alpha * v_ptr[i];
+                    sums[0][0] += r_ptr[i] * r_ptr[i];
+                  }
+              },
+              r);
+          return std::sqrt(std::abs(r_dot_r[0]));
+        }
+    }
+
+
+
     // This base class is used to select different variants of the conjugate
     // gradient solver. The default variant is used for standard matrix and
     // preconditioner arguments, as provided by the derived class
@@ -744,17 +814,16 @@ namespace internal
         this->previous_alpha = alpha;
         alpha                = r_dot_preconditioner_dot_r / p_dot_A_dot_p;
 
-        x.add(alpha, p);
-
         // compute the residual norm with implicit residual
         if (use_default_residual)
           {
-            residual_norm = std::sqrt(std::abs(r.add_and_dot(-alpha, v, r)));
+            residual_norm = update_solution_and_residual(alpha, p, v, x, r);
           }
         // compute the residual norm with the explicit residual, i.e.
         // compute l2 norm of Ax - b.
         else
           {
+            x.add(alpha, p);
             // compute the residual conjugate gradient update
             r.add(-alpha, v);
             // compute explicit residual
@@ -178,6 +178,55 @@ namespace internal
         const boost::signals2::signal<void(int)> &reorthogonalize_signal =
           boost::signals2::signal<void(int)>());
 
+      /**
+       * Orthonormalize the @p block_size vectors at the positions
+       * <tt>n, ..., n + block_size - 1</tt> within the array
+       * @p orthogonal_vectors against the @p n orthonormal vectors with
+       * indices <tt>0, ..., n - 1</tt> and among each other, using the
+       * algorithm
+       * LinearAlgebra::OrthogonalizationStrategy::s_step_cholesky_qr2.
+       *
+       * The vectors of the block are expected to be the monomial Krylov
+       * vectors generated from the last orthonormal vector $v_{n-1}$, i.e.,
+       * $w_0 = \text{op}(v_{n-1})$ and $w_{k} = \text{op}(w_{k-1})/\sigma$
+       * for $k>0$, where op denotes the (preconditioned) matrix and $\sigma$
+       * is the value returned by get_operator_norm_estimate() before this
+       * call, or one if that value is zero. From the factors of the block
+       * orthogonalization, the function computes the columns
+       * <tt>n - 1, ..., n + block_size - 2</tt> of the Hessenberg matrix by a
+       * change of basis, without any further operation on the global vectors.
+       *
+       * If the block is found to be numerically rank-deficient, only the
+       * leading linearly independent vectors are kept. The function returns
+       * the number of vectors that have been orthonormalized, which is at
+       * least one. The Givens rotations for the new columns are not applied
+       * by this function; this is done by successive calls to
+       * transform_next_hessenberg_column().
+       */
+      template <typename VectorType>
+      unsigned int
+      orthonormalize_block(const unsigned int      n,
+                           const unsigned int      block_size,
+                           TmpVectors<VectorType> &orthogonal_vectors);
+
+      /**
+       * Transform the next column of the Hessenberg matrix, as computed by
+       * orthonormalize_block(), into upper triangular form by a Givens
+       * rotation, and return the resulting estimate of the residual in the
+       * subspace.
+       */
+      double
+      transform_next_hessenberg_column();
+
+      /**
+       * Return an estimate of the norm of the (preconditioned) operator
+       * obtained from the Hessenberg matrix, used to scale the Krylov
+       * vectors generated for orthonormalize_block(). Zero is returned
+       * before the first block has been orthonormalized.
+       */
+      double
+      get_operator_norm_estimate() const;
+
       /**
        * Using the matrix and right hand side computed during the
        * factorization, solve the underlying minimization problem for the
@@ -250,6 +299,31 @@ namespace internal
        */
       LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy;
 
+      /**
+       * Estimate of the operator norm computed from the columns of the
+       * Hessenberg matrix by orthonormalize_block().
+       */
+      double operator_norm_estimate;
+
+      /**
+       * Helper function for orthonormalize_block() that performs one pass of
+       * block classical Gram-Schmidt with Cholesky QR on the vectors at the
+       * positions <tt>n, ..., n + block_size - 1</tt>. All inner products
+       * are computed with a single global reduction. On exit, @p coefficients
+       * contains the projection coefficients onto the first @p n vectors, and
+       * @p triangular the Cholesky factor of the projected block. The
+       * factorization stops at the first column that is numerically linearly
+       * dependent on the previous ones, and the number of processed columns
+       * is returned.
+       */
+      template <typename VectorType>
+      unsigned int
+      orthogonalize_block_pass(const unsigned int      n,
+                               const unsigned int      block_size,
+                               TmpVectors<VectorType> &orthogonal_vectors,
+                               FullMatrix<double>     &coefficients,
+                               FullMatrix<double>     &triangular);
+
       /**
        * This is a helper function to perform the incremental computation of
        * the QR factorization of the Hessenberg matrix involved in the Arnoldi
@@ -319,6 +393,22 @@ namespace internal
  * case, impeding the overall performance of the solver.
  *
  *
+ * <h3>Reducing the number of global reductions</h3>
+ *
+ * In parallel computations with many MPI processes, the global reductions
+ * for the inner products in the orthogonalization often dominate the cost of
+ * an iteration. The default strategy,
+ * LinearAlgebra::OrthogonalizationStrategy::delayed_classical_gram_schmidt,
+ * needs a single reduction per iteration. With
+ * LinearAlgebra::OrthogonalizationStrategy::s_step_cholesky_qr2, the solver
+ * instead generates AdditionalData::s_step_size Krylov vectors at once and
+ * orthogonalizes them as a block with two reductions, reducing the number of
+ * synchronization points by a factor of about
+ * <tt>AdditionalData::s_step_size/2</tt>. The residual is still checked
+ * after every matrix-vector product, so the iteration counts are comparable
+ * between the strategies.
+ *
+ *
  * <h3>The size of the Arnoldi basis</h3>
  *
  * The maximal basis size is controlled by AdditionalData::max_basis_size. If
@@ -382,7 +472,8 @@ public:
                             const LinearAlgebra::OrthogonalizationStrategy
                               orthogonalization_strategy =
                                 LinearAlgebra::OrthogonalizationStrategy::
-                                  delayed_classical_gram_schmidt);
+                                  delayed_classical_gram_schmidt,
+                            const unsigned int s_step_size = 4);
 
     /**
      * Maximum number of temporary vectors. Together with max_basis_size, this
@@ -440,6 +531,17 @@ public:
      * Strategy to orthogonalize vectors.
      */
     LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy;
+
+    /**
+     * Number of Krylov vectors generated and orthogonalized together as a
+     * block when using
+     * LinearAlgebra::OrthogonalizationStrategy::s_step_cholesky_qr2. Larger
+     * values reduce the number of global reductions, which is two per block,
+     * but make the monomial Krylov basis within a block increasingly
+     * ill-conditioned. Values between 2 and 8 are typically reasonable. This
+     * variable is ignored for the other orthogonalization strategies.
+     */
+    unsigned int s_step_size;
   };
 
   /**
@@ -739,7 +841,8 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   const bool                                     use_default_residual,
   const bool                                     force_re_orthogonalization,
   const bool                                     batched_mode,
-  const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy)
+  const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy,
+  const unsigned int                             s_step_size)
   : max_n_tmp_vectors(0)
   , max_basis_size(max_basis_size)
   , right_preconditioning(right_preconditioning)
@@ -747,10 +850,14 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   , force_re_orthogonalization(force_re_orthogonalization)
   , batched_mode(batched_mode)
   , orthogonalization_strategy(orthogonalization_strategy)
+  , s_step_size(s_step_size)
 {
   Assert(max_basis_size >= 1,
          ExcMessage("SolverGMRES needs at least one vector in the "
                     "Arnoldi basis."));
+  Assert(s_step_size >= 1,
+         ExcMessage("The block size of the s-step method must be at least "
+                    "one."));
 }
 
 
@@ -1150,6 +1257,77 @@ namespace internal
 
 
 
+    template <typename VectorType,
+              std::enable_if_t<!is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_Tvmult(const unsigned int            n,
+                 const unsigned int            block_size,
+                 const TmpVectors<VectorType> &vectors,
+                 FullMatrix<double>           &products,
+                 std::vector<const typename VectorType::value_type *> &)
+    {
+      products.reinit(n + block_size, block_size);
+      for (unsigned int k = 0; k < block_size; ++k)
+        for (unsigned int i = 0; i < n + k + 1; ++i)
+          products(i, k) = vectors[i] * vectors[n + k];
+    }
+
+
+
+    // worker method for deal.II's vector types implemented in .cc file
+    template <typename Number>
+    void
+    do_block_Tvmult_add(const unsigned int                 n_vectors,
+                        const unsigned int                 block_size,
+                        const std::size_t                  locally_owned_size,
+                        const std::vector<const Number *> &vectors,
+                        Vector<double>                    &products);
+
+
+
+    template <typename VectorType,
+              std::enable_if_t<is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_Tvmult(
+      const unsigned int                                    n,
+      const unsigned int                                    block_size,
+      const TmpVectors<VectorType>                         &vectors,
+      FullMatrix<double>                                   &products,
+      std::vector<const typename VectorType::value_type *> &vector_ptrs)
+    {
+      // the products of vector n + k with the vectors 0, ..., n + k are
+      // stored contiguously, in order to communicate all of them with a
+      // single reduction
+      Vector<double> packed_products(block_size * n +
+                                     block_size * (block_size + 1) / 2);
+      for (unsigned int b = 0; b < n_blocks(vectors[0]); ++b)
+        {
+          vector_ptrs.resize(n + block_size);
+          for (unsigned int i = 0; i < n + block_size; ++i)
+            vector_ptrs[i] = block(vectors[i], b).begin();
+
+          do_block_Tvmult_add(n,
+                              block_size,
+                              block(vectors[0], b).end() -
+                                block(vectors[0], b).begin(),
+                              vector_ptrs,
+                              packed_products);
+        }
+
+      Utilities::MPI::sum(packed_products,
+                          block(vectors[0], 0).get_mpi_communicator(),
+                          packed_products);
+
+      products.reinit(n + block_size, block_size);
+      for (unsigned int k = 0, c = 0; k < block_size; ++k)
+        for (unsigned int i = 0; i < n + k + 1; ++i, ++c)
+          products(i, k) = packed_products(c);
+    }
+
+
+
     template <typename Number>
     inline void
     ArnoldiProcess<Number>::initialize(
@@ -1159,6 +1337,7 @@ namespace internal
     {
       this->orthogonalization_strategy = orthogonalization_strategy;
       this->do_reorthogonalization     = force_reorthogonalization;
+      this->operator_norm_estimate     = 0.;
 
       hessenberg_matrix.reinit(basis_size + 1, basis_size);
       triangular_matrix.reinit(basis_size + 1, basis_size, true);
@@ -1364,6 +1543,199 @@ namespace internal
 
 
 
+    template <typename Number>
+    template <typename VectorType>
+    inline unsigned int
+    ArnoldiProcess<Number>::orthogonalize_block_pass(
+      const unsigned int      n,
+      const unsigned int      block_size,
+      TmpVectors<VectorType> &orthogonal_vectors,
+      FullMatrix<double>     &coefficients,
+      FullMatrix<double>     &triangular)
+    {
+      // global reduction for the inner products of the block with the
+      // previous vectors and with itself
+      FullMatrix<double> products;
+      block_Tvmult(n, block_size, orthogonal_vectors, products, vector_ptrs);
+
+      coefficients.reinit(n, block_size);
+      triangular.reinit(block_size, block_size);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int k = 0; k < block_size; ++k)
+          coefficients(i, k) = products(i, k);
+
+      // Cholesky factorization of the Gram matrix of the block after the
+      // projection, W^T W - C^T C = R^T R. We stop at the first column whose
+      // pivot indicates a numerically linearly dependent vector, except for
+      // the first column where a zero pivot is a lucky breakdown.
+      const double tolerance = std::sqrt(
+        std::numeric_limits<typename VectorType::value_type>::epsilon());
+      unsigned int n_accepted = 0;
+      for (; n_accepted < block_size; ++n_accepted)
+        {
+          const unsigned int k = n_accepted;
+          double             pivot = 0.;
+          for (unsigned int l = 0; l <= k; ++l)
+            {
+              double entry = products(n + l, k);
+              for (unsigned int i = 0; i < n; ++i)
+                entry -= coefficients(i, l) * coefficients(i, k);
+              for (unsigned int m = 0; m < l; ++m)
+                entry -= triangular(m, l) * triangular(m, k);
+              if (l < k)
+                triangular(l, k) = entry / triangular(l, l);
+              else
+                pivot = entry;
+            }
+
+          if (k == 0 && !(pivot > 0.))
+            {
+              n_accepted = 1;
+              break;
+            }
+          else if (k > 0 && !(pivot > tolerance * products(n + k, k)))
+            break;
+
+          triangular(k, k) = std::sqrt(pivot);
+        }
+
+      // W <- (W - Q C) R^{-1}, evaluated column by column
+      for (unsigned int k = 0; k < n_accepted; ++k)
+        {
+          h.reinit(n + k);
+          for (unsigned int i = 0; i < n; ++i)
+            h(i) = -coefficients(i, k);
+          for (unsigned int l = 0; l < k; ++l)
+            h(n + l) = -triangular(l, k);
+
+          VectorType &vv = orthogonal_vectors[n + k];
+          add(vv, n + k, h, orthogonal_vectors, false, vector_ptrs);
+          if (triangular(k, k) != 0.)
+            vv /= triangular(k, k);
+        }
+
+      return n_accepted;
+    }
+
+
+
+    template <typename Number>
+    template <typename VectorType>
+    inline unsigned int
+    ArnoldiProcess<Number>::orthonormalize_block(
+      const unsigned int      n,
+      const unsigned int      block_size,
+      TmpVectors<VectorType> &orthogonal_vectors)
+    {
+      Assert(orthogonalization_strategy ==
+               LinearAlgebra::OrthogonalizationStrategy::s_step_cholesky_qr2,
+             ExcInternalError());
+      Assert(n > 0, ExcInternalError());
+      Assert(block_size > 0, ExcInternalError());
+      AssertIndexRange(n + block_size - 1, hessenberg_matrix.m());
+      AssertIndexRange(n + block_size - 1, orthogonal_vectors.size() + 1);
+      AssertDimension(givens_rotations.size(), n - 1);
+
+      const double scaling =
+        operator_norm_estimate > 0. ? operator_norm_estimate : 1.;
+
+      // Two passes of block classical Gram-Schmidt with Cholesky QR, giving
+      // W = Q (C_1 + C_2 R_1) + W_new R_2 R_1 for the original block W
+      FullMatrix<double> coefficients_1, triangular_1;
+      FullMatrix<double> coefficients_2, triangular_2;
+      unsigned int       n_accepted = orthogonalize_block_pass(
+        n, block_size, orthogonal_vectors, coefficients_1, triangular_1);
+      n_accepted = orthogonalize_block_pass(
+        n, n_accepted, orthogonal_vectors, coefficients_2, triangular_2);
+
+      // Representation of the original block in terms of the new
+      // orthonormal basis, T = [C_1 + C_2 R_1; R_2 R_1]
+      FullMatrix<double> factors(n + n_accepted, n_accepted);
+      for (unsigned int k = 0; k < n_accepted; ++k)
+        {
+          for (unsigned int i = 0; i < n; ++i)
+            {
+              double sum = coefficients_1(i, k);
+              for (unsigned int l = 0; l <= k; ++l)
+                sum += coefficients_2(i, l) * triangular_1(l, k);
+              factors(i, k) = sum;
+            }
+          for (unsigned int i = 0; i <= k; ++i)
+            {
+              double sum = 0.;
+              for (unsigned int l = i; l <= k; ++l)
+                sum += triangular_2(i, l) * triangular_1(l, k);
+              factors(n + i, k) = sum;
+            }
+        }
+
+      // The block was generated as op [v_{n-1}, w_0, ..., w_{s-2}] =
+      // [w_0, ..., w_{s-1}] diag(1, sigma, ..., sigma), where the vectors
+      // on the left are represented in the orthonormal basis by the columns
+      // of an upper triangular matrix U and the previous vectors. Together
+      // with op V = V H, we obtain the new columns of the Hessenberg matrix
+      // by a triangular solve with U.
+      double new_norm_estimate = 0.;
+      for (unsigned int k = 0; k < n_accepted; ++k)
+        {
+          const unsigned int col = n - 1 + k;
+          for (unsigned int i = 0; i <= n + k; ++i)
+            {
+              double entry = factors(i, k) * (k == 0 ? 1. : scaling);
+              if (k > 0)
+                {
+                  for (unsigned int c = 0; c < n - 1; ++c)
+                    entry -= hessenberg_matrix(i, c) * factors(c, k - 1);
+                  entry -= hessenberg_matrix(i, n - 1) * factors(n - 1, k - 1);
+                  for (unsigned int l = 1; l < k; ++l)
+                    entry -= hessenberg_matrix(i, n - 1 + l) *
+                             factors(n + l - 1, k - 1);
+                  entry /= factors(n + k - 1, k - 1);
+                }
+              hessenberg_matrix(i, col) = entry;
+            }
+          for (unsigned int i = n + k + 1; i < hessenberg_matrix.m(); ++i)
+            hessenberg_matrix(i, col) = 0.;
+
+          double norm_square = 0.;
+          for (unsigned int i = 0; i <= n + k; ++i)
+            norm_square +=
+              hessenberg_matrix(i, col) * hessenberg_matrix(i, col);
+          new_norm_estimate =
+            std::max(new_norm_estimate, std::sqrt(norm_square));
+        }
+
+      if (new_norm_estimate > 0.)
+        operator_norm_estimate = new_norm_estimate;
+
+      return n_accepted;
+    }
+
+
+
+    template <typename Number>
+    inline double
+    ArnoldiProcess<Number>::transform_next_hessenberg_column()
+    {
+      AssertIndexRange(givens_rotations.size(), hessenberg_matrix.n());
+      return do_givens_rotation(false,
+                                givens_rotations.size(),
+                                triangular_matrix,
+                                givens_rotations,
+                                projected_rhs);
+    }
+
+
+
+    template <typename Number>
+    inline double
+    ArnoldiProcess<Number>::get_operator_norm_estimate() const
+    {
+      return operator_norm_estimate;
+    }
+
+
+
     template <typename Number>
     inline double
     ArnoldiProcess<Number>::do_givens_rotation(
@@ -1634,6 +2006,12 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
   // residual as stopping criterion.
   const bool use_default_residual = additional_data.use_default_residual;
 
+  // switch to determine whether the Krylov vectors are generated and
+  // orthogonalized in blocks
+  const bool s_step_orthogonalization =
+    additional_data.orthogonalization_strategy ==
+    LinearAlgebra::OrthogonalizationStrategy::s_step_cholesky_qr2;
+
   // define an alias
   VectorType &p = basis_vectors(basis_size + 1, x);
 
@@ -1734,30 +2112,79 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
       // inner iteration doing at most as many steps as the size of the
       // Arnoldi basis
       unsigned int inner_iteration = 0;
+
+      // for the s-step variant: first column of the Hessenberg matrix that
+      // has not been computed by a block orthogonalization yet
+      unsigned int end_of_block = 0;
+
       for (; (inner_iteration < basis_size &&
               iteration_state == SolverControl::iterate);
            ++inner_iteration)
         {
           ++accumulated_iterations;
-          // yet another alias
-          VectorType &vv = basis_vectors(inner_iteration + 1, x);
 
-          if (left_precondition)
+          if (s_step_orthogonalization)
             {
-              A.vmult(p, basis_vectors[inner_iteration]);
-              preconditioner.vmult(vv, p);
+              if (inner_iteration == end_of_block)
+                {
+                  // generate the next block of Krylov vectors; as long as no
+                  // estimate of the operator norm for scaling the monomial
+                  // basis is available, use a block with a single vector
+                  const double scaling =
+                    arnoldi_process.get_operator_norm_estimate();
+                  const unsigned int block_size =
+                    scaling > 0. ? std::min(additional_data.s_step_size,
+                                            basis_size - inner_iteration) :
+                                   1;
+                  for (unsigned int k = 0; k < block_size; ++k)
+                    {
+                      VectorType &vv =
+                        basis_vectors(inner_iteration + 1 + k, x);
+                      if (left_precondition)
+                        {
+                          A.vmult(p, basis_vectors[inner_iteration + k]);
+                          preconditioner.vmult(vv, p);
+                        }
+                      else
+                        {
+                          preconditioner.vmult(
+                            p, basis_vectors[inner_iteration + k]);
+                          A.vmult(vv, p);
+                        }
+                      if (k > 0)
+                        vv /= scaling;
+                    }
+
+                  end_of_block +=
+                    arnoldi_process.orthonormalize_block(inner_iteration + 1,
+                                                         block_size,
+                                                         basis_vectors);
+                }
+
+              res = arnoldi_process.transform_next_hessenberg_column();
             }
           else
             {
-              preconditioner.vmult(p, basis_vectors[inner_iteration]);
-              A.vmult(vv, p);
-            }
+              // yet another alias
+              VectorType &vv = basis_vectors(inner_iteration + 1, x);
 
-          res =
-            arnoldi_process.orthonormalize_nth_vector(inner_iteration + 1,
-                                                      basis_vectors,
-                                                      accumulated_iterations,
-                                                      re_orthogonalize_signal);
+              if (left_precondition)
+                {
+                  A.vmult(p, basis_vectors[inner_iteration]);
+                  preconditioner.vmult(vv, p);
+                }
+              else
+                {
+                  preconditioner.vmult(p, basis_vectors[inner_iteration]);
+                  A.vmult(vv, p);
+                }
+
+              res = arnoldi_process.orthonormalize_nth_vector(
+                inner_iteration + 1,
+                basis_vectors,
+                accumulated_iterations,
+                re_orthogonalize_signal);
+            }
 
           if (use_default_residual)
             {
@@ -2011,6 +2438,11 @@ void SolverFGMRES<VectorType>::solve(const MatrixType         &A,
   // restart
   unsigned int accumulated_iterations = 0;
 
+  AssertThrow(additional_data.orthogonalization_strategy !=
+                LinearAlgebra::OrthogonalizationStrategy::s_step_cholesky_qr2,
+              ExcMessage("The s-step orthogonalization strategy is not "
+                         "supported by SolverFGMRES."));
+
   // matrix used for the orthogonalization process later
   arnoldi_process.initialize(additional_data.orthogonalization_strategy,
                              basis_size,
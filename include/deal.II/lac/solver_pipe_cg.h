@@ -0,0 +1,530 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_pipe_cg_h
+#define dealii_solver_pipe_cg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/template_constraints.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/la_parallel_vector_fused_operations.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <array>
+#include <cmath>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * Pipelined preconditioned conjugate gradient method for symmetric positive
+ * definite matrices, following the algorithm by @cite Ghysels2014.
+ *
+ * In the standard conjugate gradient method implemented by SolverCG, each
+ * iteration contains two global reductions (the inner products that
+ * determine the step length and the new search direction) that depend on
+ * the preceding matrix-vector product and preconditioner application. On
+ * large parallel machines, the latency of the associated MPI_Allreduce
+ * operations can dominate the run time once the local work per process
+ * becomes small. The pipelined variant reformulates the recurrences with
+ * additional auxiliary vectors such that all inner products of an iteration
+ * are combined into a single reduction that is independent of the
+ * preconditioner application and matrix-vector product of the same
+ * iteration. For vectors of type LinearAlgebra::distributed::Vector, the
+ * reduction is started with a non-blocking MPI_Iallreduce and completes
+ * while the preconditioner and the matrix are applied, hiding its latency.
+ * For these vectors, all vector updates and local inner products of an
+ * iteration are furthermore done in a single pass through memory, using
+ * internal::VectorOperations::parallel_fused_reduce(), the loop engine that
+ * also underlies LinearAlgebra::distributed::fused_vector_operation(). For
+ * other vector types, the algorithm is run with the usual vector operations
+ * and blocking reductions.
+ *
+ * The price for the communication hiding is that the method needs nine
+ * auxiliary vectors, five more than SolverCG, and that the recurrences are
+ * slightly less stable with respect to round-off errors. Therefore, the
+ * attainable accuracy is somewhat lower than for SolverCG, which is mostly
+ * relevant for very strict tolerances. Like SolverCG, the stopping criterion uses the
+ * $l_2$ norm of the recursively updated (unpreconditioned) residual, which
+ * is computed within the reduction of the respective iteration.
+ *
+ * For each iteration, the method performs one matrix-vector product and one
+ * preconditioner application. The matrix-vector product of the iteration in
+ * which convergence is detected is not needed by the algorithm, but is
+ * already started to overlap with the reduction.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ */
+template <typename VectorType = Vector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverPipeCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver. This
+   * solver does not need additional data yet.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverPipeCG(SolverControl            &cn,
+               VectorMemory<VectorType> &mem,
+               const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverPipeCG(SolverControl        &cn,
+               const AdditionalData &data = AdditionalData());
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~SolverPipeCG() override = default;
+
+  /**
+   * Solve the linear system $Ax=b$ for x.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+};
+
+/** @} */
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverPipeCGImplementation
+  {
+    /**
+     * Sum up the given local values over all processes of a communicator
+     * with a non-blocking reduction. The result can be accessed after
+     * calling wait().
+     */
+    template <typename Number, std::size_t n_sums>
+    class NonBlockingSum
+    {
+    public:
+      /**
+       * Destructor. Wait for an outstanding reduction, e.g. when the solver
+       * exits with an exception.
+       */
+      ~NonBlockingSum()
+      {
+#  ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          MPI_Wait(&request, MPI_STATUS_IGNORE);
+#  endif
+      }
+
+      /**
+       * Start the reduction of the given values.
+       */
+      void
+      start(const std::array<Number, n_sums> &local_values,
+            const MPI_Comm                    communicator)
+      {
+        values = local_values;
+#  ifdef DEAL_II_WITH_MPI
+        Assert(request == MPI_REQUEST_NULL,
+               ExcMessage("The previous reduction has not been completed."));
+        if (Utilities::MPI::job_supports_mpi())
+          {
+            const int ierr =
+              MPI_Iallreduce(MPI_IN_PLACE,
+                             values.data(),
+                             static_cast<int>(n_sums),
+                             Utilities::MPI::mpi_type_id_for_type<Number>,
+                             MPI_SUM,
+                             communicator,
+                             &request);
+            AssertThrowMPI(ierr);
+          }
+#  else
+        (void)communicator;
+#  endif
+      }
+
+      /**
+       * Wait for the reduction to complete and return the summed values.
+       */
+      const std::array<Number, n_sums> &
+      wait()
+      {
+#  ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
+#  endif
+        return values;
+      }
+
+    private:
+      std::array<Number, n_sums> values;
+
+#  ifdef DEAL_II_WITH_MPI
+      MPI_Request request = MPI_REQUEST_NULL;
+#  endif
+    };
+
+
+
+    /**
+     * Compute the local contributions to the inner products $r^T u$,
+     * $w^T u$ and $r^T r$ of the pipelined CG method.
+     */
+    template <typename Number>
+    std::array<Number, 3>
+    compute_local_sums(const Number                 *r,
+                       const Number                 *u,
+                       const Number                 *w,
+                       const types::global_dof_index local_size)
+    {
+      std::array<Number, 3> sums = {};
+      dealii::internal::VectorOperations::parallel_fused_reduce(
+        [&](const types::global_dof_index          begin,
+            const types::global_dof_index          end,
+            std::array<VectorizedArray<Number>, 3> &my_sums) {
+          constexpr unsigned int n_lanes = VectorizedArray<Number>::size();
+          const auto end_regular = begin + (end - begin) / n_lanes * n_lanes;
+          for (auto i = begin; i < end_regular; i += n_lanes)
+            {
+              VectorizedArray<Number> ri, ui, wi;
+              ri.load(r + i);
+              ui.load(u + i);
+              wi.load(w + i);
+              my_sums[0] += ri * ui;
+              my_sums[1] += wi * ui;
+              my_sums[2] += ri * ri;
+            }
+          for (auto i = end_regular; i < end; ++i)
+            {
+              my_sums[0][0] += r[i] * u[i];
+              my_sums[1][0] += w[i] * u[i];
+              my_sums[2][0] += r[i] * r[i];
+            }
+        },
+        0,
+        local_size,
+        sums);
+      return sums;
+    }
+
+
+
+    /**
+     * Perform the vector updates of one iteration of the pipelined CG
+     * method in a single loop and return the local contributions to the
+     * inner products $r^T u$, $w^T u$ and $r^T r$ of the updated vectors.
+     */
+    template <typename Number>
+    std::array<Number, 3>
+    update_and_compute_local_sums(
+      const Number                                      alpha,
+      const Number                                      beta,
+      const LinearAlgebra::distributed::Vector<Number> &m_vector,
+      const LinearAlgebra::distributed::Vector<Number> &n_vector,
+      LinearAlgebra::distributed::Vector<Number>       &x_vector,
+      LinearAlgebra::distributed::Vector<Number>       &r_vector,
+      LinearAlgebra::distributed::Vector<Number>       &u_vector,
+      LinearAlgebra::distributed::Vector<Number>       &w_vector,
+      LinearAlgebra::distributed::Vector<Number>       &z_vector,
+      LinearAlgebra::distributed::Vector<Number>       &q_vector,
+      LinearAlgebra::distributed::Vector<Number>       &s_vector,
+      LinearAlgebra::distributed::Vector<Number>       &p_vector)
+    {
+      const Number *m_ptr = m_vector.begin();
+      const Number *n_ptr = n_vector.begin();
+      Number       *x     = x_vector.begin();
+      Number       *r     = r_vector.begin();
+      Number       *u     = u_vector.begin();
+      Number       *w     = w_vector.begin();
+      Number       *z     = z_vector.begin();
+      Number       *q     = q_vector.begin();
+      Number       *s     = s_vector.begin();
+      Number       *p     = p_vector.begin();
+
+      std::array<Number, 3> sums = {};
+      dealii::internal::VectorOperations::parallel_fused_reduce(
+        [&](const types::global_dof_index          begin,
+            const types::global_dof_index          end,
+            std::array<VectorizedArray<Number>, 3> &my_sums) {
+          constexpr unsigned int n_lanes = VectorizedArray<Number>::size();
+          const auto end_regular = begin + (end - begin) / n_lanes * n_lanes;
+          for (auto i = begin; i < end_regular; i += n_lanes)
+            {
+              VectorizedArray<Number> zi, qi, si, pi, tmp;
+              zi.load(z + i);
+              tmp.load(n_ptr + i);
+              zi = tmp + beta * zi;
+              zi.store(z + i);
+              qi.load(q + i);
+              tmp.load(m_ptr + i);
+              qi = tmp + beta * qi;
+              qi.store(q + i);
+
+              VectorizedArray<Number> wi, ui, ri, xi;
+              si.load(s + i);
+              wi.load(w + i);
+              si = wi + beta * si;
+              si.store(s + i);
+              pi.load(p + i);
+              ui.load(u + i);
+              pi = ui + beta * pi;
+              pi.store(p + i);
+
+              xi.load(x + i);
+              xi += alpha * pi;
+              xi.store(x + i);
+              ri.load(r + i);
+              ri -= alpha * si;
+              ri.store(r + i);
+              ui -= alpha * qi;
+              ui.store(u + i);
+              wi -= alpha * zi;
+              wi.store(w + i);
+
+              my_sums[0] += ri * ui;
+              my_sums[1] += wi * ui;
+              my_sums[2] += ri * ri;
+            }
+          for (auto i = end_regular; i < end; ++i)
+            {
+              z[i] = n_ptr[i] + beta * z[i];
+              q[i] = m_ptr[i] + beta * q[i];
+              s[i] = w[i] + beta * s[i];
+              p[i] = u[i] + beta * p[i];
+              x[i] += alpha * p[i];
+              r[i] -= alpha * s[i];
+              u[i] -= alpha * q[i];
+              w[i] -= alpha * z[i];
+
+              my_sums[0][0] += r[i] * u[i];
+              my_sums[1][0] += w[i] * u[i];
+              my_sums[2][0] += r[i] * r[i];
+            }
+        },
+        0,
+        m_vector.locally_owned_size(),
+        sums);
+      return sums;
+    }
+
+
+
+    /**
+     * Return whether the vector updates and the reductions can be fused and
+     * overlapped for the given vector type.
+     */
+    template <typename VectorType>
+    constexpr bool
+    use_pipelined_reductions()
+    {
+      using Number = typename VectorType::value_type;
+      return std::is_same_v<
+               VectorType,
+               LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>> &&
+             (numbers::NumberTraits<Number>::is_complex == false);
+    }
+  } // namespace SolverPipeCGImplementation
+} // namespace internal
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipeCG<VectorType>::SolverPipeCG(SolverControl            &cn,
+                                       VectorMemory<VectorType> &mem,
+                                       const AdditionalData &)
+  : SolverBase<VectorType>(cn, mem)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipeCG<VectorType>::SolverPipeCG(SolverControl &cn,
+                                       const AdditionalData &)
+  : SolverBase<VectorType>(cn)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverPipeCG<VectorType>::solve(const MatrixType         &A,
+                                     VectorType               &x,
+                                     const VectorType         &b,
+                                     const PreconditionerType &preconditioner)
+{
+  using number = typename VectorType::value_type;
+
+  constexpr bool pipelined =
+    internal::SolverPipeCGImplementation::use_pipelined_reductions<
+      VectorType>();
+
+  LogStream::Prefix prefix("pipecg");
+
+  // Memory allocation
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer u_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer w_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer m_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer n_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer z_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer q_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer s_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+
+  // define some aliases for simpler access, using the names of the
+  // algorithm in the paper by Ghysels and Vanroose
+  VectorType &r = *r_pointer;
+  VectorType &u = *u_pointer;
+  VectorType &w = *w_pointer;
+  VectorType &m = *m_pointer;
+  VectorType &n = *n_pointer;
+  VectorType &z = *z_pointer;
+  VectorType &q = *q_pointer;
+  VectorType &s = *s_pointer;
+  VectorType &p = *p_pointer;
+
+  // the vectors z, q, s, p are multiplied by beta=0 in the first iteration
+  // and must therefore not contain uninitialized values
+  r.reinit(x, true);
+  u.reinit(x, true);
+  w.reinit(x, true);
+  m.reinit(x, true);
+  n.reinit(x, true);
+  z.reinit(x);
+  q.reinit(x);
+  s.reinit(x);
+  p.reinit(x);
+
+  // r = b - Ax, u = Pr, w = Au
+  A.vmult(r, x);
+  r.sadd(-1., 1., b);
+  preconditioner.vmult(u, r);
+  A.vmult(w, u);
+
+  internal::SolverPipeCGImplementation::NonBlockingSum<number, 3> reduction;
+  std::array<number, 3>                                           sums = {};
+  if constexpr (pipelined)
+    reduction.start(internal::SolverPipeCGImplementation::compute_local_sums(
+                      r.begin(), u.begin(), w.begin(), r.locally_owned_size()),
+                    r.get_mpi_communicator());
+  else
+    sums = {{r * u, w * u, r.norm_sqr()}};
+
+  SolverControl::State solver_state  = SolverControl::iterate;
+  double               residual_norm = 0.;
+  number               alpha = 0., gamma_old = 0.;
+  unsigned int         it = 0;
+  for (;; ++it)
+    {
+      // compute m = Pw and n = Am. these operations do not depend on the
+      // inner products, so they overlap with the reduction
+      preconditioner.vmult(m, w);
+      A.vmult(n, m);
+
+      if constexpr (pipelined)
+        sums = reduction.wait();
+
+      const number gamma = sums[0];
+      const number delta = sums[1];
+      residual_norm      = std::sqrt(std::abs(sums[2]));
+
+      solver_state = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      number beta = 0.;
+      if (it == 0)
+        {
+          Assert(std::abs(delta) != 0., ExcDivideByZero());
+          alpha = gamma / delta;
+        }
+      else
+        {
+          beta                     = gamma / gamma_old;
+          const number denominator = delta - beta * gamma / alpha;
+          Assert(std::abs(denominator) != 0., ExcDivideByZero());
+          alpha = gamma / denominator;
+        }
+      gamma_old = gamma;
+
+      // z = n + beta z, q = m + beta q, s = w + beta s, p = u + beta p,
+      // x = x + alpha p, r = r - alpha s, u = u - alpha q, w = w - alpha z
+      if constexpr (pipelined)
+        reduction.start(
+          internal::SolverPipeCGImplementation::update_and_compute_local_sums(
+            alpha, beta, m, n, x, r, u, w, z, q, s, p),
+          r.get_mpi_communicator());
+      else
+        {
+          z.sadd(beta, 1., n);
+          q.sadd(beta, 1., m);
+          s.sadd(beta, 1., w);
+          p.sadd(beta, 1., u);
+          x.add(alpha, p);
+          r.add(-alpha, s);
+          u.add(-alpha, q);
+          w.add(-alpha, z);
+          sums = {{r * u, w * u, r.norm_sqr()}};
+        }
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
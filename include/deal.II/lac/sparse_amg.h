@@ -0,0 +1,382 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_amg_h
+#define dealii_sparse_amg_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/observer_pointer.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sparse_direct.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Preconditioners
+ * @{
+ */
+
+/**
+ * An algebraic multigrid preconditioner for matrices of type
+ * SparseMatrix<double> based on smoothed aggregation, which does not need any
+ * external library. It is meant for symmetric positive definite matrices
+ * stemming from scalar elliptic problems, in particular in cases where no
+ * mesh hierarchy for geometric multigrid is available, and serves the same
+ * purpose as TrilinosWrappers::PreconditionAMG for programs that are run on
+ * a single process.
+ *
+ * <h3>Setup of the hierarchy</h3>
+ *
+ * The levels of the hierarchy are created by the initialize() function,
+ * starting from the given matrix, according to the smoothed aggregation
+ * method by Vaněk, Mandel, and Brezina:
+ * <ol>
+ * <li> The unknowns $i$ and $j$ are called strongly coupled if
+ * $|a_{ij}| > \theta \sqrt{|a_{ii} a_{jj}|}$, where $\theta$ is given by
+ * AdditionalData::aggregation_threshold.
+ * <li> The unknowns are grouped into aggregates, i.e., disjoint sets of
+ * strongly coupled unknowns. In a first pass, every unknown whose strongly
+ * coupled neighbors all do not belong to an aggregate yet forms a new
+ * aggregate together with these neighbors. Then, the remaining unknowns join
+ * an aggregate of a strongly coupled neighbor, or form new aggregates with
+ * their remaining neighbors. Unknowns without strong couplings, such as the
+ * rows of Dirichlet boundary conditions, are left to the smoother.
+ * <li> The tentative prolongator $T$ interpolates the constant function on
+ * each aggregate, with the columns scaled to unit length. Consequently,
+ * constant functions are represented exactly on the coarse levels, which
+ * is the appropriate near null space for scalar problems.
+ * <li> The prolongator is smoothed by a damped Jacobi step,
+ * $P = (I - \omega D^{-1} A) T$, with $\omega = \frac{4}{3}
+ * \lambda_\text{max}^{-1}$, where $\lambda_\text{max}$ is the largest
+ * eigenvalue of $D^{-1}A$ as estimated for the Chebyshev smoother of the
+ * level, possibly scaled by AdditionalData::prolongator_damping.
+ * <li> The matrix of the next coarser level is computed by the Galerkin
+ * product $A_\text{c} = P^T A P$.
+ * </ol>
+ * The coarsening stops when the size of the matrix falls below
+ * AdditionalData::max_coarse_size, when AdditionalData::max_levels levels
+ * have been created, or when aggregation does not reduce the size any
+ * further. The matrix on the coarsest level is factorized with
+ * SparseDirectUMFPACK, which requires deal.II to be configured with UMFPACK
+ * (the default, since UMFPACK is bundled with deal.II). Without UMFPACK, the
+ * coarsest level is solved approximately by a Chebyshev iteration whose
+ * degree is chosen from the eigenvalue estimates to reduce the error by ten
+ * orders of magnitude; this keeps the preconditioner linear and symmetric,
+ * but is only efficient for well-conditioned coarse matrices.
+ *
+ * Except for the aggregation, which is inherently sequential but only needs
+ * a single pass over the matrix entries, all steps of the setup are run in
+ * parallel on the available threads: The sparse matrix-matrix products
+ * first determine the sparsity pattern of every row with a
+ * SparsityPatternBuilder and then compute the entries row by row.
+ *
+ * <h3>Application</h3>
+ *
+ * The vmult() function performs a given number of V-cycles with a zero
+ * initial guess, with Chebyshev smoothing (see PreconditionChebyshev) before
+ * and after the coarse-grid correction on every level. The same smoother is
+ * used for pre- and post-smoothing, so the preconditioner is symmetric and
+ * can be used within SolverCG. The matrix-vector products with the level
+ * matrices, the prolongation, and the restriction use the threaded
+ * SparseMatrix::vmult().
+ *
+ * A typical use is:
+ * @code
+ * SparseAMG amg;
+ * amg.initialize(system_matrix);
+ *
+ * SolverControl            solver_control(1000, 1e-12);
+ * SolverCG<Vector<double>> solver(solver_control);
+ * solver.solve(system_matrix, solution, system_rhs, amg);
+ * @endcode
+ *
+ * The object stores a pointer to the matrix passed to initialize() for the
+ * finest level, so the matrix must be kept alive as long as the
+ * preconditioner is used. The vmult() function uses internal temporary
+ * vectors and can therefore not be called from several threads at the same
+ * time.
+ */
+class SparseAMG : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare the type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * The type of the smoother used on the levels.
+   */
+  using SmootherType = PreconditionChebyshev<SparseMatrix<double>,
+                                             Vector<double>,
+                                             DiagonalMatrix<Vector<double>>>;
+
+  /**
+   * Parameters to control the setup of the hierarchy and the cycle.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor. The default values work well for the Laplace equation
+     * discretized by low-order finite elements.
+     */
+    AdditionalData(const double       aggregation_threshold    = 0.08,
+                   const double       prolongator_damping      = 1.,
+                   const unsigned int smoother_degree          = 2,
+                   const double       smoother_smoothing_range = 20.,
+                   const unsigned int max_coarse_size          = 2000,
+                   const unsigned int max_levels               = 20,
+                   const unsigned int n_cycles                 = 1);
+
+    /**
+     * The threshold $\theta$ for the strength of couplings between unknowns
+     * used during aggregation. Larger values create smaller aggregates and
+     * thus more levels with more expensive coarse matrices.
+     */
+    double aggregation_threshold;
+
+    /**
+     * Factor scaling the damping parameter $\omega = \frac{4}{3}
+     * \lambda_\text{max}^{-1}$ of the Jacobi step that smooths the tentative
+     * prolongator. A value of zero uses the tentative prolongator (plain
+     * aggregation).
+     */
+    double prolongator_damping;
+
+    /**
+     * The degree of the Chebyshev smoother on each level, see
+     * PreconditionChebyshev::AdditionalData::degree.
+     */
+    unsigned int smoother_degree;
+
+    /**
+     * The range of eigenvalues the Chebyshev smoother acts on, see
+     * PreconditionChebyshev::AdditionalData::smoothing_range.
+     */
+    double smoother_smoothing_range;
+
+    /**
+     * Matrices with at most this many rows are not coarsened any further
+     * but solved with a direct solver.
+     */
+    unsigned int max_coarse_size;
+
+    /**
+     * The maximal number of levels of the hierarchy, including the finest
+     * one.
+     */
+    unsigned int max_levels;
+
+    /**
+     * The number of V-cycles performed in each call to vmult().
+     */
+    unsigned int n_cycles;
+  };
+
+  /**
+   * Constructor. The object needs to be set up with initialize() before it
+   * can be used.
+   */
+  SparseAMG() = default;
+
+  /**
+   * Set up the multigrid hierarchy for the given @p matrix. Previous content
+   * of this object is lost.
+   */
+  void
+  initialize(const SparseMatrix<double> &matrix,
+             const AdditionalData       &additional_data = AdditionalData());
+
+  /**
+   * Release all memory and return to the state directly after the
+   * constructor was called.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the preconditioner, i.e., perform AdditionalData::n_cycles
+   * V-cycles for the system with right hand side @p src and a zero initial
+   * guess.
+   */
+  void
+  vmult(Vector<double> &dst, const Vector<double> &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner. Since the V-cycle is
+   * symmetric, this is the same as vmult().
+   */
+  void
+  Tvmult(Vector<double> &dst, const Vector<double> &src) const;
+
+  /**
+   * Return the number of levels of the hierarchy, including the finest
+   * level given to initialize() and the coarsest level that is solved
+   * directly.
+   */
+  unsigned int
+  n_levels() const;
+
+  /**
+   * Return the matrix on the given @p level, where level zero is the matrix
+   * given to initialize().
+   */
+  const SparseMatrix<double> &
+  get_matrix(const unsigned int level) const;
+
+  /**
+   * Return the prolongator from the given @p level to the next finer one,
+   * i.e., from level @p level to level <code>level-1</code>.
+   */
+  const SparseMatrix<double> &
+  get_prolongator(const unsigned int level) const;
+
+  /**
+   * Return the operator complexity of the hierarchy, i.e., the sum of the
+   * number of nonzero entries of the matrices on all levels divided by the
+   * number of nonzero entries of the matrix on the finest level.
+   */
+  double
+  operator_complexity() const;
+
+  /**
+   * Return the dimension of the codomain (or range) space. Note that the
+   * matrix is of dimension $m \times m$.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the dimension of the domain space. Note that the matrix is of
+   * dimension $n \times n$.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcNotInitialized,
+                   "The preconditioner has not been set up. Call "
+                   "initialize() before using it.");
+
+  /**
+   * Exception
+   */
+  DeclException1(ExcZeroDiagonal,
+                 size_type,
+                 << "The diagonal entry in row " << arg1
+                 << " of the matrix is zero, but algebraic multigrid needs "
+                 << "nonzero diagonal entries for the smoother and for the "
+                 << "strength of couplings.");
+
+private:
+  /**
+   * The data stored on each level of the hierarchy. The matrix of the
+   * finest level is not stored but referenced by @p fine_matrix.
+   */
+  struct Level
+  {
+    /**
+     * The sparsity pattern and the matrix of this level, unless this is the
+     * finest level.
+     */
+    SparsityPattern      sparsity_pattern;
+    SparseMatrix<double> matrix;
+
+    /**
+     * The sparsity patterns and the matrices of the prolongation from the
+     * next coarser level to this one and of the restriction, i.e., the
+     * transpose of the prolongation. Empty on the coarsest level.
+     */
+    SparsityPattern      prolongation_sparsity;
+    SparseMatrix<double> prolongation;
+    SparsityPattern      restriction_sparsity;
+    SparseMatrix<double> restriction;
+
+    /**
+     * The smoother of this level. On the coarsest level, it is only used as
+     * the coarse solver if deal.II is configured without UMFPACK.
+     */
+    SmootherType smoother;
+
+    /**
+     * Temporary vectors for the residual on this level, and for the right
+     * hand side and the solution on the next coarser level.
+     */
+    mutable Vector<double> residual;
+    mutable Vector<double> coarse_rhs;
+    mutable Vector<double> coarse_solution;
+  };
+
+  /**
+   * Return the matrix on the given level.
+   */
+  const SparseMatrix<double> &
+  level_matrix(const unsigned int level) const;
+
+  /**
+   * Perform one V-cycle on the given @p level, starting with a zero vector
+   * in @p dst.
+   */
+  void
+  v_cycle(const unsigned int    level,
+          Vector<double>       &dst,
+          const Vector<double> &src) const;
+
+  /**
+   * A pointer to the matrix of the finest level.
+   */
+  ObserverPointer<const SparseMatrix<double>, SparseAMG> fine_matrix;
+
+  /**
+   * The levels of the hierarchy. The entries are stored by pointer because
+   * matrices keep pointers to their sparsity patterns.
+   */
+  std::vector<std::unique_ptr<Level>> levels;
+
+  /**
+   * The direct solver on the coarsest level. Only used if deal.II is
+   * configured with UMFPACK.
+   */
+  std::unique_ptr<SparseDirectUMFPACK> coarse_solver;
+
+  /**
+   * The number of V-cycles in each call to vmult().
+   */
+  unsigned int n_cycles = 1;
+};
+
+/** @} */
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
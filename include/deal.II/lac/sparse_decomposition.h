@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/lac/sparse_matrix.h>
 
 #include <cmath>
@@ -93,6 +95,15 @@ DEAL_II_NAMESPACE_OPEN
  * <code>*use_this_sparsity</code> is used to store the decomposed matrix. For
  * restrictions on the sparsity see section `Fill-in' above).
  *
+ * 5/ By setting <code>use_level_scheduling=true</code>, the rows of the
+ * factors are grouped into levels of mutually independent rows during
+ * initialize(). The factorization and the forward and backward substitutions
+ * in vmult() are then performed one level after the other, with the rows
+ * within each sufficiently large level processed in parallel. Since every
+ * row is still computed with the same sequence of arithmetic operations, the
+ * results are identical to those of the sequential algorithm. The default is
+ * <code>false</code>.
+ *
  *
  * <h3>Particular implementations</h3>
  *
@@ -146,7 +157,8 @@ public:
     explicit AdditionalData(const double       strengthen_diagonal   = 0.,
                             const unsigned int extra_off_diagonals   = 0,
                             const bool         use_previous_sparsity = false,
-                            const SparsityPattern *use_this_sparsity = nullptr);
+                            const SparsityPattern *use_this_sparsity = nullptr,
+                            const bool use_level_scheduling          = false);
 
     /**
      * <code>strengthen_diag</code> times the sum of absolute row entries is
@@ -189,6 +201,21 @@ public:
      * matrix.
      */
     const SparsityPattern *use_this_sparsity;
+
+    /**
+     * If this flag is true, the initialize() function determines a level
+     * schedule of the lower and upper triangular factors, i.e., it groups
+     * the rows into sets that do not depend on each other. The
+     * factorization and the triangular solves in vmult() then process the
+     * rows of each level in parallel, while Tvmult() remains sequential.
+     *
+     * The effectiveness of this option depends on the number of rows per
+     * level: for matrices coming from finite element discretizations on
+     * large meshes, levels typically contain many rows, whereas for
+     * (block-)tridiagonal matrices every level consists of a single row
+     * and no parallelism is available.
+     */
+    bool use_level_scheduling;
   };
 
   /**
@@ -323,6 +350,53 @@ protected:
   void
   prebuild_lower_bound();
 
+  /**
+   * The level schedule of the lower triangular factor, set up by
+   * compute_level_schedule(). The rows of level <code>l</code> are stored in
+   * the range <code>[lower_level_start[l], lower_level_start[l+1])</code> of
+   * #lower_level_rows. All rows of a level only depend on rows of previous
+   * levels. The array #lower_level_start is empty if no level scheduling is
+   * requested.
+   */
+  std::vector<size_type> lower_level_start;
+
+  /**
+   * The rows of the lower triangular factor sorted by level, see
+   * #lower_level_start.
+   */
+  std::vector<size_type> lower_level_rows;
+
+  /**
+   * Same as #lower_level_start for the upper triangular factor, with levels
+   * to be processed in the order of a backward substitution.
+   */
+  std::vector<size_type> upper_level_start;
+
+  /**
+   * The rows of the upper triangular factor sorted by level, see
+   * #upper_level_start.
+   */
+  std::vector<size_type> upper_level_rows;
+
+  /**
+   * Fill the #lower_level_start, #lower_level_rows, #upper_level_start and
+   * #upper_level_rows arrays from the sparsity pattern of the
+   * decomposition. Requires the #prebuilt_lower_bound array.
+   */
+  void
+  compute_level_schedule();
+
+  /**
+   * Call <code>function(row)</code> for all rows of the given level
+   * schedule, one level after the other. Rows within a level are processed
+   * in parallel if the level is large enough.
+   */
+  template <typename Function>
+  void
+  apply_level_scheduled(const std::vector<size_type> &level_start,
+                        const std::vector<size_type> &level_rows,
+                        const Function               &function) const;
+
 private:
   /**
    * In general this pointer is zero except for the case that no
@@ -407,6 +481,35 @@ SparseLUDecomposition<number>::Tvmult_add(OutVector      &dst,
   dst += tmp;
 }
 
+template <typename number>
+template <typename Function>
+inline void
+SparseLUDecomposition<number>::apply_level_scheduled(
+  const std::vector<size_type> &level_start,
+  const std::vector<size_type> &level_rows,
+  const Function               &function) const
+{
+  for (size_type level = 0; level + 1 < level_start.size(); ++level)
+    {
+      const size_type begin = level_start[level];
+      const size_type end   = level_start[level + 1];
+      if (end - begin <
+          internal::SparseMatrixImplementation::minimum_parallel_grain_size)
+        for (size_type i = begin; i < end; ++i)
+          function(level_rows[i]);
+      else
+        parallel::apply_to_subranges(
+          begin,
+          end,
+          [&](const size_type range_begin, const size_type range_end) {
+            for (size_type i = range_begin; i < range_end; ++i)
+              function(level_rows[i]);
+          },
+          internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    }
+}
+
+
 //---------------------------------------------------------------------------
 
 
@@ -415,11 +518,13 @@ SparseLUDecomposition<number>::AdditionalData::AdditionalData(
   const double           strengthen_diag,
   const unsigned int     extra_off_diag,
   const bool             use_prev_sparsity,
-  const SparsityPattern *use_this_spars)
+  const SparsityPattern *use_this_spars,
+  const bool             use_level_sched)
   : strengthen_diagonal(strengthen_diag)
   , extra_off_diagonals(extra_off_diag)
   , use_previous_sparsity(use_prev_sparsity)
   , use_this_sparsity(use_this_spars)
+  , use_level_scheduling(use_level_sched)
 {}
 
 
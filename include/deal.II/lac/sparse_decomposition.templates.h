@@ -56,6 +56,12 @@ SparseLUDecomposition<number>::clear()
   std::vector<const size_type *> tmp;
   tmp.swap(prebuilt_lower_bound);
 
+  for (std::vector<size_type> *level_data : {&lower_level_start,
+                                             &lower_level_rows,
+                                             &upper_level_start,
+                                             &upper_level_rows})
+    std::vector<size_type>().swap(*level_data);
+
   SparseMatrix<number>::clear();
 
   if (own_sparsity != nullptr)
@@ -132,6 +138,10 @@ SparseLUDecomposition<number>::initialize(
     std::vector<const size_type *> tmp;
     tmp.swap(prebuilt_lower_bound);
   }
+  lower_level_start.clear();
+  lower_level_rows.clear();
+  upper_level_start.clear();
+  upper_level_rows.clear();
   SparseMatrix<number>::reinit(*sparsity_pattern_to_use);
 }
 
@@ -158,6 +168,94 @@ SparseLUDecomposition<number>::prebuild_lower_bound()
     }
 }
 
+
+
+namespace internal
+{
+  namespace SparseLUDecompositionImplementation
+  {
+    /**
+     * Sort the rows by the levels given in @p row_level, keeping the
+     * ascending order of the rows within each level, and store the result
+     * in the compressed format described in
+     * SparseLUDecomposition::lower_level_start.
+     */
+    template <typename size_type>
+    void
+    sort_rows_by_level(const std::vector<size_type> &row_level,
+                       const size_type               n_levels,
+                       std::vector<size_type>       &level_start,
+                       std::vector<size_type>       &level_rows)
+    {
+      level_start.assign(n_levels + 1, 0);
+      for (const size_type level : row_level)
+        ++level_start[level + 1];
+      for (size_type level = 0; level < n_levels; ++level)
+        level_start[level + 1] += level_start[level];
+
+      std::vector<size_type> next_position(level_start.begin(),
+                                           level_start.end() - 1);
+      level_rows.resize(row_level.size());
+      for (size_type row = 0; row < row_level.size(); ++row)
+        level_rows[next_position[row_level[row]]++] = row;
+    }
+  } // namespace SparseLUDecompositionImplementation
+} // namespace internal
+
+
+
+template <typename number>
+void
+SparseLUDecomposition<number>::compute_level_schedule()
+{
+  Assert(prebuilt_lower_bound.size() == this->m(),
+         ExcMessage("The lower bounds of the rows must be computed before "
+                    "the level schedule."));
+
+  const size_type *const column_numbers =
+    this->get_sparsity_pattern().colnums.get();
+  const std::size_t *const rowstart_indices =
+    this->get_sparsity_pattern().rowstart.get();
+  const size_type N = this->m();
+
+  std::vector<size_type> row_level(N);
+
+  // a row of the lower factor can be processed as soon as all rows
+  // referenced left of the diagonal are done. the diagonal is stored first,
+  // so the lower part of the row starts at the second entry
+  size_type n_levels = 0;
+  for (size_type row = 0; row < N; ++row)
+    {
+      size_type level = 0;
+      for (const size_type *col = &column_numbers[rowstart_indices[row] + 1];
+           col != prebuilt_lower_bound[row];
+           ++col)
+        level = std::max(level, row_level[*col] + 1);
+      row_level[row] = level;
+      n_levels       = std::max(n_levels, level + 1);
+    }
+  internal::SparseLUDecompositionImplementation::sort_rows_by_level(
+    row_level, n_levels, lower_level_start, lower_level_rows);
+
+  // the same for the upper factor, where the dependencies run from the last
+  // row towards the first one
+  n_levels = 0;
+  for (size_type row = N; row-- > 0;)
+    {
+      size_type level = 0;
+      for (const size_type *col = prebuilt_lower_bound[row];
+           col != &column_numbers[rowstart_indices[row + 1]];
+           ++col)
+        level = std::max(level, row_level[*col] + 1);
+      row_level[row] = level;
+      n_levels       = std::max(n_levels, level + 1);
+    }
+  internal::SparseLUDecompositionImplementation::sort_rows_by_level(
+    row_level, n_levels, upper_level_start, upper_level_rows);
+}
+
+
+
 template <typename number>
 template <typename somenumber>
 void
@@ -238,7 +336,11 @@ std::size_t
 SparseLUDecomposition<number>::memory_consumption() const
 {
   return (SparseMatrix<number>::memory_consumption() +
-          MemoryConsumption::memory_consumption(prebuilt_lower_bound));
+          MemoryConsumption::memory_consumption(prebuilt_lower_bound) +
+          MemoryConsumption::memory_consumption(lower_level_start) +
+          MemoryConsumption::memory_consumption(lower_level_rows) +
+          MemoryConsumption::memory_consumption(upper_level_start) +
+          MemoryConsumption::memory_consumption(upper_level_rows));
 }
 
 
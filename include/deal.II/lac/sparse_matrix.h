@@ -42,6 +42,18 @@ template <typename Matrix>
 class BlockMatrixBase;
 template <typename number>
 class SparseILU;
+template <typename number>
+class ConcurrentSparseMatrixAdder;
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+    template <typename>
+    class BlockVector;
+  } // namespace distributed
+} // namespace LinearAlgebra
 #  ifdef DEAL_II_WITH_MPI
 namespace Utilities
 {
@@ -507,6 +519,37 @@ DEAL_II_NAMESPACE_OPEN
  * SparseMatrix::end) you will find that the elements are not sorted by column
  * index within each row whenever the matrix is square.
  *
+ * <h3>Mixed precision</h3>
+ *
+ * The number type of the matrix entries and the one of the vectors the
+ * matrix is applied to need not coincide. Since the matrix-vector product is
+ * limited by the memory bandwidth for loading the matrix entries and column
+ * indices, storing the entries of a matrix in single precision reduces the
+ * time for vmult() by up to a third, while the results are still accumulated
+ * in the number type of the destination vector. The entries are converted on
+ * the fly, so no temporary vectors in the lower precision are needed:
+ * @code
+ *   SparseMatrix<double> system_matrix(sparsity_pattern);
+ *   ... // assemble system_matrix
+ *
+ *   SparseMatrix<float> system_matrix_float(sparsity_pattern);
+ *   system_matrix_float.copy_from(system_matrix);
+ *
+ *   LinearAlgebra::distributed::Vector<double> src(n), dst(n);
+ *   system_matrix_float.vmult(dst, src);
+ *
+ *   PreconditionJacobi<SparseMatrix<float>> jacobi;
+ *   jacobi.initialize(system_matrix_float);
+ *   jacobi.vmult(dst, src);
+ * @endcode
+ * Such a matrix is most useful within preconditioners and smoothers like
+ * PreconditionJacobi, PreconditionChebyshev or multigrid level operators,
+ * where the accuracy of single precision is sufficient, whereas the outer
+ * Krylov solver should keep using the matrix stored in double precision.
+ * The library provides the instantiations for all combinations of
+ * <tt>@<float@></tt> and <tt>@<double@></tt> for the matrix and the
+ * Vector, BlockVector and LinearAlgebra::distributed::Vector classes.
+ *
  * @note Instantiations for this template are provided for <tt>@<float@> and
  * @<double@></tt>; others can be generated in application programs (see the
  * section on
@@ -1153,6 +1196,35 @@ public:
   void
   Tvmult(OutVector &dst, const InVector &src) const;
 
+  /**
+   * Matrix-vector multiplication with several vectors at once: interpret
+   * each block of @p src and @p dst as a separate vector, and let
+   * <i>dst.block(c) = M*src.block(c)</i> for all blocks <i>c</i>. This is
+   * the multivector interpretation of a block vector also used by
+   * LinearAlgebra::distributed::BlockVector::multivector_inner_product(),
+   * and is different from vmult(), which would treat a block vector as a
+   * single long vector.
+   *
+   * Since the performance of vmult() is limited by loading the matrix from
+   * memory, this function is considerably faster than calling vmult() for
+   * each block separately: every matrix entry is loaded only once and then
+   * applied to all vectors.
+   *
+   * The blocks must be serial vectors, i.e., their locally owned range must
+   * span the whole vector. The number type of the vectors may differ from
+   * the number type of the matrix, see the section on mixed precision in
+   * the general documentation of this class.
+   *
+   * Source and destination must not be the same vector.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename somenumber>
+  void
+  multivector_vmult(
+    LinearAlgebra::distributed::BlockVector<somenumber>       &dst,
+    const LinearAlgebra::distributed::BlockVector<somenumber> &src) const;
+
   /**
    * Adding Matrix-vector multiplication. Add <i>M*src</i> on <i>dst</i> with
    * <i>M</i> being this matrix.
@@ -1360,6 +1432,20 @@ public:
                       const Vector<somenumber> &src,
                       const number              omega = 1.) const;
 
+  /**
+   * Same as above, but for serial vectors of type
+   * LinearAlgebra::distributed::Vector stored in host memory. The number
+   * type of the vectors may differ from the number type of the matrix, see
+   * the section on mixed precision in the general documentation of this
+   * class.
+   */
+  template <typename somenumber, typename MemorySpaceType>
+  void
+  precondition_Jacobi(
+    LinearAlgebra::distributed::Vector<somenumber, MemorySpaceType>       &dst,
+    const LinearAlgebra::distributed::Vector<somenumber, MemorySpaceType> &src,
+    const number omega = 1.) const;
+
   /**
    * Apply SSOR preconditioning to <tt>src</tt> with damping <tt>omega</tt>.
    * The optional argument <tt>pos_right_of_diagonal</tt> is supposed to
@@ -1771,6 +1857,11 @@ private:
   template <typename>
   friend class SparseILU;
 
+  // To allow atomic additions to the matrix entries without searching
+  // for each entry.
+  template <typename>
+  friend class ConcurrentSparseMatrixAdder;
+
   // To allow it calling private prepare_add() and prepare_set().
   template <typename>
   friend class BlockMatrixBase;
@@ -494,6 +494,45 @@ namespace internal
             *dst_ptr++ = s;
           }
     }
+
+
+
+    /**
+     * Perform a vmult for several vectors at once, given by the pointers to
+     * their first entry. For each row, all entries of the matrix are applied
+     * to batches of several vectors, such that the matrix row is only read
+     * from memory once.
+     */
+    template <typename number, typename somenumber>
+    void
+    multivector_vmult_on_subrange(
+      const size_type                        begin_row,
+      const size_type                        end_row,
+      const number                          *values,
+      const std::size_t                     *rowstart,
+      const size_type                       *colnums,
+      const std::vector<const somenumber *> &src,
+      const std::vector<somenumber *>       &dst)
+    {
+      constexpr unsigned int n_batch   = 8;
+      const unsigned int     n_vectors = src.size();
+
+      for (size_type row = begin_row; row < end_row; ++row)
+        for (unsigned int c_begin = 0; c_begin < n_vectors; c_begin += n_batch)
+          {
+            const unsigned int c_end = std::min(c_begin + n_batch, n_vectors);
+            somenumber         sums[n_batch] = {};
+            for (std::size_t j = rowstart[row]; j < rowstart[row + 1]; ++j)
+              {
+                const somenumber value = somenumber(values[j]);
+                const size_type  col   = colnums[j];
+                for (unsigned int c = c_begin; c < c_end; ++c)
+                  sums[c - c_begin] += value * src[c][col];
+              }
+            for (unsigned int c = c_begin; c < c_end; ++c)
+              dst[c][row] = sums[c - c_begin];
+          }
+    }
   } // namespace SparseMatrixImplementation
 } // namespace internal
 
@@ -774,6 +813,49 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
 
 
 
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::multivector_vmult(
+  LinearAlgebra::distributed::BlockVector<somenumber>       &dst,
+  const LinearAlgebra::distributed::BlockVector<somenumber> &src) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(dst.n_blocks(), src.n_blocks());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  std::vector<const somenumber *> src_ptrs(src.n_blocks());
+  std::vector<somenumber *>       dst_ptrs(dst.n_blocks());
+  for (unsigned int c = 0; c < src.n_blocks(); ++c)
+    {
+      AssertDimension(m(), dst.block(c).locally_owned_size());
+      AssertDimension(n(), src.block(c).locally_owned_size());
+      AssertDimension(m(), dst.block(c).size());
+      AssertDimension(n(), src.block(c).size());
+      src_ptrs[c] = src.block(c).begin();
+      dst_ptrs[c] = dst.block(c).begin();
+    }
+
+  parallel::apply_to_subranges(
+    0U,
+    m(),
+    [this, &src_ptrs, &dst_ptrs](const size_type begin_row,
+                                 const size_type end_row) {
+      internal::SparseMatrixImplementation::multivector_vmult_on_subrange(
+        begin_row,
+        end_row,
+        val.get(),
+        cols->rowstart.get(),
+        cols->colnums.get(),
+        src_ptrs,
+        dst_ptrs);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+}
+
+
+
 template <typename number>
 template <class OutVector, class InVector>
 void
@@ -1377,6 +1459,49 @@ namespace internal
 } // namespace internal
 
 
+namespace internal
+{
+  namespace SparseMatrixImplementation
+  {
+    /**
+     * Apply the Jacobi preconditioner to the @p n entries of @p src, using
+     * the fact that the diagonal entry is the first one in each row of a
+     * square matrix. The entries of the matrix are converted to the number
+     * type of the vectors on the fly.
+     */
+    template <typename number, typename somenumber>
+    void
+    precondition_Jacobi(const size_type    n,
+                        const number      *val,
+                        const std::size_t *rowstart_ptr,
+                        const somenumber  *src_ptr,
+                        somenumber        *dst_ptr,
+                        const number       omega)
+    {
+      // optimize the following loop for
+      // the case that the relaxation
+      // factor is one. In that case, we
+      // can save one FP multiplication
+      // per row
+      //
+      // note that for square matrices,
+      // the diagonal entry is the first
+      // in each row, i.e. at index
+      // rowstart[i]. and we do have a
+      // square matrix by above assertion
+      if (omega != number(1.))
+        for (size_type i = 0; i < n; ++i, ++dst_ptr, ++src_ptr, ++rowstart_ptr)
+          *dst_ptr =
+            somenumber(omega) * *src_ptr / somenumber(val[*rowstart_ptr]);
+      else
+        for (size_type i = 0; i < n; ++i, ++dst_ptr, ++src_ptr, ++rowstart_ptr)
+          *dst_ptr = *src_ptr / somenumber(val[*rowstart_ptr]);
+    }
+  } // namespace SparseMatrixImplementation
+} // namespace internal
+
+
+
 template <typename number>
 template <typename somenumber>
 void
@@ -1392,32 +1517,45 @@ SparseMatrix<number>::precondition_Jacobi(Vector<somenumber>       &dst,
 
   internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
 
-  const size_type    n            = src.size();
-  somenumber        *dst_ptr      = dst.begin();
-  const somenumber  *src_ptr      = src.begin();
-  const std::size_t *rowstart_ptr = cols->rowstart.get();
-
-  // optimize the following loop for
-  // the case that the relaxation
-  // factor is one. In that case, we
-  // can save one FP multiplication
-  // per row
-  //
-  // note that for square matrices,
-  // the diagonal entry is the first
-  // in each row, i.e. at index
-  // rowstart[i]. and we do have a
-  // square matrix by above assertion
-  if (omega != number(1.))
-    for (size_type i = 0; i < n; ++i, ++dst_ptr, ++src_ptr, ++rowstart_ptr)
-      *dst_ptr = somenumber(omega) * *src_ptr / somenumber(val[*rowstart_ptr]);
-  else
-    for (size_type i = 0; i < n; ++i, ++dst_ptr, ++src_ptr, ++rowstart_ptr)
-      *dst_ptr = *src_ptr / somenumber(val[*rowstart_ptr]);
+  internal::SparseMatrixImplementation::precondition_Jacobi(
+    src.size(),
+    val.get(),
+    cols->rowstart.get(),
+    src.begin(),
+    dst.begin(),
+    omega);
 }
 
 
 
+template <typename number>
+template <typename somenumber, typename MemorySpaceType>
+void
+SparseMatrix<number>::precondition_Jacobi(
+  LinearAlgebra::distributed::Vector<somenumber, MemorySpaceType>       &dst,
+  const LinearAlgebra::distributed::Vector<somenumber, MemorySpaceType> &src,
+  const number omega) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+  AssertDimension(dst.locally_owned_size(), n());
+  AssertDimension(src.locally_owned_size(), n());
+
+  internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
+
+  internal::SparseMatrixImplementation::precondition_Jacobi(
+    src.size(),
+    val.get(),
+    cols->rowstart.get(),
+    src.begin(),
+    dst.begin(),
+    omega);
+}
+
+
 template <typename number>
 template <typename somenumber>
 void
@@ -0,0 +1,781 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_sell_h
+#define dealii_sparse_matrix_sell_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A sparse matrix stored in the sliced ELLPACK format with row sorting, also
+ * known as SELL-C-$\sigma$ (see Kreutzer, Hager, Wellein, Fehske, Bishop: "A
+ * unified sparse matrix data format for efficient general sparse
+ * matrix-vector multiplication on modern processors with wide SIMD units",
+ * SIAM J. Sci. Comput. 36(5), 2014).
+ *
+ * The rows of the matrix are grouped into slices of
+ * <code>C = VectorizedArray<number>::size()</code> rows each. Within a slice,
+ * all rows are padded to the length of the longest row of the slice and the
+ * entries are stored column by column, i.e., the $j$-th entry of all $C$
+ * rows of a slice are adjacent in memory. This allows the matrix-vector
+ * product to work on all rows of a slice at once with the SIMD instructions
+ * provided by VectorizedArray, with the entries of the source vector
+ * collected by VectorizedArray::gather(). In contrast, the row-by-row loop of
+ * SparseMatrix::vmult() has only a few entries per row to work on for typical
+ * finite element matrices, which is too short to make efficient use of SIMD
+ * units.
+ *
+ * In order to reduce the amount of padding, the rows within a window of
+ * $\sigma$ consecutive rows are sorted by decreasing length before they are
+ * grouped into slices. A value of $\sigma=1$ keeps the original row order,
+ * which is the best choice for matrices with rows of similar length as they
+ * appear for finite element discretizations on meshes of a single cell type
+ * and polynomial degree. Larger values help when rows of very different
+ * lengths are mixed, e.g., for hp-discretizations or at hanging nodes.
+ *
+ * The class does not support assembly. Rather, the structure is built from
+ * an existing SparsityPattern with reinit() and the values are copied from a
+ * SparseMatrix based on the same sparsity pattern with copy_from(). A typical
+ * use case is therefore
+ * @code
+ *   SparseMatrix<double> system_matrix(sparsity_pattern);
+ *   ... // assemble system_matrix
+ *
+ *   SparseMatrixSELL<double> sell_matrix(sparsity_pattern);
+ *   sell_matrix.copy_from(system_matrix);
+ *
+ *   SolverCG<Vector<double>> solver(solver_control);
+ *   solver.solve(sell_matrix, solution, system_rhs, PreconditionIdentity());
+ * @endcode
+ *
+ * The vector arguments to the matrix-vector products need to store their
+ * elements contiguously and provide the <code>begin()</code> function to
+ * access them, as is the case for Vector and serial
+ * LinearAlgebra::distributed::Vector objects. The vectorized code path is
+ * taken if the vector's value type matches @p number, otherwise the same
+ * data layout is traversed with scalar operations.
+ *
+ * @note This class is fully implemented in its header file and can be used
+ * with all number types supported by VectorizedArray.
+ */
+template <typename number>
+class SparseMatrixSELL : public virtual EnableObserverPointer
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the matrix entries.
+   */
+  using value_type = number;
+
+  /**
+   * The number of rows grouped into one slice, which equals the number of
+   * lanes of VectorizedArray for the type @p number.
+   */
+  static constexpr unsigned int chunk_size = VectorizedArray<number>::size();
+
+  /**
+   * Constructor. Initialize an empty matrix.
+   */
+  SparseMatrixSELL();
+
+  /**
+   * Constructor. Set up the data structures from the given sparsity pattern
+   * by calling reinit().
+   */
+  explicit SparseMatrixSELL(const SparsityPattern &sparsity,
+                            const unsigned int     sigma = 1);
+
+  /**
+   * Set up the slices and the padded column indices from the given sparsity
+   * pattern and set all values to zero. The argument @p sigma denotes the
+   * number of consecutive rows that are sorted by their length before they
+   * are grouped into slices; it is rounded up to a multiple of chunk_size
+   * unless it is one, which disables the sorting.
+   *
+   * The sparsity pattern needs to be compressed. It is stored in terms of an
+   * ObserverPointer, so it must live at least as long as this object or
+   * until the matrix is reinitialized.
+   */
+  void
+  reinit(const SparsityPattern &sparsity, const unsigned int sigma = 1);
+
+  /**
+   * Copy the values of the given matrix into the sliced storage. The matrix
+   * must be based on the same SparsityPattern object this class has been
+   * initialized with.
+   */
+  template <typename number2>
+  void
+  copy_from(const SparseMatrix<number2> &matrix);
+
+  /**
+   * Release all memory and return to a state just like after the default
+   * constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return whether the object is empty.
+   */
+  bool
+  empty() const;
+
+  /**
+   * Return the number of rows of the matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of nonzero entries, i.e., the number of entries of the
+   * underlying sparsity pattern.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the number of entries actually stored including the padding
+   * within slices. The ratio between this number and n_nonzero_elements()
+   * determines the overhead of the format compared to SparseMatrix.
+   */
+  std::size_t
+  n_stored_elements() const;
+
+  /**
+   * Return the value of the entry (i,j), or zero if the entry is not part of
+   * the sparsity pattern.
+   */
+  number
+  el(const size_type i, const size_type j) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+   * matrix. The work is split into ranges of slices that are processed in
+   * parallel.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: add $M*src$ on $dst$.
+   */
+  template <typename VectorType>
+  void
+  vmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Matrix-vector multiplication with the transposed matrix: let $dst =
+   * M^T*src$. Since different rows of a slice write into the same entries of
+   * the destination vector, this function runs serially.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication with the transposed matrix: add
+   * $M^T*src$ on $dst$.
+   */
+  template <typename VectorType>
+  void
+  Tvmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the Jacobi preconditioner, which multiplies every element of the
+   * @p src vector by the inverse of the respective diagonal element and
+   * multiplies the result with the relaxation factor @p omega. The inverse
+   * diagonal is computed in copy_from(), so this function only involves a
+   * vectorized loop over three contiguous arrays.
+   */
+  template <typename VectorType>
+  void
+  precondition_Jacobi(VectorType                             &dst,
+                      const VectorType                       &src,
+                      const typename VectorType::value_type &omega = 1.) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * @addtogroup Exceptions
+   * @{
+   */
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcDifferentSparsityPatterns,
+                   "The matrix passed to copy_from() must be based on the "
+                   "same SparsityPattern object this matrix has been "
+                   "initialized with.");
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcSourceEqualsDestination,
+                   "You are attempting an operation on two vectors that "
+                   "are the same object, but the operation requires that the "
+                   "two objects are in fact different.");
+  /** @} */
+
+private:
+  /**
+   * Compute the product of the rows in the slices
+   * <code>[begin_slice,end_slice)</code> with the vector @p src and write
+   * (or add, if @p add is set) the result into @p dst.
+   */
+  template <typename Number2>
+  void
+  vmult_on_subrange(const unsigned int begin_slice,
+                    const unsigned int end_slice,
+                    const Number2     *src,
+                    Number2           *dst,
+                    const bool         add) const;
+
+  /**
+   * Pointer to the sparsity pattern the structure was built from.
+   */
+  ObserverPointer<const SparsityPattern, SparseMatrixSELL<number>> cols;
+
+  /**
+   * The number of rows of the matrix.
+   */
+  unsigned int n_rows;
+
+  /**
+   * The number of columns of the matrix.
+   */
+  unsigned int n_cols;
+
+  /**
+   * The row index of the matrix for every lane of every slice. Lanes beyond
+   * the last row of the matrix are filled with
+   * numbers::invalid_unsigned_int.
+   */
+  std::vector<unsigned int> row_indices;
+
+  /**
+   * The offset of the first entry of every slice into the arrays
+   * #values and #column_indices, with one additional entry at the end
+   * pointing one past the last element.
+   */
+  std::vector<std::size_t> slice_start;
+
+  /**
+   * The matrix entries, stored slice by slice and, within a slice, column
+   * by column, i.e., in chunks of chunk_size entries that belong to
+   * different rows. Padded entries are zero.
+   */
+  AlignedVector<number> values;
+
+  /**
+   * The column index for every entry of #values. Padded entries repeat the
+   * last valid column of the row to avoid accessing additional cache lines
+   * of the source vector.
+   */
+  AlignedVector<unsigned int> column_indices;
+
+  /**
+   * For every entry of the sparsity pattern in its CSR order, the position
+   * in the arrays #values and #column_indices.
+   */
+  std::vector<std::size_t> csr_to_sell;
+
+  /**
+   * The inverse of the diagonal entries in the original row order, computed
+   * by copy_from() for square matrices.
+   */
+  AlignedVector<number> inverse_diagonal;
+};
+
+/** @} */
+
+
+#ifndef DOXYGEN
+/*---------------------- Inline functions -----------------------------------*/
+
+
+template <typename number>
+inline SparseMatrixSELL<number>::SparseMatrixSELL()
+  : cols(nullptr, "SparseMatrixSELL")
+  , n_rows(0)
+  , n_cols(0)
+{}
+
+
+
+template <typename number>
+inline SparseMatrixSELL<number>::SparseMatrixSELL(
+  const SparsityPattern &sparsity,
+  const unsigned int     sigma)
+  : SparseMatrixSELL()
+{
+  reinit(sparsity, sigma);
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixSELL<number>::clear()
+{
+  cols = nullptr;
+  n_rows = 0;
+  n_cols = 0;
+  row_indices.clear();
+  slice_start.clear();
+  values.clear();
+  column_indices.clear();
+  csr_to_sell.clear();
+  inverse_diagonal.clear();
+}
+
+
+
+template <typename number>
+inline bool
+SparseMatrixSELL<number>::empty() const
+{
+  return n_rows == 0 || n_cols == 0;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::n() const
+{
+  return n_cols;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_nonzero_elements() const
+{
+  return csr_to_sell.size();
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_stored_elements() const
+{
+  return values.size();
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::reinit(const SparsityPattern &sparsity,
+                                 const unsigned int     sigma)
+{
+  Assert(sparsity.is_compressed(), SparsityPattern::ExcNotCompressed());
+  AssertThrow(sparsity.n_rows() < std::numeric_limits<unsigned int>::max() &&
+                sparsity.n_cols() < std::numeric_limits<unsigned int>::max(),
+              ExcMessage("SparseMatrixSELL uses 32-bit column indices to "
+                         "gather the entries of the source vector. The "
+                         "matrix is too large for this format."));
+  AssertThrow(sigma > 0, ExcMessage("The sorting window must be positive."));
+
+  clear();
+  cols   = &sparsity;
+  n_rows = sparsity.n_rows();
+  n_cols = sparsity.n_cols();
+
+  const unsigned int n_slices = (n_rows + chunk_size - 1) / chunk_size;
+
+  // sort the rows by decreasing length within windows of size sigma, using
+  // a stable sort to keep the original order for rows of equal length
+  row_indices.resize(n_slices * chunk_size, numbers::invalid_unsigned_int);
+  std::iota(row_indices.begin(), row_indices.begin() + n_rows, 0U);
+  if (sigma > 1)
+    {
+      const unsigned int window =
+        (sigma + chunk_size - 1) / chunk_size * chunk_size;
+      for (unsigned int start = 0; start < n_rows; start += window)
+        std::stable_sort(row_indices.begin() + start,
+                         row_indices.begin() + std::min(start + window, n_rows),
+                         [&](const unsigned int a, const unsigned int b) {
+                           return sparsity.row_length(a) >
+                                  sparsity.row_length(b);
+                         });
+    }
+
+  slice_start.resize(n_slices + 1);
+  slice_start[0] = 0;
+  for (unsigned int s = 0; s < n_slices; ++s)
+    {
+      unsigned int max_length = 0;
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        if (row_indices[s * chunk_size + v] != numbers::invalid_unsigned_int)
+          max_length =
+            std::max<unsigned int>(max_length,
+                                   sparsity.row_length(
+                                     row_indices[s * chunk_size + v]));
+      slice_start[s + 1] = slice_start[s] + max_length * chunk_size;
+    }
+
+  values.resize_fast(slice_start.back());
+  column_indices.resize_fast(slice_start.back());
+  csr_to_sell.resize(sparsity.n_nonzero_elements());
+  values.fill(number());
+
+  std::vector<std::size_t> row_start(n_rows + 1);
+  row_start[0] = 0;
+  for (unsigned int row = 0; row < n_rows; ++row)
+    row_start[row + 1] = row_start[row] + sparsity.row_length(row);
+
+  for (unsigned int s = 0; s < n_slices; ++s)
+    {
+      const unsigned int length =
+        (slice_start[s + 1] - slice_start[s]) / chunk_size;
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        {
+          const unsigned int row = row_indices[s * chunk_size + v];
+          const unsigned int row_length =
+            row == numbers::invalid_unsigned_int ? 0 :
+                                                   sparsity.row_length(row);
+          unsigned int last_column = 0;
+          for (unsigned int j = 0; j < row_length; ++j)
+            {
+              const std::size_t index =
+                slice_start[s] + std::size_t(j) * chunk_size + v;
+              last_column           = sparsity.column_number(row, j);
+              column_indices[index] = last_column;
+              csr_to_sell[row_start[row] + j] = index;
+            }
+          for (unsigned int j = row_length; j < length; ++j)
+            column_indices[slice_start[s] + std::size_t(j) * chunk_size + v] =
+              last_column;
+        }
+    }
+}
+
+
+
+template <typename number>
+template <typename number2>
+void
+SparseMatrixSELL<number>::copy_from(const SparseMatrix<number2> &matrix)
+{
+  Assert(cols != nullptr, ExcNotInitialized());
+  Assert(&matrix.get_sparsity_pattern() == cols,
+         ExcDifferentSparsityPatterns());
+
+  std::size_t index = 0;
+  for (unsigned int row = 0; row < n_rows; ++row)
+    for (auto entry = matrix.begin(row); entry != matrix.end(row); ++entry)
+      values[csr_to_sell[index++]] = static_cast<number>(entry->value());
+
+  if (n_rows == n_cols)
+    {
+      inverse_diagonal.resize_fast(n_rows);
+      for (unsigned int row = 0; row < n_rows; ++row)
+        {
+          const number diagonal = static_cast<number>(matrix.diag_element(row));
+          Assert(diagonal != number(), ExcDivideByZero());
+          inverse_diagonal[row] = number(1.) / diagonal;
+        }
+    }
+}
+
+
+
+template <typename number>
+number
+SparseMatrixSELL<number>::el(const size_type i, const size_type j) const
+{
+  Assert(cols != nullptr, ExcNotInitialized());
+  AssertIndexRange(i, n_rows);
+  AssertIndexRange(j, n_cols);
+
+  const size_type index = cols->operator()(i, j);
+  if (index == SparsityPattern::invalid_entry)
+    return number();
+  else
+    return values[csr_to_sell[index]];
+}
+
+
+
+template <typename number>
+template <typename Number2>
+void
+SparseMatrixSELL<number>::vmult_on_subrange(const unsigned int begin_slice,
+                                            const unsigned int end_slice,
+                                            const Number2     *src,
+                                            Number2           *dst,
+                                            const bool         add) const
+{
+  for (unsigned int s = begin_slice; s < end_slice; ++s)
+    {
+      const unsigned int *rows = row_indices.data() + s * chunk_size;
+      const bool          full_slice =
+        rows[chunk_size - 1] != numbers::invalid_unsigned_int;
+
+      if constexpr (std::is_same_v<Number2, number>)
+        {
+          VectorizedArray<number> sum;
+          if (add && full_slice)
+            sum.gather(dst, rows);
+          else
+            sum = number();
+
+          const number       *val_ptr = values.data() + slice_start[s];
+          const unsigned int *col_ptr = column_indices.data() + slice_start[s];
+          const number *const val_end = values.data() + slice_start[s + 1];
+          for (; val_ptr != val_end;
+               val_ptr += chunk_size, col_ptr += chunk_size)
+            {
+              VectorizedArray<number> matrix_entries, vector_entries;
+              matrix_entries.load(val_ptr);
+              vector_entries.gather(src, col_ptr);
+              sum += matrix_entries * vector_entries;
+            }
+
+          if (full_slice)
+            sum.scatter(rows, dst);
+          else
+            for (unsigned int v = 0; v < chunk_size; ++v)
+              if (rows[v] != numbers::invalid_unsigned_int)
+                dst[rows[v]] = add ? dst[rows[v]] + sum[v] : sum[v];
+        }
+      else
+        {
+          Number2 sum[chunk_size];
+          for (unsigned int v = 0; v < chunk_size; ++v)
+            sum[v] = Number2();
+
+          for (std::size_t i = slice_start[s]; i < slice_start[s + 1];
+               i += chunk_size)
+            for (unsigned int v = 0; v < chunk_size; ++v)
+              sum[v] += Number2(values[i + v]) * src[column_indices[i + v]];
+
+          for (unsigned int v = 0; v < chunk_size; ++v)
+            if (rows[v] != numbers::invalid_unsigned_int)
+              dst[rows[v]] = add ? dst[rows[v]] + sum[v] : sum[v];
+        }
+    }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+void
+SparseMatrixSELL<number>::vmult(VectorType &dst, const VectorType &src) const
+{
+  Assert(cols != nullptr, ExcNotInitialized());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(slice_start.size() - 1),
+    [this, &src, &dst](const unsigned int begin_slice,
+                       const unsigned int end_slice) {
+      vmult_on_subrange(
+        begin_slice, end_slice, src.begin(), dst.begin(), false);
+    },
+    std::max(1U,
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+               chunk_size));
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+void
+SparseMatrixSELL<number>::vmult_add(VectorType       &dst,
+                                    const VectorType &src) const
+{
+  Assert(cols != nullptr, ExcNotInitialized());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(slice_start.size() - 1),
+    [this, &src, &dst](const unsigned int begin_slice,
+                       const unsigned int end_slice) {
+      vmult_on_subrange(
+        begin_slice, end_slice, src.begin(), dst.begin(), true);
+    },
+    std::max(1U,
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+               chunk_size));
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+void
+SparseMatrixSELL<number>::Tvmult(VectorType &dst, const VectorType &src) const
+{
+  dst = 0;
+  Tvmult_add(dst, src);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+void
+SparseMatrixSELL<number>::Tvmult_add(VectorType       &dst,
+                                     const VectorType &src) const
+{
+  using Number2 = typename VectorType::value_type;
+
+  Assert(cols != nullptr, ExcNotInitialized());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  const Number2 *src_ptr = src.begin();
+  Number2       *dst_ptr = dst.begin();
+  for (unsigned int s = 0; s + 1 < slice_start.size(); ++s)
+    {
+      const unsigned int *rows = row_indices.data() + s * chunk_size;
+      Number2             src_values[chunk_size];
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        src_values[v] =
+          rows[v] != numbers::invalid_unsigned_int ? src_ptr[rows[v]] : 0;
+
+      for (std::size_t i = slice_start[s]; i < slice_start[s + 1];
+           i += chunk_size)
+        for (unsigned int v = 0; v < chunk_size; ++v)
+          dst_ptr[column_indices[i + v]] +=
+            Number2(values[i + v]) * src_values[v];
+    }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+void
+SparseMatrixSELL<number>::precondition_Jacobi(
+  VectorType                             &dst,
+  const VectorType                       &src,
+  const typename VectorType::value_type &omega) const
+{
+  using Number2 = typename VectorType::value_type;
+
+  Assert(cols != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+  Assert(inverse_diagonal.size() == n_rows,
+         ExcMessage("The diagonal is only available after copy_from()."));
+
+  const Number2 *src_ptr = src.begin();
+  Number2       *dst_ptr = dst.begin();
+  const number  *inv_ptr = inverse_diagonal.data();
+
+  parallel::apply_to_subranges(
+    0U,
+    n_rows,
+    [&](const unsigned int begin, const unsigned int end) {
+      unsigned int i = begin;
+      if constexpr (std::is_same_v<Number2, number>)
+        for (; i + chunk_size <= end; i += chunk_size)
+          {
+            VectorizedArray<number> s, d;
+            s.load(src_ptr + i);
+            d.load(inv_ptr + i);
+            (s * d * omega).store(dst_ptr + i);
+          }
+      for (; i < end; ++i)
+        dst_ptr[i] = omega * src_ptr[i] * Number2(inv_ptr[i]);
+    },
+    internal::VectorImplementation::minimum_parallel_grain_size);
+}
+
+
+
+template <typename number>
+std::size_t
+SparseMatrixSELL<number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(row_indices) +
+         MemoryConsumption::memory_consumption(slice_start) +
+         values.memory_consumption() + column_indices.memory_consumption() +
+         MemoryConsumption::memory_consumption(csr_to_sell) +
+         inverse_diagonal.memory_consumption();
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
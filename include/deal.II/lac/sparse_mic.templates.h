@@ -69,6 +69,8 @@ SparseMIC<number>::initialize(const SparseMatrix<somenumber> &matrix,
   SparseLUDecomposition<number>::initialize(matrix, data);
   this->strengthen_diagonal = data.strengthen_diagonal;
   this->prebuild_lower_bound();
+  if (data.use_level_scheduling)
+    this->compute_level_schedule();
   this->copy_from(matrix);
 
   Assert(this->m() == this->n(), ExcNotQuadratic());
@@ -94,24 +96,35 @@ SparseMIC<number>::initialize(const SparseMatrix<somenumber> &matrix,
   for (size_type row = 0; row < this->m(); ++row)
     inner_sums[row] = get_rowsum(row);
 
-  for (size_type row = 0; row < this->m(); ++row)
-    {
-      const number temp  = this->begin(row)->value();
-      number       temp1 = 0;
-
-      // work on the lower left part of the matrix. we know
-      // it's symmetric, so we can work with this alone
-      for (typename SparseMatrix<somenumber>::const_iterator p =
-             matrix.begin(row) + 1;
-           (p != matrix.end(row)) && (p->column() < row);
-           ++p)
-        temp1 += p->value() / diag[p->column()] * inner_sums[p->column()];
-
-      Assert(temp - temp1 > 0, ExcStrengthenDiagonalTooSmall());
-      diag[row] = temp - temp1;
-
-      inv_diag[row] = 1.0 / diag[row];
-    }
+  const auto compute_diagonal = [&](const size_type row) {
+    const number temp  = this->begin(row)->value();
+    number       temp1 = 0;
+
+    // work on the lower left part of the matrix. we know
+    // it's symmetric, so we can work with this alone
+    for (typename SparseMatrix<somenumber>::const_iterator p =
+           matrix.begin(row) + 1;
+         (p != matrix.end(row)) && (p->column() < row);
+         ++p)
+      temp1 += p->value() / diag[p->column()] * inner_sums[p->column()];
+
+    Assert(temp - temp1 > 0, ExcStrengthenDiagonalTooSmall());
+    diag[row] = temp - temp1;
+
+    inv_diag[row] = 1.0 / diag[row];
+  };
+
+  // the level schedule describes the dependencies of the rows in the
+  // sparsity pattern of the decomposition. it can only be used here if the
+  // input matrix has the same pattern
+  if (this->lower_level_start.empty() ||
+      &matrix.get_sparsity_pattern() != &this->get_sparsity_pattern())
+    for (size_type row = 0; row < this->m(); ++row)
+      compute_diagonal(row);
+  else
+    this->apply_level_scheduled(this->lower_level_start,
+                                this->lower_level_rows,
+                                compute_diagonal);
 }
 
 
@@ -150,38 +163,50 @@ SparseMIC<number>::vmult(Vector<somenumber>       &dst,
   //
   // Solve (X-L)X{-1}(X-U) x = b in 3 steps:
   dst = src;
-  for (size_type row = 0; row < N; ++row)
-    {
-      // Now: (X-L)u = b
-
-      // get start of this row. skip
-      // the diagonal element
-      for (typename SparseMatrix<number>::const_iterator p =
-             this->begin(row) + 1;
-           (p != this->end(row)) && (p->column() < row);
-           ++p)
-        dst(row) -= p->value() * dst(p->column());
-
-      dst(row) *= inv_diag[row];
-    }
+  const auto forward_row = [&](const size_type row) {
+    // Now: (X-L)u = b
+
+    // get start of this row. skip
+    // the diagonal element
+    for (typename SparseMatrix<number>::const_iterator p = this->begin(row) + 1;
+         (p != this->end(row)) && (p->column() < row);
+         ++p)
+      dst(row) -= p->value() * dst(p->column());
+
+    dst(row) *= inv_diag[row];
+  };
+
+  if (this->lower_level_start.empty())
+    for (size_type row = 0; row < N; ++row)
+      forward_row(row);
+  else
+    this->apply_level_scheduled(this->lower_level_start,
+                                this->lower_level_rows,
+                                forward_row);
 
   // Now: v = Xu
   for (size_type row = 0; row < N; ++row)
     dst(row) *= diag[row];
 
   // x = (X-U)v
-  for (int row = N - 1; row >= 0; --row)
-    {
-      // get end of this row
-      for (typename SparseMatrix<number>::const_iterator p =
-             this->begin(row) + 1;
-           p != this->end(row);
-           ++p)
-        if (p->column() > static_cast<size_type>(row))
-          dst(row) -= p->value() * dst(p->column());
-
-      dst(row) *= inv_diag[row];
-    }
+  const auto backward_row = [&](const size_type row) {
+    // get end of this row
+    for (typename SparseMatrix<number>::const_iterator p = this->begin(row) + 1;
+         p != this->end(row);
+         ++p)
+      if (p->column() > row)
+        dst(row) -= p->value() * dst(p->column());
+
+    dst(row) *= inv_diag[row];
+  };
+
+  if (this->upper_level_start.empty())
+    for (int row = N - 1; row >= 0; --row)
+      backward_row(row);
+  else
+    this->apply_level_scheduled(this->upper_level_start,
+                                this->upper_level_rows,
+                                backward_row);
 }
 
 
@@ -36,6 +36,7 @@
 #include <boost/serialization/split_member.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -46,6 +47,7 @@ DEAL_II_NAMESPACE_OPEN
 #ifndef DOXYGEN
 class SparsityPattern;
 class DynamicSparsityPattern;
+class SparsityPatternBuilder;
 class ChunkSparsityPattern;
 template <typename number>
 class FullMatrix;
@@ -682,6 +684,64 @@ public:
   void
   copy_from(const DynamicSparsityPattern &dsp);
 
+  /**
+   * Copy data from a SparsityPatternBuilder, on which
+   * SparsityPatternBuilder::compress() must have been called. Previous
+   * content of this object is lost, and the sparsity pattern is in compressed
+   * mode afterwards. The entries are copied in parallel.
+   */
+  void
+  copy_from(const SparsityPatternBuilder &builder);
+
+  /**
+   * Set up the sparsity pattern from a function @p generator that adds the
+   * entries to the SparsityPatternBase object it is given, without ever
+   * storing the entries of all rows in an intermediate object.
+   *
+   * The usual way to create a SparsityPattern first collects all entries in a
+   * DynamicSparsityPattern and then copies them into the final object. The
+   * intermediate object typically needs two to three times as much memory as
+   * the final sparsity pattern, which then determines the peak memory
+   * consumption of a program. This function instead splits the rows into
+   * @p n_row_chunks contiguous groups and makes two passes over them. In
+   * the first pass, the @p generator is called once for each group with a
+   * DynamicSparsityPattern that only stores the rows of this group, and the
+   * number of entries in each row is recorded. Then the memory of the final
+   * object is allocated. In the second pass, the @p generator is called again
+   * for each group, and the entries are copied into their final place. The
+   * peak memory consumption is thus that of the final sparsity pattern plus
+   * that of a DynamicSparsityPattern with a fraction of the rows, at the cost
+   * of calling the @p generator <code>2*n_row_chunks</code> times.
+   *
+   * The @p generator must add the same entries every time it is called. Any
+   * function that adds entries to a SparsityPatternBase object can be used,
+   * in particular the functions DoFTools::make_sparsity_pattern() and
+   * DoFTools::make_flux_sparsity_pattern():
+   * @code
+   * SparsityPattern sparsity_pattern;
+   * sparsity_pattern.build_in_row_chunks(
+   *   dof_handler.n_dofs(),
+   *   dof_handler.n_dofs(),
+   *   [&](SparsityPatternBase &dsp) {
+   *     DoFTools::make_flux_sparsity_pattern(dof_handler, dsp, constraints);
+   *   });
+   * @endcode
+   * Constraints must be taken into account by passing an AffineConstraints
+   * object to these functions, which condenses the entries while they are
+   * added. Calling AffineConstraints::condense() on the intermediate object is
+   * not possible, because it would need to add entries to rows outside the
+   * current group.
+   *
+   * Previous content of this object is lost, and the sparsity pattern is in
+   * compressed mode afterwards.
+   */
+  void
+  build_in_row_chunks(
+    const size_type                                   n_rows,
+    const size_type                                   n_cols,
+    const std::function<void(SparsityPatternBase &)> &generator,
+    const unsigned int                                n_row_chunks = 4);
+
   /**
    * Copy data from a SparsityPattern. Previous content of this object is
    * lost, and the sparsity pattern is in compressed mode afterwards.
@@ -0,0 +1,403 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparsity_pattern_builder_h
+#define dealii_sparsity_pattern_builder_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/thread_local_storage.h>
+
+#include <deal.II/lac/sparsity_pattern_base.h>
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Sparsity
+ * @{
+ */
+
+/**
+ * A sparsity pattern that can be filled from several threads at the same
+ * time, and that is then converted into a SparsityPattern in parallel.
+ *
+ * The DynamicSparsityPattern class stores a separate, sorted array of column
+ * indices for every row. This makes it a good general-purpose intermediate
+ * object, but it also means that one small memory allocation is made for
+ * every row, and that entries can only be added by one thread at a time. For
+ * large problems, building the sparsity pattern may then take longer than
+ * the assembly of the matrix.
+ *
+ * This class takes a different approach: every thread that adds entries
+ * appends them as (row, column) pairs to a contiguous buffer that only this
+ * thread writes to. No locks are taken while adding entries except when a
+ * thread adds entries for the first time. Since finite element discretizations
+ * add the same entry from all cells sharing the corresponding degrees of
+ * freedom, each buffer is sorted and duplicates are removed whenever its size
+ * has doubled since the last such step, which keeps the memory consumption
+ * proportional to the number of distinct entries. Once all entries have been
+ * added, compress() sorts the buffers in parallel and merges them into a
+ * compressed row storage, from which SparsityPattern::copy_from() creates the
+ * final sparsity pattern, again in parallel.
+ *
+ * DoFTools::make_sparsity_pattern() recognizes objects of this class and
+ * then loops over the cells of the mesh in parallel using WorkStream.
+ * Typical usage therefore looks as follows:
+ * @code
+ * SparsityPatternBuilder builder(dof_handler.n_dofs(), dof_handler.n_dofs());
+ * DoFTools::make_sparsity_pattern(dof_handler, builder, constraints);
+ * builder.compress();
+ *
+ * SparsityPattern sparsity_pattern;
+ * sparsity_pattern.copy_from(builder);
+ * @endcode
+ * Functions that add entries from several threads on their own, e.g. from
+ * the worker function of WorkStream::run(), may simply call add(),
+ * add_row_entries() or add_entries() concurrently.
+ *
+ * Functions that query the entries of the pattern, such as row_length() or
+ * column_indices(), may only be called after compress(). Entries may not be
+ * added after compress() has been called, unless the object is reset by
+ * reinit().
+ */
+class SparsityPatternBuilder : public SparsityPatternBase
+{
+public:
+  /**
+   * Declare the type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Initialize as an empty object. The object can be made usable by calling
+   * the reinit() function.
+   */
+  SparsityPatternBuilder();
+
+  /**
+   * Initialize a rectangular sparsity pattern with @p m rows and @p n
+   * columns. The @p rowset restricts the storage to elements in rows of this
+   * set. Adding elements outside of this set has no effect. The default
+   * argument keeps all entries.
+   */
+  SparsityPatternBuilder(const size_type m,
+                         const size_type n,
+                         const IndexSet &rowset = IndexSet());
+
+  /**
+   * Since the object may hold the entries added by many threads, copying it
+   * is not allowed.
+   */
+  SparsityPatternBuilder(const SparsityPatternBuilder &) = delete;
+
+  /**
+   * Since the object may hold the entries added by many threads, copying it
+   * is not allowed.
+   */
+  SparsityPatternBuilder &
+  operator=(const SparsityPatternBuilder &) = delete;
+
+  /**
+   * Release all memory and set up data structures for a new sparsity
+   * pattern with @p m rows and @p n columns. The @p rowset restricts the
+   * storage to elements in rows of this set. Adding elements outside of this
+   * set has no effect. The default argument keeps all entries.
+   */
+  void
+  reinit(const size_type m,
+         const size_type n,
+         const IndexSet &rowset = IndexSet());
+
+  /**
+   * Add the nonzero entry (@p i, @p j). This function may be called from
+   * several threads at the same time.
+   */
+  void
+  add(const size_type i, const size_type j);
+
+  /**
+   * Add several nonzero entries to the specified row. This function may be
+   * called from several threads at the same time.
+   */
+  virtual void
+  add_row_entries(const size_type                  &row,
+                  const ArrayView<const size_type> &columns,
+                  const bool indices_are_sorted = false) override;
+
+  /**
+   * Add several nonzero entries given as (row, column) pairs. This function
+   * may be called from several threads at the same time.
+   */
+  virtual void
+  add_entries(
+    const ArrayView<const std::pair<size_type, size_type>> &entries) override;
+
+  /**
+   * Sort the entries added by all threads, remove duplicates, and merge them
+   * into a compressed row storage. The work is done in parallel. This
+   * function must not be called while other threads still add entries.
+   */
+  void
+  compress();
+
+  /**
+   * Return whether compress() has been called since the last call to
+   * reinit().
+   */
+  bool
+  is_compressed() const;
+
+  /**
+   * Return the number of entries in the given row. Rows that are not stored
+   * because they are not part of the row index set passed to the constructor
+   * or reinit() have no entries.
+   *
+   * This function may only be called after compress().
+   */
+  unsigned int
+  row_length(const size_type row) const;
+
+  /**
+   * Return the sorted column indices of the entries in the given row.
+   *
+   * This function may only be called after compress().
+   */
+  ArrayView<const size_type>
+  column_indices(const size_type row) const;
+
+  /**
+   * Return whether the entry (@p i, @p j) is part of the sparsity pattern.
+   *
+   * This function may only be called after compress().
+   */
+  bool
+  exists(const size_type i, const size_type j) const;
+
+  /**
+   * Return the number of nonzero entries of the sparsity pattern.
+   *
+   * This function may only be called after compress().
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the IndexSet that contains the rows stored by this object. If all
+   * rows are stored, an empty IndexSet is returned.
+   */
+  const IndexSet &
+  row_index_set() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception.
+   */
+  DeclExceptionMsg(ExcNotCompressed,
+                   "This operation is only allowed after compress() has been "
+                   "called.");
+
+  /**
+   * Exception.
+   */
+  DeclExceptionMsg(ExcCompressed,
+                   "Entries can not be added after compress() has been called. "
+                   "Call reinit() to start over.");
+
+private:
+  /**
+   * The entries added by a single thread, together with the number of
+   * entries present after the last time the buffer was sorted and
+   * duplicates were removed.
+   */
+  struct ThreadBuffer
+  {
+    std::vector<std::pair<size_type, size_type>> entries;
+    std::size_t                                  n_unique_entries = 0;
+  };
+
+  /**
+   * Return the buffer of the calling thread, creating and registering it if
+   * the thread has not added entries before.
+   */
+  ThreadBuffer &
+  get_thread_buffer();
+
+  /**
+   * Sort the entries of a buffer and remove duplicates if the buffer has
+   * grown to twice the size it had after the last such operation.
+   */
+  static void
+  compact_if_necessary(ThreadBuffer &buffer);
+
+  /**
+   * Return the position of the given row within the rows stored by this
+   * object, or numbers::invalid_dof_index if the row is not stored.
+   */
+  size_type
+  local_row(const size_type row) const;
+
+  /**
+   * The rows stored by this object. Empty if all rows are stored.
+   */
+  IndexSet rowset;
+
+  /**
+   * A pointer to the buffer of each thread that has added entries.
+   */
+  Threads::ThreadLocalStorage<ThreadBuffer *> thread_buffer;
+
+  /**
+   * Ownership of the buffers of all threads, needed to find all of them in
+   * compress().
+   */
+  std::vector<std::unique_ptr<ThreadBuffer>> all_buffers;
+
+  /**
+   * A mutex to guard the registration of a new buffer in all_buffers.
+   */
+  std::mutex buffer_mutex;
+
+  /**
+   * Whether compress() has been called.
+   */
+  bool compressed;
+
+  /**
+   * The position of the first entry of each stored row in colnums, with an
+   * additional entry at the end. Only set up by compress().
+   */
+  std::vector<std::size_t> rowstart;
+
+  /**
+   * The sorted column indices of all stored rows. Only set up by compress().
+   */
+  std::vector<size_type> colnums;
+};
+
+/**
+ * @}
+ */
+
+
+/* ---------------------------- Inline functions ---------------------------- */
+
+#ifndef DOXYGEN
+
+inline SparsityPatternBuilder::size_type
+SparsityPatternBuilder::local_row(const size_type row) const
+{
+  if (rowset.size() == 0)
+    return row;
+  else
+    return rowset.index_within_set(row);
+}
+
+
+
+inline SparsityPatternBuilder::ThreadBuffer &
+SparsityPatternBuilder::get_thread_buffer()
+{
+  bool           exists = false;
+  ThreadBuffer *&buffer = thread_buffer.get(exists);
+  if (!exists || buffer == nullptr)
+    {
+      std::lock_guard<std::mutex> lock(buffer_mutex);
+      all_buffers.emplace_back(std::make_unique<ThreadBuffer>());
+      buffer = all_buffers.back().get();
+    }
+  return *buffer;
+}
+
+
+
+inline void
+SparsityPatternBuilder::add(const size_type i, const size_type j)
+{
+  AssertIndexRange(i, rows);
+  AssertIndexRange(j, cols);
+  Assert(compressed == false, ExcCompressed());
+
+  if (rowset.size() > 0 && !rowset.is_element(i))
+    return;
+
+  ThreadBuffer &buffer = get_thread_buffer();
+  buffer.entries.emplace_back(i, j);
+  compact_if_necessary(buffer);
+}
+
+
+
+inline bool
+SparsityPatternBuilder::is_compressed() const
+{
+  return compressed;
+}
+
+
+
+inline unsigned int
+SparsityPatternBuilder::row_length(const size_type row) const
+{
+  AssertIndexRange(row, rows);
+  Assert(compressed, ExcNotCompressed());
+
+  const size_type local_index = local_row(row);
+  if (local_index == numbers::invalid_dof_index)
+    return 0;
+  return rowstart[local_index + 1] - rowstart[local_index];
+}
+
+
+
+inline ArrayView<const SparsityPatternBuilder::size_type>
+SparsityPatternBuilder::column_indices(const size_type row) const
+{
+  AssertIndexRange(row, rows);
+  Assert(compressed, ExcNotCompressed());
+
+  const size_type local_index = local_row(row);
+  if (local_index == numbers::invalid_dof_index)
+    return {};
+  return make_array_view(colnums.data() + rowstart[local_index],
+                         colnums.data() + rowstart[local_index + 1]);
+}
+
+
+
+inline const IndexSet &
+SparsityPatternBuilder::row_index_set() const
+{
+  return rowset;
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
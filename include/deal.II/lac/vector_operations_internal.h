@@ -18,6 +18,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/memory_space.h>
 #include <deal.II/base/memory_space_data.h>
 #include <deal.II/base/multithread_info.h>
@@ -1460,6 +1461,68 @@ namespace internal
     }
 
 
+
+    /**
+     * Run a fused operation that updates an arbitrary number of vectors and
+     * accumulates @p n_sums sums in a single pass through the index range
+     * [start, end). The operation @p op is called as
+     * <code>op(chunk_start, chunk_end, sums)</code> on non-overlapping
+     * chunks of the range, where <code>sums</code> is an array of
+     * VectorizedArray<Number> objects initialized to zero into which the
+     * operation accumulates its contributions. Chunks are processed in
+     * parallel.
+     *
+     * The range is split into chunks of fixed size, and the sums of the
+     * chunks are combined by pairwise summation in a fixed order. Hence,
+     * the result only depends on the length of the range but not on the
+     * number of threads, like in parallel_reduce().
+     */
+    template <typename Number, std::size_t n_sums, typename Operation>
+    void
+    parallel_fused_reduce(const Operation            &op,
+                          const size_type             start,
+                          const size_type             end,
+                          std::array<Number, n_sums> &result)
+    {
+      using SumType = std::array<VectorizedArray<Number>, n_sums>;
+
+      const size_type chunk_size =
+        internal::VectorImplementation::minimum_parallel_grain_size;
+      const size_type n_chunks = (end - start + chunk_size - 1) / chunk_size;
+
+      SumType sums = {};
+      if (n_chunks == 1)
+        op(start, end, sums);
+      else if (n_chunks > 1)
+        {
+          AlignedVector<SumType> chunk_sums(n_chunks);
+          ::dealii::parallel::apply_to_subranges(
+            static_cast<size_type>(0),
+            n_chunks,
+            [&](const size_type first_chunk, const size_type last_chunk) {
+              for (size_type c = first_chunk; c < last_chunk; ++c)
+                op(start + c * chunk_size,
+                   std::min(start + (c + 1) * chunk_size, end),
+                   chunk_sums[c]);
+            },
+            1);
+
+          for (size_type stride = 1; stride < n_chunks; stride *= 2)
+            for (size_type c = 0; c + stride < n_chunks; c += 2 * stride)
+              for (std::size_t i = 0; i < n_sums; ++i)
+                chunk_sums[c][i] += chunk_sums[c + stride][i];
+          sums = chunk_sums[0];
+        }
+
+      for (std::size_t i = 0; i < n_sums; ++i)
+        {
+          result[i] = sums[i][0];
+          for (unsigned int v = 1; v < VectorizedArray<Number>::size(); ++v)
+            result[i] += sums[i][v];
+        }
+    }
+
+
     template <typename Number, typename Number2, typename MemorySpace>
     struct functions
     {
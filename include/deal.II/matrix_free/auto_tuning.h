@@ -0,0 +1,449 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_matrix_free_auto_tuning_h
+#define dealii_matrix_free_auto_tuning_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/base/types.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace MatrixFreeTools
+{
+  /**
+   * A cache for the settings of MatrixFree::AdditionalData selected by
+   * MatrixFreeTools::auto_tune(), which can be written to and read from a
+   * file in order to reuse the result of the tuning in later runs of a
+   * program.
+   *
+   * The entries are identified by a key that describes the processor, the
+   * polynomial degree and the size of the problem, see create_key(). The
+   * file format is plain text with one entry per line.
+   *
+   * @ingroup matrixfree
+   */
+  class AutoTuningCache
+  {
+  public:
+    /**
+     * The run-time settings of MatrixFree::AdditionalData considered by the
+     * tuning, together with the measured time of one operator evaluation.
+     */
+    struct Settings
+    {
+      /**
+       * The value of MatrixFree::AdditionalData::tasks_parallel_scheme,
+       * converted to an integer.
+       */
+      unsigned int tasks_parallel_scheme = 0;
+
+      /**
+       * The value of MatrixFree::AdditionalData::tasks_block_size.
+       */
+      unsigned int tasks_block_size = 0;
+
+      /**
+       * The value of
+       * MatrixFree::AdditionalData::overlap_communication_computation.
+       */
+      bool overlap_communication_computation = true;
+
+      /**
+       * The value of MatrixFree::AdditionalData::fuse_cell_and_face_loops.
+       */
+      bool fuse_cell_and_face_loops = false;
+
+      /**
+       * The value of
+       * MatrixFree::AdditionalData::compute_jacobians_on_the_fly.
+       */
+      bool compute_jacobians_on_the_fly = false;
+
+      /**
+       * The measured wall time in seconds of one application of the operator
+       * with these settings, taking the maximum over all MPI processes.
+       */
+      double time = 0.;
+    };
+
+    /**
+     * Constructor. Creates an empty cache.
+     */
+    AutoTuningCache() = default;
+
+    /**
+     * Constructor. Reads the entries from the file @p filename if it
+     * exists, see load().
+     */
+    explicit AutoTuningCache(const std::string &filename);
+
+    /**
+     * Read the entries from the file @p filename and add them to the
+     * cache, replacing entries with the same key. If the file does not
+     * exist, the cache is left unchanged.
+     */
+    void
+    load(const std::string &filename);
+
+    /**
+     * Write all entries of the cache to the file @p filename. When running
+     * with MPI, all processes hold the same entries after auto_tune(), so
+     * this function is typically only called on one of them.
+     */
+    void
+    save(const std::string &filename) const;
+
+    /**
+     * Return the settings stored for @p key, or an empty object if there is
+     * no such entry.
+     */
+    std::optional<Settings>
+    find(const std::string &key) const;
+
+    /**
+     * Store @p settings for @p key, replacing a previous entry.
+     */
+    void
+    insert(const std::string &key, const Settings &settings);
+
+    /**
+     * Return the number of entries of the cache.
+     */
+    std::size_t
+    size() const;
+
+    /**
+     * Create a key for the cache. The key combines the model name of the
+     * processor, the number of threads and MPI processes, the dimension, the
+     * polynomial degree, the size of the problem rounded to a power of two,
+     * as well as the number of lanes and the size of the number type of the
+     * VectorizedArray type, such that the settings found for different
+     * vectorization widths and precisions can be kept in the same cache.
+     */
+    static std::string
+    create_key(const unsigned int            dim,
+               const unsigned int            degree,
+               const types::global_dof_index n_dofs,
+               const unsigned int            n_lanes,
+               const unsigned int            bytes_per_number,
+               const unsigned int            n_mpi_processes);
+
+    /**
+     * Exception.
+     */
+    DeclException2(ExcInvalidCacheEntry,
+                   std::string,
+                   std::string,
+                   << "The line <" << arg2 << "> of the file " << arg1
+                   << " is not a valid entry of an auto-tuning cache.");
+
+  private:
+    /**
+     * The entries of the cache.
+     */
+    std::map<std::string, Settings> entries;
+  };
+
+
+
+  /**
+   * Select the run-time settings of MatrixFree::AdditionalData that give the
+   * fastest evaluation of the operator @p op on the current machine. The
+   * settings considered are
+   * MatrixFree::AdditionalData::tasks_parallel_scheme together with
+   * MatrixFree::AdditionalData::tasks_block_size if more than one thread is
+   * available, MatrixFree::AdditionalData::overlap_communication_computation
+   * if more than one MPI process is involved,
+   * MatrixFree::AdditionalData::fuse_cell_and_face_loops if face integrals
+   * are set up, and MatrixFree::AdditionalData::compute_jacobians_on_the_fly
+   * if the mesh contains cells with non-affine geometry. All other fields
+   * are taken from @p additional_data.
+   *
+   * The function @p reinit must set up @p matrix_free with the given
+   * additional data, e.g., by calling MatrixFree::reinit() with the mapping,
+   * DoFHandler, constraints, and quadrature formula of the application, and
+   * initialize @p op with the result. For each candidate setting, this
+   * function calls @p reinit, applies the operator @p n_warmup times to let
+   * the caches and the memory allocation settle, and then measures the
+   * average time of @p n_iterations applications of <code>op.vmult()</code>.
+   * For operators derived from MatrixFreeOperators::Base, this measures the
+   * time of MatrixFreeOperators::Base::apply_add() plus the handling of
+   * constraints. Since the candidates that are not used are set up in vain,
+   * the tuning is only worthwhile if the operator is applied many times.
+   * At the end, @p reinit is called with the fastest setting, such that
+   * @p matrix_free and @p op are ready for use, and the corresponding
+   * additional data is returned. When running with MPI, the maximal time
+   * over all processes is compared, so all processes select the same
+   * setting.
+   *
+   * If a @p cache is given, the settings are looked up in the cache with the
+   * key created by AutoTuningCache::create_key() from the first DoFHandler
+   * of @p matrix_free. If an entry exists, no measurements are taken.
+   * Otherwise, the result of the tuning is added to the cache. When running
+   * with MPI, the lookup is done in the cache of the process with rank zero
+   * in the communicator of @p matrix_free, and the settings found there are
+   * sent to and stored in the caches of all other processes, so that all
+   * processes take the same decision even if their caches differ. A cache
+   * must therefore be given either on all processes or on none of them.
+   *
+   * The width of the VectorizedArray type and the precision are
+   * compile-time parameters of MatrixFree and can therefore not be selected
+   * by this function. Since the key includes these parameters, the times
+   * stored in the same cache for different instantiations of the operator
+   * can be compared in order to make that choice.
+   *
+   * @tparam OperatorType A class that provides the functions
+   * <code>initialize_dof_vector(VectorType &)</code> and
+   * <code>vmult(VectorType &, const VectorType &)</code>, such as the
+   * classes derived from MatrixFreeOperators::Base.
+   *
+   * @tparam VectorType The type of the vectors the operator is applied to.
+   * As this type can not be deduced from the arguments, it needs to be
+   * specified explicitly for vectors other than
+   * LinearAlgebra::distributed::Vector.
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename OperatorType,
+            typename VectorType = LinearAlgebra::distributed::Vector<Number>>
+  typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+  auto_tune(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const OperatorType                                 &op,
+    const std::function<void(
+      const typename MatrixFree<dim, Number, VectorizedArrayType>::
+        AdditionalData &)>                                       &reinit,
+    const typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+                      &additional_data,
+    AutoTuningCache   *cache        = nullptr,
+    const unsigned int n_iterations = 10,
+    const unsigned int n_warmup     = 2);
+
+
+
+#ifndef DOXYGEN
+
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename OperatorType,
+            typename VectorType>
+  typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+  auto_tune(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const OperatorType                                 &op,
+    const std::function<void(
+      const typename MatrixFree<dim, Number, VectorizedArrayType>::
+        AdditionalData &)>                                       &reinit,
+    const typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+                      &additional_data,
+    AutoTuningCache   *cache,
+    const unsigned int n_iterations,
+    const unsigned int n_warmup)
+  {
+    using AdditionalData =
+      typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData;
+    using Settings = AutoTuningCache::Settings;
+
+    AssertThrow(n_iterations > 0, ExcMessage("Need at least one iteration."));
+
+    const auto apply_settings = [&additional_data](const Settings &settings) {
+      AdditionalData data = additional_data;
+      data.tasks_parallel_scheme =
+        static_cast<typename AdditionalData::TasksParallelScheme>(
+          settings.tasks_parallel_scheme);
+      data.tasks_block_size = settings.tasks_block_size;
+      data.overlap_communication_computation =
+        settings.overlap_communication_computation;
+      data.fuse_cell_and_face_loops     = settings.fuse_cell_and_face_loops;
+      data.compute_jacobians_on_the_fly = settings.compute_jacobians_on_the_fly;
+      return data;
+    };
+
+    Settings initial_settings;
+    initial_settings.tasks_parallel_scheme =
+      static_cast<unsigned int>(additional_data.tasks_parallel_scheme);
+    initial_settings.tasks_block_size = additional_data.tasks_block_size;
+    initial_settings.overlap_communication_computation =
+      additional_data.overlap_communication_computation;
+    initial_settings.fuse_cell_and_face_loops =
+      additional_data.fuse_cell_and_face_loops;
+    initial_settings.compute_jacobians_on_the_fly =
+      additional_data.compute_jacobians_on_the_fly;
+
+    // set up the data structures once with the given settings, which we need
+    // to know the problem size for the key of the cache and the geometry of
+    // the cells
+    reinit(additional_data);
+
+    const MPI_Comm     comm = matrix_free.get_task_info().communicator;
+    const unsigned int n_mpi_processes = Utilities::MPI::n_mpi_processes(comm);
+
+    std::string key;
+    if (cache != nullptr)
+      {
+        const DoFHandler<dim> &dof_handler = matrix_free.get_dof_handler(0);
+        key                                = AutoTuningCache::create_key(
+          dim,
+          dof_handler.get_fe().degree,
+          dof_handler.n_dofs(),
+          VectorizedArrayType::size(),
+          sizeof(typename VectorizedArrayType::value_type),
+          n_mpi_processes);
+
+        // all processes must take the same decision, so use the entry of
+        // the first process, whose cache might differ from the others
+        std::optional<Settings> settings;
+        if (Utilities::MPI::this_mpi_process(comm) == 0)
+          settings = cache->find(key);
+        if (Utilities::MPI::broadcast(comm, settings.has_value(), 0))
+          {
+            const Settings root_settings =
+              Utilities::MPI::broadcast(comm, settings.value_or(Settings()), 0);
+            cache->insert(key, root_settings);
+            const AdditionalData data = apply_settings(root_settings);
+            reinit(data);
+            return data;
+          }
+      }
+
+    // collect the candidate settings, starting with the given ones
+    std::vector<Settings> candidates;
+    const auto add_candidate = [&candidates](const Settings &settings) {
+      for (const Settings &other : candidates)
+        if (other.tasks_parallel_scheme == settings.tasks_parallel_scheme &&
+            other.tasks_block_size == settings.tasks_block_size &&
+            other.overlap_communication_computation ==
+              settings.overlap_communication_computation &&
+            other.fuse_cell_and_face_loops ==
+              settings.fuse_cell_and_face_loops &&
+            other.compute_jacobians_on_the_fly ==
+              settings.compute_jacobians_on_the_fly)
+          return;
+      candidates.push_back(settings);
+    };
+    add_candidate(initial_settings);
+
+    std::vector<std::pair<unsigned int, unsigned int>> task_settings;
+    task_settings.emplace_back(AdditionalData::none, 0);
+    if (MultithreadInfo::n_threads() > 1)
+      {
+        const unsigned int block_size =
+          std::max(1U, matrix_free.get_task_info().block_size);
+        for (const unsigned int scheme : {AdditionalData::partition_partition,
+                                          AdditionalData::partition_color,
+                                          AdditionalData::color})
+          for (const unsigned int size :
+               {0U, std::max(1U, block_size / 2), 2 * block_size})
+            task_settings.emplace_back(scheme, size);
+      }
+
+    const bool has_faces =
+      (additional_data.mapping_update_flags_inner_faces |
+       additional_data.mapping_update_flags_boundary_faces) != update_default;
+    const std::vector<internal::MatrixFreeFunctions::GeometryType> &cell_type =
+      matrix_free.get_mapping_info().cell_type;
+    const bool has_general_cells = Utilities::MPI::logical_or(
+      std::find(cell_type.begin(),
+                cell_type.end(),
+                internal::MatrixFreeFunctions::general) != cell_type.end(),
+      comm);
+
+    for (const auto &[scheme, block_size] : task_settings)
+      for (const bool overlap : {true, false})
+        for (const bool fuse : {false, true})
+          for (const bool on_the_fly : {false, true})
+            {
+              if ((!overlap && n_mpi_processes == 1) ||
+                  (fuse && (!has_faces || scheme != AdditionalData::none)) ||
+                  (on_the_fly && !has_general_cells))
+                continue;
+
+              Settings settings;
+              settings.tasks_parallel_scheme             = scheme;
+              settings.tasks_block_size                  = block_size;
+              settings.overlap_communication_computation = overlap;
+              settings.fuse_cell_and_face_loops          = fuse;
+              settings.compute_jacobians_on_the_fly      = on_the_fly;
+              add_candidate(settings);
+            }
+
+    // measure the time of the operator evaluation for each candidate. The
+    // vectors are set up again for each candidate because the layout of the
+    // ghost entries may depend on the settings.
+    for (unsigned int c = 0; c < candidates.size(); ++c)
+      {
+        if (c > 0)
+          reinit(apply_settings(candidates[c]));
+
+        VectorType src, dst;
+        op.initialize_dof_vector(src);
+        op.initialize_dof_vector(dst);
+        src = Number(1.);
+
+        for (unsigned int i = 0; i < n_warmup; ++i)
+          op.vmult(dst, src);
+
+        Timer timer(comm, true);
+        for (unsigned int i = 0; i < n_iterations; ++i)
+          op.vmult(dst, src);
+        timer.stop();
+
+        candidates[c].time =
+          Utilities::MPI::max(timer.wall_time(), comm) / n_iterations;
+      }
+
+    const Settings &best =
+      *std::min_element(candidates.begin(),
+                        candidates.end(),
+                        [](const Settings &a, const Settings &b) {
+                          return a.time < b.time;
+                        });
+
+    if (cache != nullptr)
+      cache->insert(key, best);
+
+    const AdditionalData data = apply_settings(best);
+    if (candidates.size() > 1)
+      reinit(data);
+    return data;
+  }
+
+#endif // DOXYGEN
+
+} // namespace MatrixFreeTools
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
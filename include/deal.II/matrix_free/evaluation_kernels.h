@@ -158,6 +158,88 @@ namespace internal
 
 
 
+  /**
+   * Evaluation and integration of elements on wedges whose shape functions
+   * and quadrature points have the product structure described in
+   * MatrixFreeFunctions::WedgeShapeData. The degrees of freedom are first
+   * interpolated along the line direction for all triangle shape functions
+   * at once, and then on the triangle for each layer of quadrature points
+   * along the line; integration performs the transpose operations in
+   * reverse order.
+   *
+   * The degrees of freedom are given in the numbering of the element, the
+   * values in the quadrature points as <code>n_q_points</code> entries per
+   * component and the gradients as three consecutive entries per quadrature
+   * point, the same layout as used for MatrixFreeFunctions::tensor_none.
+   * The array @p scratch must hold at least
+   * <code>n_dofs + 2 * n_q_points_line * n_dofs_triangle</code> entries.
+   */
+  template <typename Number, typename Number2>
+  struct FEEvaluationImplWedge
+  {
+    static void
+    evaluate(const MatrixFreeFunctions::WedgeShapeData<Number2> &data,
+             const unsigned int                                  n_components,
+             const EvaluationFlags::EvaluationFlags evaluation_flag,
+             const Number                          *values_dofs,
+             Number                                *values_quad,
+             Number                                *gradients_quad,
+             Number                                *scratch);
+
+    static void
+    integrate(const MatrixFreeFunctions::WedgeShapeData<Number2> &data,
+              const unsigned int                                  n_components,
+              const EvaluationFlags::EvaluationFlags integration_flag,
+              Number                                *values_dofs,
+              const Number                          *values_quad,
+              const Number                          *gradients_quad,
+              Number                                *scratch,
+              const bool                             add_into_values_array);
+  };
+
+
+
+  /**
+   * Evaluation and integration of elements on triangles, tetrahedra and
+   * pyramids in collapsed coordinates as described in
+   * MatrixFreeFunctions::CollapsedShapeData. The degrees of freedom are first
+   * transformed to the coefficients of the modal basis, which are then
+   * interpolated along the third, the second, and the first collapsed
+   * coordinate, where each step sums over one index of the modal basis.
+   * Derivatives with respect to the collapsed coordinates are transformed to
+   * the reference coordinates in each quadrature point. Integration performs
+   * the transpose operations in reverse order.
+   *
+   * The layout of the data is the same as for FEEvaluationImplWedge, with
+   * <code>dim</code> entries per quadrature point for the gradients. The
+   * array @p scratch must hold at least
+   * MatrixFreeFunctions::CollapsedShapeData::scratch_size entries.
+   */
+  template <int dim, typename Number, typename Number2>
+  struct FEEvaluationImplCollapsed
+  {
+    static void
+    evaluate(const MatrixFreeFunctions::CollapsedShapeData<Number2> &data,
+             const unsigned int                     n_components,
+             const EvaluationFlags::EvaluationFlags evaluation_flag,
+             const Number                          *values_dofs,
+             Number                                *values_quad,
+             Number                                *gradients_quad,
+             Number                                *scratch);
+
+    static void
+    integrate(const MatrixFreeFunctions::CollapsedShapeData<Number2> &data,
+              const unsigned int                     n_components,
+              const EvaluationFlags::EvaluationFlags integration_flag,
+              Number                                *values_dofs,
+              const Number                          *values_quad,
+              const Number                          *gradients_quad,
+              Number                                *scratch,
+              const bool                             add_into_values_array);
+  };
+
+
+
   /**
    * Specialization for MatrixFreeFunctions::tensor_none, which cannot use the
    * sum-factorization kernels.
@@ -608,6 +690,465 @@ namespace internal
 
 
 
+  template <typename Number, typename Number2>
+  inline void
+  FEEvaluationImplWedge<Number, Number2>::evaluate(
+    const MatrixFreeFunctions::WedgeShapeData<Number2> &data,
+    const unsigned int                                  n_components,
+    const EvaluationFlags::EvaluationFlags              evaluation_flag,
+    const Number                                       *values_dofs,
+    Number                                             *values_quad,
+    Number                                             *gradients_quad,
+    Number                                             *scratch)
+  {
+    const unsigned int n_dofs_tri = data.n_dofs_triangle;
+    const unsigned int n_dofs_1d  = data.n_dofs_line;
+    const unsigned int n_q_tri    = data.n_q_points_triangle;
+    const unsigned int n_q_1d     = data.n_q_points_line;
+    const unsigned int n_dofs     = n_dofs_tri * n_dofs_1d;
+    const unsigned int n_q_points = n_q_tri * n_q_1d;
+
+    const bool evaluate_values = evaluation_flag & EvaluationFlags::values;
+    const bool evaluate_gradients =
+      evaluation_flag & EvaluationFlags::gradients;
+
+    const Number2 *shape_values_tri    = data.triangle_values.data();
+    const Number2 *shape_gradients_tri = data.triangle_gradients.data();
+    const Number2 *shape_values_1d     = data.line_values.data();
+    const Number2 *shape_gradients_1d  = data.line_gradients.data();
+
+    Number *dofs         = scratch;
+    Number *values_1d    = scratch + n_dofs;
+    Number *gradients_1d = values_1d + n_q_1d * n_dofs_tri;
+
+    for (unsigned int c = 0; c < n_components; ++c)
+      {
+        for (unsigned int i = 0; i < n_dofs; ++i)
+          dofs[i] = values_dofs[c * n_dofs + data.dof_numbering[i]];
+
+        // interpolate along the line for all triangle shape functions
+        for (unsigned int q1 = 0; q1 < n_q_1d; ++q1)
+          for (unsigned int t = 0; t < n_dofs_tri; ++t)
+            {
+              Number value = Number(), gradient = Number();
+              for (unsigned int l = 0; l < n_dofs_1d; ++l)
+                {
+                  value += shape_values_1d[l * n_q_1d + q1] *
+                           dofs[l * n_dofs_tri + t];
+                  if (evaluate_gradients)
+                    gradient += shape_gradients_1d[l * n_q_1d + q1] *
+                                dofs[l * n_dofs_tri + t];
+                }
+              values_1d[q1 * n_dofs_tri + t] = value;
+              if (evaluate_gradients)
+                gradients_1d[q1 * n_dofs_tri + t] = gradient;
+            }
+
+        // interpolate on the triangle in each layer of quadrature points
+        Number *values    = values_quad + c * n_q_points;
+        Number *gradients = gradients_quad + c * 3 * n_q_points;
+        for (unsigned int q1 = 0; q1 < n_q_1d; ++q1)
+          for (unsigned int qt = 0; qt < n_q_tri; ++qt)
+            {
+              const unsigned int q = q1 * n_q_tri + qt;
+
+              Number value = Number(), gradient_x = Number(),
+                     gradient_y = Number(), gradient_z = Number();
+              for (unsigned int t = 0; t < n_dofs_tri; ++t)
+                {
+                  const Number2 shape    = shape_values_tri[t * n_q_tri + qt];
+                  const Number  value_1d = values_1d[q1 * n_dofs_tri + t];
+                  value += shape * value_1d;
+                  if (evaluate_gradients)
+                    {
+                      gradient_x +=
+                        shape_gradients_tri[(t * n_q_tri + qt) * 2] * value_1d;
+                      gradient_y +=
+                        shape_gradients_tri[(t * n_q_tri + qt) * 2 + 1] *
+                        value_1d;
+                      gradient_z += shape * gradients_1d[q1 * n_dofs_tri + t];
+                    }
+                }
+              if (evaluate_values)
+                values[q] = value;
+              if (evaluate_gradients)
+                {
+                  gradients[q * 3]     = gradient_x;
+                  gradients[q * 3 + 1] = gradient_y;
+                  gradients[q * 3 + 2] = gradient_z;
+                }
+            }
+      }
+  }
+
+
+
+  template <typename Number, typename Number2>
+  inline void
+  FEEvaluationImplWedge<Number, Number2>::integrate(
+    const MatrixFreeFunctions::WedgeShapeData<Number2> &data,
+    const unsigned int                                  n_components,
+    const EvaluationFlags::EvaluationFlags              integration_flag,
+    Number                                             *values_dofs,
+    const Number                                       *values_quad,
+    const Number                                       *gradients_quad,
+    Number                                             *scratch,
+    const bool                                          add_into_values_array)
+  {
+    const unsigned int n_dofs_tri = data.n_dofs_triangle;
+    const unsigned int n_dofs_1d  = data.n_dofs_line;
+    const unsigned int n_q_tri    = data.n_q_points_triangle;
+    const unsigned int n_q_1d     = data.n_q_points_line;
+    const unsigned int n_dofs     = n_dofs_tri * n_dofs_1d;
+    const unsigned int n_q_points = n_q_tri * n_q_1d;
+
+    const bool integrate_values = integration_flag & EvaluationFlags::values;
+    const bool integrate_gradients =
+      integration_flag & EvaluationFlags::gradients;
+
+    const Number2 *shape_values_tri    = data.triangle_values.data();
+    const Number2 *shape_gradients_tri = data.triangle_gradients.data();
+    const Number2 *shape_values_1d     = data.line_values.data();
+    const Number2 *shape_gradients_1d  = data.line_gradients.data();
+
+    Number *dofs         = scratch;
+    Number *values_1d    = scratch + n_dofs;
+    Number *gradients_1d = values_1d + n_q_1d * n_dofs_tri;
+
+    for (unsigned int c = 0; c < n_components; ++c)
+      {
+        // test with the triangle shape functions in each layer of quadrature
+        // points
+        const Number *values    = values_quad + c * n_q_points;
+        const Number *gradients = gradients_quad + c * 3 * n_q_points;
+        for (unsigned int q1 = 0; q1 < n_q_1d; ++q1)
+          for (unsigned int t = 0; t < n_dofs_tri; ++t)
+            {
+              Number value = Number(), gradient = Number();
+              for (unsigned int qt = 0; qt < n_q_tri; ++qt)
+                {
+                  const unsigned int q     = q1 * n_q_tri + qt;
+                  const Number2      shape = shape_values_tri[t * n_q_tri + qt];
+                  if (integrate_values)
+                    value += shape * values[q];
+                  if (integrate_gradients)
+                    {
+                      value +=
+                        shape_gradients_tri[(t * n_q_tri + qt) * 2] *
+                          gradients[q * 3] +
+                        shape_gradients_tri[(t * n_q_tri + qt) * 2 + 1] *
+                          gradients[q * 3 + 1];
+                      gradient += shape * gradients[q * 3 + 2];
+                    }
+                }
+              values_1d[q1 * n_dofs_tri + t] = value;
+              if (integrate_gradients)
+                gradients_1d[q1 * n_dofs_tri + t] = gradient;
+            }
+
+        // test with the line shape functions
+        for (unsigned int l = 0; l < n_dofs_1d; ++l)
+          for (unsigned int t = 0; t < n_dofs_tri; ++t)
+            {
+              Number value = Number();
+              for (unsigned int q1 = 0; q1 < n_q_1d; ++q1)
+                {
+                  value += shape_values_1d[l * n_q_1d + q1] *
+                           values_1d[q1 * n_dofs_tri + t];
+                  if (integrate_gradients)
+                    value += shape_gradients_1d[l * n_q_1d + q1] *
+                             gradients_1d[q1 * n_dofs_tri + t];
+                }
+              dofs[l * n_dofs_tri + t] = value;
+            }
+
+        Number *out = values_dofs + c * n_dofs;
+        if (add_into_values_array)
+          for (unsigned int i = 0; i < n_dofs; ++i)
+            out[data.dof_numbering[i]] += dofs[i];
+        else
+          for (unsigned int i = 0; i < n_dofs; ++i)
+            out[data.dof_numbering[i]] = dofs[i];
+      }
+  }
+
+
+
+  template <int dim, typename Number, typename Number2>
+  inline void
+  FEEvaluationImplCollapsed<dim, Number, Number2>::evaluate(
+    const MatrixFreeFunctions::CollapsedShapeData<Number2> &data,
+    const unsigned int                                      n_components,
+    const EvaluationFlags::EvaluationFlags                  evaluation_flag,
+    const Number                                           *values_dofs,
+    Number                                                 *values_quad,
+    Number                                                 *gradients_quad,
+    Number                                                 *scratch)
+  {
+    const unsigned int n_dofs     = data.n_dofs;
+    const unsigned int n_q_a      = data.n_q_points_1d[0];
+    const unsigned int n_q_b      = data.n_q_points_1d[1];
+    const unsigned int n_q_c      = data.n_q_points_1d[2];
+    const unsigned int n_modes_a  = data.n_modes_a;
+    const unsigned int n_pairs    = data.mode_start.size() - 1;
+    const unsigned int n_q_points = n_q_a * n_q_b * n_q_c;
+
+    const bool evaluate_values = evaluation_flag & EvaluationFlags::values;
+    const bool evaluate_gradients =
+      evaluation_flag & EvaluationFlags::gradients;
+
+    Number *modes            = scratch;
+    Number *sum_c            = modes + n_dofs;
+    Number *sum_c_gradient   = sum_c + n_pairs * n_q_c;
+    Number *sum_b            = sum_c_gradient + n_pairs * n_q_c;
+    Number *sum_b_gradient_b = sum_b + n_modes_a * n_q_b * n_q_c;
+    Number *sum_b_gradient_c = sum_b_gradient_b + n_modes_a * n_q_b * n_q_c;
+
+    for (unsigned int comp = 0; comp < n_components; ++comp)
+      {
+        // transform to the coefficients of the modal basis
+        const Number *dofs = values_dofs + comp * n_dofs;
+        for (unsigned int m = 0; m < n_dofs; ++m)
+          {
+            Number sum = Number();
+            for (unsigned int i = 0; i < n_dofs; ++i)
+              sum += data.nodal_to_modal[m * n_dofs + i] * dofs[i];
+            modes[m] = sum;
+          }
+
+        // sum over the modal index of the third coordinate
+        for (unsigned int s = 0; s < n_pairs; ++s)
+          for (unsigned int k = 0; k < n_q_c; ++k)
+            {
+              Number value = Number(), gradient = Number();
+              for (unsigned int m = data.mode_start[s];
+                   m < data.mode_start[s + 1];
+                   ++m)
+                {
+                  value += data.values_c[m * n_q_c + k] * modes[m];
+                  if (dim == 3 && evaluate_gradients)
+                    gradient += data.gradients_c[m * n_q_c + k] * modes[m];
+                }
+              sum_c[s * n_q_c + k]          = value;
+              sum_c_gradient[s * n_q_c + k] = gradient;
+            }
+
+        // sum over the modal index of the second coordinate
+        for (unsigned int p = 0; p < n_modes_a; ++p)
+          for (unsigned int k = 0; k < n_q_c; ++k)
+            for (unsigned int j = 0; j < n_q_b; ++j)
+              {
+                Number value = Number(), gradient_b = Number(),
+                       gradient_c = Number();
+                for (unsigned int s = data.pair_start[p];
+                     s < data.pair_start[p + 1];
+                     ++s)
+                  {
+                    const Number2 shape = data.values_b[s * n_q_b + j];
+                    value += shape * sum_c[s * n_q_c + k];
+                    if (evaluate_gradients)
+                      {
+                        gradient_b += data.gradients_b[s * n_q_b + j] *
+                                      sum_c[s * n_q_c + k];
+                        gradient_c += shape * sum_c_gradient[s * n_q_c + k];
+                      }
+                  }
+                const unsigned int index = (p * n_q_c + k) * n_q_b + j;
+                sum_b[index]             = value;
+                sum_b_gradient_b[index]  = gradient_b;
+                sum_b_gradient_c[index]  = gradient_c;
+              }
+
+        // sum over the modal index of the first coordinate and transform the
+        // derivatives to the reference coordinates
+        Number *values    = values_quad + comp * n_q_points;
+        Number *gradients = gradients_quad + comp * dim * n_q_points;
+        for (unsigned int k = 0, t = 0; k < n_q_c; ++k)
+          for (unsigned int j = 0; j < n_q_b; ++j)
+            for (unsigned int i = 0; i < n_q_a; ++i, ++t)
+              {
+                Number value = Number(), gradient_a = Number(),
+                       gradient_b = Number(), gradient_c = Number();
+                for (unsigned int p = 0; p < n_modes_a; ++p)
+                  {
+                    const unsigned int index = (p * n_q_c + k) * n_q_b + j;
+                    const Number2      shape = data.values_a[p * n_q_a + i];
+                    value += shape * sum_b[index];
+                    if (evaluate_gradients)
+                      {
+                        gradient_a +=
+                          data.gradients_a[p * n_q_a + i] * sum_b[index];
+                        gradient_b += shape * sum_b_gradient_b[index];
+                        gradient_c += shape * sum_b_gradient_c[index];
+                      }
+                  }
+
+                const unsigned int q = data.quadrature_numbering[t];
+                if (evaluate_values)
+                  values[q] = value;
+                if (evaluate_gradients)
+                  {
+                    const Number2 *transform =
+                      data.derivative_transform.data() + t * dim * dim;
+                    for (unsigned int d = 0; d < dim; ++d)
+                      {
+                        Number gradient = transform[d * dim] * gradient_a +
+                                          transform[d * dim + 1] * gradient_b;
+                        if (dim == 3)
+                          gradient += transform[d * dim + 2] * gradient_c;
+                        gradients[q * dim + d] = gradient;
+                      }
+                  }
+              }
+      }
+  }
+
+
+
+  template <int dim, typename Number, typename Number2>
+  inline void
+  FEEvaluationImplCollapsed<dim, Number, Number2>::integrate(
+    const MatrixFreeFunctions::CollapsedShapeData<Number2> &data,
+    const unsigned int                                      n_components,
+    const EvaluationFlags::EvaluationFlags                  integration_flag,
+    Number                                                 *values_dofs,
+    const Number                                           *values_quad,
+    const Number                                           *gradients_quad,
+    Number                                                 *scratch,
+    const bool add_into_values_array)
+  {
+    const unsigned int n_dofs     = data.n_dofs;
+    const unsigned int n_q_a      = data.n_q_points_1d[0];
+    const unsigned int n_q_b      = data.n_q_points_1d[1];
+    const unsigned int n_q_c      = data.n_q_points_1d[2];
+    const unsigned int n_modes_a  = data.n_modes_a;
+    const unsigned int n_pairs    = data.mode_start.size() - 1;
+    const unsigned int n_q_points = n_q_a * n_q_b * n_q_c;
+
+    const bool integrate_values = integration_flag & EvaluationFlags::values;
+    const bool integrate_gradients =
+      integration_flag & EvaluationFlags::gradients;
+
+    Number *modes            = scratch;
+    Number *sum_c            = modes + n_dofs;
+    Number *sum_c_gradient   = sum_c + n_pairs * n_q_c;
+    Number *sum_b            = sum_c_gradient + n_pairs * n_q_c;
+    Number *sum_b_gradient_b = sum_b + n_modes_a * n_q_b * n_q_c;
+    Number *sum_b_gradient_c = sum_b_gradient_b + n_modes_a * n_q_b * n_q_c;
+    Number *line_values      = sum_b_gradient_c + n_modes_a * n_q_b * n_q_c;
+    Number *line_gradients   = line_values + n_q_a;
+
+    for (unsigned int comp = 0; comp < n_components; ++comp)
+      {
+        // transform the derivatives to the collapsed coordinates and test
+        // with the functions of the first coordinate, one line of quadrature
+        // points at a time
+        const Number *values    = values_quad + comp * n_q_points;
+        const Number *gradients = gradients_quad + comp * dim * n_q_points;
+        for (unsigned int k = 0; k < n_q_c; ++k)
+          for (unsigned int j = 0; j < n_q_b; ++j)
+            {
+              for (unsigned int i = 0; i < n_q_a; ++i)
+                {
+                  const unsigned int t = (k * n_q_b + j) * n_q_a + i;
+                  const unsigned int q = data.quadrature_numbering[t];
+                  line_values[i] = integrate_values ? values[q] : Number();
+                  if (integrate_gradients)
+                    {
+                      const Number2 *transform =
+                        data.derivative_transform.data() + t * dim * dim;
+                      for (unsigned int e = 0; e < dim; ++e)
+                        {
+                          Number gradient = transform[e] * gradients[q * dim];
+                          for (unsigned int d = 1; d < dim; ++d)
+                            gradient +=
+                              transform[d * dim + e] * gradients[q * dim + d];
+                          line_gradients[e * n_q_a + i] = gradient;
+                        }
+                    }
+                }
+
+              for (unsigned int p = 0; p < n_modes_a; ++p)
+                {
+                  Number value = Number(), gradient_b = Number(),
+                         gradient_c = Number();
+                  for (unsigned int i = 0; i < n_q_a; ++i)
+                    {
+                      const Number2 shape = data.values_a[p * n_q_a + i];
+                      value += shape * line_values[i];
+                      if (integrate_gradients)
+                        {
+                          value +=
+                            data.gradients_a[p * n_q_a + i] * line_gradients[i];
+                          gradient_b += shape * line_gradients[n_q_a + i];
+                          if (dim == 3)
+                            gradient_c +=
+                              shape * line_gradients[2 * n_q_a + i];
+                        }
+                    }
+                  const unsigned int index = (p * n_q_c + k) * n_q_b + j;
+                  sum_b[index]             = value;
+                  sum_b_gradient_b[index]  = gradient_b;
+                  sum_b_gradient_c[index]  = gradient_c;
+                }
+            }
+
+        // test with the functions of the second coordinate
+        for (unsigned int p = 0; p < n_modes_a; ++p)
+          for (unsigned int s = data.pair_start[p]; s < data.pair_start[p + 1];
+               ++s)
+            for (unsigned int k = 0; k < n_q_c; ++k)
+              {
+                Number value = Number(), gradient = Number();
+                for (unsigned int j = 0; j < n_q_b; ++j)
+                  {
+                    const unsigned int index = (p * n_q_c + k) * n_q_b + j;
+                    const Number2      shape = data.values_b[s * n_q_b + j];
+                    value += shape * sum_b[index];
+                    if (integrate_gradients)
+                      {
+                        value += data.gradients_b[s * n_q_b + j] *
+                                 sum_b_gradient_b[index];
+                        gradient += shape * sum_b_gradient_c[index];
+                      }
+                  }
+                sum_c[s * n_q_c + k]          = value;
+                sum_c_gradient[s * n_q_c + k] = gradient;
+              }
+
+        // test with the functions of the third coordinate
+        for (unsigned int s = 0; s < n_pairs; ++s)
+          for (unsigned int m = data.mode_start[s]; m < data.mode_start[s + 1];
+               ++m)
+            {
+              Number value = Number();
+              for (unsigned int k = 0; k < n_q_c; ++k)
+                {
+                  value += data.values_c[m * n_q_c + k] * sum_c[s * n_q_c + k];
+                  if (dim == 3 && integrate_gradients)
+                    value += data.gradients_c[m * n_q_c + k] *
+                             sum_c_gradient[s * n_q_c + k];
+                }
+              modes[m] = value;
+            }
+
+        // transform back from the coefficients of the modal basis
+        Number *dofs = values_dofs + comp * n_dofs;
+        for (unsigned int i = 0; i < n_dofs; ++i)
+          {
+            Number sum = Number();
+            for (unsigned int m = 0; m < n_dofs; ++m)
+              sum += data.nodal_to_modal[m * n_dofs + i] * modes[m];
+            if (add_into_values_array)
+              dofs[i] += sum;
+            else
+              dofs[i] = sum;
+          }
+      }
+  }
+
+
+
   template <int dim, int fe_degree, int n_q_points_1d, typename Number>
   inline void
   FEEvaluationImpl<
@@ -631,6 +1172,39 @@ namespace internal
     using Number2 =
       typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
 
+    const auto &wedge_data = fe_eval.get_shape_info().wedge_data;
+    if (wedge_data.is_initialized())
+      {
+        AssertIndexRange(n_dofs + 2 * wedge_data.n_q_points_line *
+                                    wedge_data.n_dofs_triangle,
+                         fe_eval.get_scratch_data().size() + 1);
+        FEEvaluationImplWedge<Number, Number2>::evaluate(
+          wedge_data,
+          n_components,
+          evaluation_flag,
+          values_dofs_actual,
+          fe_eval.begin_values(),
+          fe_eval.begin_gradients(),
+          fe_eval.get_scratch_data().begin());
+        return;
+      }
+
+    const auto &collapsed_data = fe_eval.get_shape_info().collapsed_data;
+    if (collapsed_data.is_initialized())
+      {
+        AssertIndexRange(collapsed_data.scratch_size,
+                         fe_eval.get_scratch_data().size() + 1);
+        FEEvaluationImplCollapsed<dim, Number, Number2>::evaluate(
+          collapsed_data,
+          n_components,
+          evaluation_flag,
+          values_dofs_actual,
+          fe_eval.begin_values(),
+          fe_eval.begin_gradients(),
+          fe_eval.get_scratch_data().begin());
+        return;
+      }
+
     if (evaluation_flag & EvaluationFlags::values)
       {
         const auto *const shape_values = shape_data.front().shape_values.data();
@@ -748,6 +1322,41 @@ namespace internal
     using Number2 =
       typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
 
+    const auto &wedge_data = fe_eval.get_shape_info().wedge_data;
+    if (wedge_data.is_initialized())
+      {
+        AssertIndexRange(n_dofs + 2 * wedge_data.n_q_points_line *
+                                    wedge_data.n_dofs_triangle,
+                         fe_eval.get_scratch_data().size() + 1);
+        FEEvaluationImplWedge<Number, Number2>::integrate(
+          wedge_data,
+          n_components,
+          integration_flag,
+          values_dofs_actual,
+          fe_eval.begin_values(),
+          fe_eval.begin_gradients(),
+          fe_eval.get_scratch_data().begin(),
+          add_into_values_array);
+        return;
+      }
+
+    const auto &collapsed_data = fe_eval.get_shape_info().collapsed_data;
+    if (collapsed_data.is_initialized())
+      {
+        AssertIndexRange(collapsed_data.scratch_size,
+                         fe_eval.get_scratch_data().size() + 1);
+        FEEvaluationImplCollapsed<dim, Number, Number2>::integrate(
+          collapsed_data,
+          n_components,
+          integration_flag,
+          values_dofs_actual,
+          fe_eval.begin_values(),
+          fe_eval.begin_gradients(),
+          fe_eval.get_scratch_data().begin(),
+          add_into_values_array);
+        return;
+      }
+
     if (integration_flag & EvaluationFlags::values)
       {
         const auto *const shape_values = shape_data.front().shape_values.data();
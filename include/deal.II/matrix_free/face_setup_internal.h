@@ -29,6 +29,7 @@
 #include <deal.II/matrix_free/shape_info.h>
 #include <deal.II/matrix_free/task_info.h>
 
+#include <algorithm>
 #include <fstream>
 #include <set>
 
@@ -150,6 +151,21 @@ namespace internal
 
 
 
+    /**
+     * Sort the batches of interior and boundary faces within each partition
+     * of @p task_info by the last cell batch they are attached to, and set up
+     * the steps of the loop that interleaves the work on cells and faces,
+     * with @p n_batches_per_step cell batches in each step.
+     */
+    template <int vectorization_width>
+    void
+    setup_fused_cell_face_loop(
+      const unsigned int                                    n_batches_per_step,
+      std::vector<FaceToCellTopology<vectorization_width>> &faces,
+      TaskInfo                                             &task_info);
+
+
+
     /* -------------------------------------------------------------------- */
 
 #ifndef DOXYGEN
@@ -1441,6 +1457,96 @@ namespace internal
         }
     }
 
+
+
+    template <int vectorization_width>
+    void
+    setup_fused_cell_face_loop(
+      const unsigned int                                    n_batches_per_step,
+      std::vector<FaceToCellTopology<vectorization_width>> &faces,
+      TaskInfo                                             &task_info)
+    {
+      Assert(n_batches_per_step > 0, ExcInternalError());
+      AssertDimension(task_info.face_partition_data.size(),
+                      task_info.boundary_partition_data.size());
+
+      // Faces are processed after the last of the locally owned cell
+      // batches they are attached to; ghost cells do not participate in the
+      // loop
+      const unsigned int n_cell_batches =
+        *(task_info.cell_partition_data.end() - 2);
+      const auto last_cell_batch =
+        [n_cell_batches](
+          const FaceToCellTopology<vectorization_width> &face) {
+          unsigned int last = 0;
+          for (unsigned int v = 0; v < vectorization_width; ++v)
+            for (const unsigned int cell :
+                 {face.cells_interior[v], face.cells_exterior[v]})
+              if (cell < n_cell_batches * vectorization_width)
+                last = std::max(last, cell / vectorization_width);
+          return last;
+        };
+      const auto sort_faces = [&](const unsigned int begin,
+                                  const unsigned int end) {
+        std::stable_sort(
+          faces.begin() + begin,
+          faces.begin() + end,
+          [&](const FaceToCellTopology<vectorization_width> &face1,
+              const FaceToCellTopology<vectorization_width> &face2) {
+            return last_cell_batch(face1) < last_cell_batch(face2);
+          });
+      };
+
+      std::vector<unsigned int> &ptr  = task_info.fused_partition_data_ptr;
+      std::vector<unsigned int> &data = task_info.fused_partition_data;
+      ptr.assign(1, 0);
+      data.clear();
+      for (unsigned int partition = 0;
+           partition < task_info.face_partition_data.size() - 1;
+           ++partition)
+        {
+          const unsigned int cell_begin =
+            task_info.cell_partition_data[partition];
+          const unsigned int cell_end =
+            task_info.cell_partition_data[partition + 1];
+          const unsigned int face_end =
+            task_info.face_partition_data[partition + 1];
+          const unsigned int boundary_end =
+            task_info.boundary_partition_data[partition + 1];
+          unsigned int face     = task_info.face_partition_data[partition];
+          unsigned int boundary = task_info.boundary_partition_data[partition];
+          sort_faces(face, face_end);
+          sort_faces(boundary, boundary_end);
+
+          for (unsigned int cell = cell_begin; cell < cell_end;
+               cell += n_batches_per_step)
+            {
+              // the last step of a partition also picks up the faces
+              // postponed from earlier partitions during vectorization
+              const unsigned int step_end =
+                std::min(cell + n_batches_per_step, cell_end);
+              const bool last_step = (step_end == cell_end);
+              while (face < face_end &&
+                     (last_step || last_cell_batch(faces[face]) < step_end))
+                ++face;
+              while (boundary < boundary_end &&
+                     (last_step ||
+                      last_cell_batch(faces[boundary]) < step_end))
+                ++boundary;
+              data.push_back(step_end);
+              data.push_back(face);
+              data.push_back(boundary);
+            }
+          if (face < face_end || boundary < boundary_end)
+            {
+              data.push_back(cell_end);
+              data.push_back(face_end);
+              data.push_back(boundary_end);
+            }
+          ptr.push_back(data.size() / 3);
+        }
+    }
+
 #endif // ifndef DOXYGEN
 
   } // namespace MatrixFreeFunctions
@@ -1796,6 +1796,18 @@ private:
   void
   check_template_arguments(const unsigned int fe_no,
                            const unsigned int first_selected_component);
+
+  /**
+   * Compute the inverse Jacobians and JxW values on all quadrature points
+   * of the current cell batch from the support points of the mapping with
+   * sum factorization, and let the pointers to the geometry data point to
+   * the result. Used if
+   * MatrixFree::AdditionalData::compute_jacobians_on_the_fly is set. The data
+   * is placed behind the scratch data, in the memory allocated by
+   * FEEvaluationData::set_data_pointers().
+   */
+  void
+  compute_jacobians_on_the_fly();
 };
 
 
@@ -6496,6 +6508,120 @@ FEEvaluation<dim,
 
 
 
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          int n_components_,
+          typename Number,
+          typename VectorizedArrayType>
+inline void
+FEEvaluation<dim,
+             fe_degree,
+             n_q_points_1d,
+             n_components_,
+             Number,
+             VectorizedArrayType>::compute_jacobians_on_the_fly()
+{
+  const internal::MatrixFreeFunctions::
+    MappingInfoStorage<dim, dim, VectorizedArrayType> &mapping_data =
+      *this->mapping_data;
+  Assert(mapping_data.jacobians_on_the_fly(), ExcInternalError());
+  AssertIndexRange(this->cell,
+                   mapping_data.mapping_support_point_offsets.size());
+
+  const unsigned int n_q_points_1d_mapping =
+    mapping_data.descriptor[0].quadrature_1d.size();
+  const unsigned int n_points_1d_mapping =
+    mapping_data.mapping_shape_values.size() / n_q_points_1d_mapping;
+  const unsigned int n_max_1d =
+    std::max(n_q_points_1d_mapping, n_points_1d_mapping);
+  const unsigned int n_max = Utilities::fixed_power<dim>(n_max_1d);
+  const unsigned int n_points =
+    Utilities::fixed_power<dim>(n_points_1d_mapping);
+  const unsigned int n_q = this->n_quadrature_points;
+  AssertDimension(n_q, Utilities::fixed_power<dim>(n_q_points_1d_mapping));
+
+  // the layout of the memory behind the scratch data is: inverse Jacobians,
+  // JxW values, the components of the Jacobians, and four temporary arrays
+  // for the sum factorization
+  static_assert(sizeof(Tensor<2, dim, VectorizedArrayType>) ==
+                  dim * dim * sizeof(VectorizedArrayType),
+                "Unexpected padding in Tensor type");
+  VectorizedArrayType *inverse_jacobians =
+    this->scratch_data.data() + this->scratch_data.size();
+  VectorizedArrayType *JxW_values = inverse_jacobians + dim * dim * n_q;
+  VectorizedArrayType *jacobians  = JxW_values + n_q;
+  VectorizedArrayType *tmp0       = jacobians + dim * dim * n_q;
+  VectorizedArrayType *tmp1       = tmp0 + n_max;
+  VectorizedArrayType *tmp2       = tmp1 + n_max;
+  VectorizedArrayType *tmp3       = tmp2 + n_max;
+
+  const VectorizedArrayType *points =
+    mapping_data.mapping_support_points.data() +
+    mapping_data.mapping_support_point_offsets[this->cell];
+
+  using Eval = internal::EvaluatorTensorProduct<
+    internal::evaluate_general,
+    dim,
+    0,
+    0,
+    VectorizedArrayType,
+    typename VectorizedArrayType::value_type>;
+  const Eval eval(mapping_data.mapping_shape_values.data(),
+                  mapping_data.mapping_shape_gradients.data(),
+                  nullptr,
+                  n_points_1d_mapping,
+                  n_q_points_1d_mapping);
+
+  // entry (d,e) of the Jacobian is the derivative of the coordinate d of the
+  // mapping in the unit coordinate direction e, which we compute direction
+  // by direction, using derivatives in direction e and values in the others
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      const VectorizedArrayType *in  = points + d * n_points;
+      VectorizedArrayType       *out = jacobians + d * dim * n_q;
+      if constexpr (dim == 1)
+        eval.template gradients<0, true, false>(in, out);
+      else if constexpr (dim == 2)
+        {
+          eval.template values<0, true, false>(in, tmp0);
+          eval.template gradients<0, true, false>(in, tmp1);
+          eval.template values<1, true, false>(tmp1, out);
+          eval.template gradients<1, true, false>(tmp0, out + n_q);
+        }
+      else if constexpr (dim == 3)
+        {
+          eval.template values<0, true, false>(in, tmp0);
+          eval.template gradients<0, true, false>(in, tmp1);
+          eval.template values<1, true, false>(tmp1, tmp2);
+          eval.template values<2, true, false>(tmp2, out);
+          eval.template gradients<1, true, false>(tmp0, tmp3);
+          eval.template values<2, true, false>(tmp3, out + n_q);
+          eval.template values<1, true, false>(tmp0, tmp2);
+          eval.template gradients<2, true, false>(tmp2, out + 2 * n_q);
+        }
+      else
+        DEAL_II_NOT_IMPLEMENTED();
+    }
+
+  Tensor<2, dim, VectorizedArrayType> *inverse_jacobian_tensors =
+    reinterpret_cast<Tensor<2, dim, VectorizedArrayType> *>(inverse_jacobians);
+  for (unsigned int q = 0; q < n_q; ++q)
+    {
+      Tensor<2, dim, VectorizedArrayType> jac;
+      for (unsigned int d = 0; d < dim; ++d)
+        for (unsigned int e = 0; e < dim; ++e)
+          jac[d][e] = jacobians[(d * dim + e) * n_q + q];
+      JxW_values[q] = determinant(jac) * this->quadrature_weights[q];
+      inverse_jacobian_tensors[q] = transpose(invert(jac));
+    }
+
+  this->jacobian = inverse_jacobian_tensors;
+  this->J_value  = JxW_values;
+}
+
+
+
 template <int dim,
           int fe_degree,
           int n_q_points_1d,
@@ -6522,8 +6648,14 @@ FEEvaluation<dim,
 
   const unsigned int offsets =
     this->mapping_data->data_index_offsets[cell_index];
-  this->jacobian = &this->mapping_data->jacobians[0][offsets];
-  this->J_value  = &this->mapping_data->JxW_values[offsets];
+  if (this->cell_type > internal::MatrixFreeFunctions::affine &&
+      this->mapping_data->jacobians_on_the_fly())
+    compute_jacobians_on_the_fly();
+  else
+    {
+      this->jacobian = &this->mapping_data->jacobians[0][offsets];
+      this->J_value  = &this->mapping_data->JxW_values[offsets];
+    }
   if (!this->mapping_data->jacobian_gradients[0].empty())
     {
       this->jacobian_gradients =
@@ -6602,6 +6734,11 @@ FEEvaluation<dim,
                    cell_index / n_lanes));
     }
 
+  Assert(this->cell_type <= internal::MatrixFreeFunctions::affine ||
+           !this->mapping_data->jacobians_on_the_fly(),
+         ExcMessage("Computing the Jacobians on the fly is not implemented "
+                    "for arbitrary arrays of cells."));
+
   // allocate memory for internal data storage
   if (this->mapped_geometry == nullptr)
     this->mapped_geometry =
@@ -1204,18 +1204,41 @@ FEEvaluationData<dim, Number, is_face>::set_data_pointers(
     Utilities::fixed_power<dim>(data->data.front().fe_degree + 1);
   const unsigned int dofs_per_component = data->dofs_per_component_on_cell;
 
+  // the factorized evaluation of elements on simplices and pyramids works on
+  // one component at a time but might need more temporary storage for a
+  // single component, see MatrixFreeFunctions::CollapsedShapeData
   const unsigned int size_scratch_data =
-    std::max(tensor_dofs_per_component + 1, dofs_per_component) * n_components *
-      3 +
-    2 * n_quadrature_points;
+    std::max(std::max(tensor_dofs_per_component + 1, dofs_per_component) *
+                 n_components * 3 +
+               2 * n_quadrature_points,
+             data->collapsed_data.scratch_size);
   const unsigned int size_data_arrays =
     n_components * dofs_per_component +
     (n_components * ((dim * (dim + 1)) / 2 + 2 * dim + 2) *
      n_quadrature_points);
 
+  // in case the Jacobians of the cells are computed on the fly, we place the
+  // inverse Jacobians, JxW values, and the temporary arrays for their
+  // computation behind the scratch data, see
+  // FEEvaluation::compute_jacobians_on_the_fly()
+  unsigned int size_geometry_data = 0;
+  if (!is_face && mapping_data != nullptr &&
+      mapping_data->jacobians_on_the_fly())
+    {
+      const unsigned int n_q_points_1d =
+        mapping_data->descriptor[0].quadrature_1d.size();
+      const unsigned int n_max_1d =
+        std::max<unsigned int>(n_q_points_1d,
+                               mapping_data->mapping_shape_values.size() /
+                                 n_q_points_1d);
+      size_geometry_data = (2 * dim * dim + 1) * n_quadrature_points +
+                           4 * Utilities::fixed_power<dim>(n_max_1d);
+    }
+
   // include 12 extra fields to insert some padding between values, gradients
   // and hessians, which helps to reduce the probability of cache conflicts
-  const unsigned int allocated_size = size_scratch_data + size_data_arrays + 12;
+  const unsigned int allocated_size =
+    size_scratch_data + size_data_arrays + 12 + size_geometry_data;
   if constexpr (running_in_debug_mode())
     {
       scratch_data_array->clear();
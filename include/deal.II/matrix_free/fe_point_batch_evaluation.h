@@ -0,0 +1,1013 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_fe_point_batch_evaluation_h
+#define dealii_fe_point_batch_evaluation_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe.h>
+#include <deal.II/fe/mapping.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector_element_access.h>
+
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+#include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_point_kernels.h>
+
+#include <deal.II/non_matching/mapping_info.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace internal
+{
+  namespace FEPointEvaluation
+  {
+    /**
+     * A type trait to identify vectors whose entries can be accessed through
+     * an index into the local storage, given a Utilities::MPI::Partitioner.
+     */
+    template <typename VectorType>
+    struct HasPartitioner : std::false_type
+    {};
+
+    template <typename Number>
+    struct HasPartitioner<
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+      : std::true_type
+    {};
+  } // namespace FEPointEvaluation
+} // namespace internal
+
+
+
+/**
+ * A variant of FEPointEvaluation that vectorizes the evaluation of finite
+ * element solutions at arbitrary points across several cells.
+ *
+ * FEPointEvaluation operates on one cell at a time and applies SIMD
+ * instructions over the points given on that cell. In particle simulations
+ * or immersed boundary methods, a cell often only contains a few points, such
+ * that most lanes of the VectorizedArray batches stay idle. This class
+ * instead takes the points of a whole range of cells in reinit() and packs
+ * them into batches of VectorizedArray::size() points, irrespective of the
+ * cell they belong to. For each batch, the degrees of freedom of the cells
+ * of the individual lanes are gathered from a global vector into
+ * VectorizedArray data fields, in the same way as FEEvaluation vectorizes
+ * across cells, and the tensor product kernels of
+ * tensor_product_point_kernels.h evaluate all points of the batch at once.
+ * The transposed operations integrate() and test_and_sum() add the results
+ * directly into a global vector.
+ *
+ * The points are numbered by running through the cells passed to reinit()
+ * and through the points of each cell, and the access functions
+ * get_value(), get_gradient(), submit_value(), and submit_gradient() use
+ * this numbering. A typical use in a particle simulation looks as follows,
+ * where `solution` has its ghost values set and `rhs` is compressed after
+ * the loop:
+ * @code
+ * FEPointBatchEvaluation<1, dim> evaluator(mapping, fe, update_values);
+ *
+ * std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+ * std::vector<std::vector<Point<dim>>>                        unit_points;
+ * for (auto particle = particle_handler.begin();
+ *      particle != particle_handler.end();)
+ *   {
+ *     const auto cell = particle->get_surrounding_cell();
+ *     cells.push_back(cell->as_dof_handler_iterator(dof_handler));
+ *     unit_points.emplace_back();
+ *     for (const auto &p : particle_handler.particles_in_cell(cell))
+ *       unit_points.back().push_back(p.get_reference_location());
+ *     particle = particle_handler.particles_in_cell(cell).end();
+ *   }
+ *
+ * evaluator.reinit(cells, unit_points);
+ * evaluator.evaluate(solution, EvaluationFlags::values);
+ * for (const unsigned int q : evaluator.quadrature_point_indices())
+ *   evaluator.submit_value(evaluator.get_value(q), q);
+ * evaluator.test_and_sum(rhs, EvaluationFlags::values);
+ * rhs.compress(VectorOperation::add);
+ * @endcode
+ *
+ * The class reads from and writes to the entries of the global vector
+ * associated with the degrees of freedom of each cell without resolving
+ * constraints, i.e., it behaves like DoFCellAccessor::get_dof_values() and
+ * DoFCellAccessor::distribute_local_to_global() without AffineConstraints
+ * argument. Constraints need to be applied to the vector afterwards, e.g.,
+ * with AffineConstraints::distribute() or AffineConstraints::condense().
+ *
+ * The geometry is computed by an NonMatching::MappingInfo object owned by this
+ * class, so all mappings are supported. On the other hand, the class only
+ * implements the fast path of FEPointEvaluation, i.e., it requires that the
+ * selected components of the finite element come from a single base element
+ * with tensor product shape functions, such as FE_Q or FE_DGQ, possibly
+ * wrapped in an FESystem. For other elements, use FEPointEvaluation.
+ *
+ * @tparam n_components_ Number of vector components when representing the
+ * solution.
+ *
+ * @tparam dim Dimension of the cells.
+ *
+ * @tparam spacedim Dimension of the space the cells are embedded in.
+ *
+ * @tparam Number The scalar number type of the values at the points and of
+ * the vectors. Unlike FEPointEvaluation, the vectorization is always done
+ * internally, so only the scalar types `double` and `float` are allowed.
+ *
+ * @ingroup matrixfree
+ */
+template <int n_components_,
+          int dim,
+          int spacedim    = dim,
+          typename Number = double>
+class FEPointBatchEvaluation
+{
+public:
+  static_assert(std::is_same_v<Number, double> || std::is_same_v<Number, float>,
+                "This class is only implemented for double and float.");
+
+  static constexpr unsigned int dimension    = dim;
+  static constexpr unsigned int n_components = n_components_;
+
+  using number_type = Number;
+
+  using ETT = typename internal::FEPointEvaluation::
+    EvaluatorTypeTraits<dim, spacedim, n_components, Number>;
+  using ScalarNumber          = typename ETT::ScalarNumber;
+  using VectorizedArrayType   = typename ETT::VectorizedArrayType;
+  using value_type            = typename ETT::value_type;
+  using vectorized_value_type = typename ETT::vectorized_value_type;
+  using gradient_type         = typename ETT::real_gradient_type;
+
+  /**
+   * Constructor.
+   *
+   * @param mapping The Mapping class describing the geometry of the cells
+   * passed to reinit().
+   *
+   * @param fe The FiniteElement object that is used for the evaluation,
+   * which must be the same on all cells.
+   *
+   * @param update_flags Specify the quantities to be computed by the mapping
+   * during the call of reinit(), such as `update_gradients` if gradients of
+   * the solution are needed, or `update_JxW_values` for integrate().
+   *
+   * @param first_selected_component For multi-component FiniteElement
+   * objects, this parameter allows to select a range of `n_components`
+   * components starting from this parameter.
+   */
+  FEPointBatchEvaluation(const Mapping<dim, spacedim>       &mapping,
+                         const FiniteElement<dim, spacedim> &fe,
+                         const UpdateFlags                   update_flags,
+                         const unsigned int first_selected_component = 0);
+
+  /**
+   * Set up the evaluator for the points @p unit_points, given in reference
+   * coordinates of the respective entry of @p cells, which must be active
+   * cells of a DoFHandler that uses the finite element passed to the
+   * constructor. The points are packed into batches across the cells, and
+   * the values of the shape functions and the mapping data at the points are
+   * computed.
+   */
+  void
+  reinit(
+    const std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+                                               &cells,
+    const std::vector<std::vector<Point<dim>>> &unit_points);
+
+  /**
+   * Same as above, but with a quadrature formula on each cell. This variant
+   * is needed for integrate(), which multiplies by the quadrature weights.
+   */
+  void
+  reinit(
+    const std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+                                       &cells,
+    const std::vector<Quadrature<dim>> &quadratures);
+
+  /**
+   * Interpolate the finite element function represented by @p solution at
+   * all points passed to reinit(). The vector entries associated with all
+   * cells passed to reinit() must be accessible, i.e., for
+   * LinearAlgebra::distributed::Vector, the ghost values need to be
+   * up to date.
+   */
+  template <typename VectorType>
+  void
+  evaluate(const VectorType                       &solution,
+           const EvaluationFlags::EvaluationFlags &evaluation_flags);
+
+  /**
+   * Multiply the quantities passed in by previous submit_value() or
+   * submit_gradient() calls by the value or gradient of the test functions
+   * and by the Jacobian determinant times the quadrature weight, and add the
+   * result to @p destination. For LinearAlgebra::distributed::Vector, the
+   * contributions to ghost entries need to be sent to their owners by
+   * LinearAlgebra::distributed::Vector::compress() with
+   * VectorOperation::add afterwards.
+   */
+  template <typename VectorType>
+  void
+  integrate(VectorType                             &destination,
+            const EvaluationFlags::EvaluationFlags &integration_flags);
+
+  /**
+   * Same as integrate(), but without multiplication by the Jacobian
+   * determinant and the quadrature weight, see
+   * FEPointEvaluation::test_and_sum().
+   */
+  template <typename VectorType>
+  void
+  test_and_sum(VectorType                             &destination,
+               const EvaluationFlags::EvaluationFlags &integration_flags);
+
+  /**
+   * Return the value at the point with index @p point_index after a call to
+   * evaluate() with EvaluationFlags::values set, or the value that has been
+   * stored there with a call to submit_value().
+   */
+  const value_type &
+  get_value(const unsigned int point_index) const;
+
+  /**
+   * Write a value to the field containing the values at the point with index
+   * @p point_index, which is then tested by integrate() or test_and_sum()
+   * with EvaluationFlags::values set.
+   */
+  void
+  submit_value(const value_type &value, const unsigned int point_index);
+
+  /**
+   * Return the gradient in real coordinates at the point with index
+   * @p point_index after a call to evaluate() with EvaluationFlags::gradients
+   * set, or the gradient that has been stored there with a call to
+   * submit_gradient().
+   */
+  const gradient_type &
+  get_gradient(const unsigned int point_index) const;
+
+  /**
+   * Write a gradient in real coordinates to the field containing the
+   * gradients at the point with index @p point_index, which is then tested by
+   * integrate() or test_and_sum() with EvaluationFlags::gradients set.
+   */
+  void
+  submit_gradient(const gradient_type &gradient,
+                  const unsigned int   point_index);
+
+  /**
+   * Return the Jacobian determinant multiplied by the quadrature weight at
+   * the point with index @p point_index. Requires `update_JxW_values` and
+   * that reinit() was called with quadrature formulas.
+   */
+  Number
+  JxW(const unsigned int point_index) const;
+
+  /**
+   * Return the position in real coordinates of the point with index
+   * @p point_index.
+   */
+  Point<spacedim, Number>
+  quadrature_point(const unsigned int point_index) const;
+
+  /**
+   * Return the number of points passed to the last call of reinit().
+   */
+  unsigned int
+  n_points() const;
+
+  /**
+   * Return an object that can be thought of as an array containing all
+   * indices from zero to n_points(). This allows to write code using
+   * range-based for loops.
+   */
+  std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+  quadrature_point_indices() const;
+
+  /**
+   * Exception.
+   */
+  DeclExceptionMsg(ExcElementNotSupported,
+                   "FEPointBatchEvaluation only supports the selected "
+                   "components of a single base element with tensor product "
+                   "shape functions. Use FEPointEvaluation instead.");
+
+private:
+  /**
+   * Shared part of the two reinit() functions after the mapping data has
+   * been computed.
+   */
+  void
+  finish_reinit(
+    const std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+      &cells);
+
+  /**
+   * Compute the indices into the local storage of the vectors with the
+   * given partitioner, if they are not yet available.
+   */
+  void
+  prepare_local_dof_indices(
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner);
+
+  /**
+   * Gather the unknowns of the cells of all lanes of batch @p batch from
+   * @p solution into solution_vectorized.
+   */
+  template <typename VectorType>
+  void
+  gather(const VectorType &solution, const unsigned int batch);
+
+  /**
+   * Add the contents of solution_vectorized for the cells of all filled
+   * lanes of batch @p batch into @p destination.
+   */
+  template <typename VectorType>
+  void
+  scatter_add(VectorType &destination, const unsigned int batch) const;
+
+  /**
+   * Implementation of integrate() and test_and_sum().
+   */
+  template <bool do_JxW, typename VectorType>
+  void
+  do_integrate(VectorType                             &destination,
+               const EvaluationFlags::EvaluationFlags &integration_flags);
+
+  static constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  /**
+   * Pointer to the FiniteElement object passed to the constructor.
+   */
+  ObserverPointer<const FiniteElement<dim, spacedim>> fe;
+
+  /**
+   * The geometry data at the points.
+   */
+  NonMatching::MappingInfo<dim, spacedim, Number> mapping_info;
+
+  /**
+   * The update flags passed to the constructor.
+   */
+  const UpdateFlags update_flags;
+
+  /**
+   * The 1d polynomials of the tensor product shape functions.
+   */
+  std::vector<Polynomials::Polynomial<double>> poly;
+
+  /**
+   * Renumbering from the lexicographic numbering of the tensor product
+   * shape functions to the numbering of the unknowns of the finite element,
+   * empty if both coincide.
+   */
+  std::vector<unsigned int> renumber;
+
+  /**
+   * Number of unknowns per component of the selected base element.
+   */
+  unsigned int dofs_per_component;
+
+  /**
+   * The first selected component within the base element.
+   */
+  unsigned int component_in_base_element;
+
+  /**
+   * The global indices of the unknowns of all cells passed to reinit().
+   */
+  std::vector<types::global_dof_index> dof_indices;
+
+  /**
+   * The indices of the unknowns of all cells passed to reinit() into the
+   * local storage of vectors with the partitioner
+   * @p local_dof_indices_partitioner. Filled on first use.
+   */
+  std::vector<unsigned int> local_dof_indices;
+
+  /**
+   * The partitioner @p local_dof_indices refers to.
+   */
+  std::shared_ptr<const Utilities::MPI::Partitioner>
+    local_dof_indices_partitioner;
+
+  /**
+   * The index of the cell among the cells passed to reinit() for each
+   * point.
+   */
+  std::vector<unsigned int> point_cell;
+
+  /**
+   * The position of the data of each point in the arrays of mapping_info.
+   */
+  std::vector<unsigned int> point_data_offset;
+
+  /**
+   * The position of the inverse Jacobian of each point in the arrays of
+   * mapping_info, accounting for the compressed storage on affine cells.
+   */
+  std::vector<unsigned int> point_jacobian_offset;
+
+  /**
+   * The values of the 1d polynomials and their derivatives at the points of
+   * all batches, with `poly.size()` entries per batch.
+   */
+  AlignedVector<dealii::ndarray<VectorizedArrayType, 2, dim>> shapes;
+
+  /**
+   * Temporary array for the unknowns of the cells of one batch in
+   * lexicographic order, with the unknowns of one cell in each lane.
+   */
+  AlignedVector<vectorized_value_type> solution_vectorized;
+
+  /**
+   * The values at the points.
+   */
+  std::vector<value_type> values;
+
+  /**
+   * The gradients in real coordinates at the points.
+   */
+  std::vector<gradient_type> gradients;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <int n_components_, int dim, int spacedim, typename Number>
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::
+  FEPointBatchEvaluation(const Mapping<dim, spacedim>       &mapping,
+                         const FiniteElement<dim, spacedim> &fe,
+                         const UpdateFlags                   update_flags,
+                         const unsigned int first_selected_component)
+  : fe(&fe)
+  , mapping_info(mapping, update_flags)
+  , update_flags(update_flags)
+  , dofs_per_component(0)
+  , component_in_base_element(0)
+{
+  AssertIndexRange(first_selected_component + n_components,
+                   fe.n_components() + 1);
+
+  unsigned int base_element_number = 0;
+  bool         same_base_element   = true;
+  for (unsigned int component = 0; base_element_number < fe.n_base_elements();
+       ++base_element_number)
+    if (component + fe.element_multiplicity(base_element_number) >
+        first_selected_component)
+      {
+        if (first_selected_component + n_components >
+            component + fe.element_multiplicity(base_element_number))
+          same_base_element = false;
+        component_in_base_element = first_selected_component - component;
+        break;
+      }
+    else
+      component += fe.element_multiplicity(base_element_number);
+
+  AssertThrow(same_base_element &&
+                internal::FEPointEvaluation::is_fast_path_supported(
+                  fe, base_element_number),
+              ExcElementNotSupported());
+
+  internal::MatrixFreeFunctions::ShapeInfo<ScalarNumber> shape_info;
+  shape_info.reinit(QMidpoint<1>(), fe, base_element_number);
+  renumber           = shape_info.lexicographic_numbering;
+  dofs_per_component = shape_info.dofs_per_component_on_cell;
+  poly               = internal::FEPointEvaluation::get_polynomial_space(
+    fe.base_element(base_element_number));
+
+  bool is_lexicographic = true;
+  for (unsigned int i = 0; i < renumber.size(); ++i)
+    if (i != renumber[i])
+      is_lexicographic = false;
+  if (is_lexicographic)
+    renumber.clear();
+
+  solution_vectorized.resize(dofs_per_component);
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::reinit(
+  const std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+                                             &cells,
+  const std::vector<std::vector<Point<dim>>> &unit_points)
+{
+  mapping_info.reinit_cells(cells, unit_points);
+  finish_reinit(cells);
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::reinit(
+  const std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+                                     &cells,
+  const std::vector<Quadrature<dim>> &quadratures)
+{
+  mapping_info.reinit_cells(cells, quadratures);
+  finish_reinit(cells);
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::finish_reinit(
+  const std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+    &cells)
+{
+  const unsigned int n_cells       = cells.size();
+  const unsigned int dofs_per_cell = fe->n_dofs_per_cell();
+
+  dof_indices.resize(n_cells * dofs_per_cell);
+  local_dof_indices.clear();
+  local_dof_indices_partitioner.reset();
+
+  point_cell.clear();
+  point_data_offset.clear();
+  point_jacobian_offset.clear();
+
+  std::vector<Point<dim>>              all_unit_points;
+  std::vector<types::global_dof_index> cell_dof_indices(dofs_per_cell);
+  for (unsigned int c = 0; c < n_cells; ++c)
+    {
+      Assert(&cells[c]->get_fe() == fe.get() ||
+               cells[c]->get_fe() == *fe,
+             ExcMessage("The cells must use the finite element passed to "
+                        "the constructor."));
+      cells[c]->get_dof_indices(cell_dof_indices);
+      std::copy(cell_dof_indices.begin(),
+                cell_dof_indices.end(),
+                dof_indices.begin() + c * dofs_per_cell);
+
+      const unsigned int geometry_index =
+        mapping_info.template compute_geometry_index_offset<false>(
+          c, numbers::invalid_unsigned_int);
+      const unsigned int n_cell_points =
+        mapping_info.get_n_q_points_unvectorized(geometry_index);
+      const unsigned int data_offset =
+        mapping_info.compute_data_index_offset(geometry_index);
+      const unsigned int compressed_data_offset =
+        mapping_info.compute_compressed_data_index_offset(geometry_index);
+      const bool is_affine =
+        mapping_info.get_cell_type(geometry_index) <=
+        internal::MatrixFreeFunctions::GeometryType::affine;
+      const Point<dim, VectorizedArrayType> *cell_unit_points =
+        mapping_info.get_unit_point(
+          mapping_info.compute_unit_point_index_offset(geometry_index));
+      for (unsigned int q = 0; q < n_cell_points; ++q)
+        {
+          Point<dim> &p = all_unit_points.emplace_back();
+          for (unsigned int d = 0; d < dim; ++d)
+            p[d] = cell_unit_points[q / n_lanes][d][q % n_lanes];
+          point_cell.push_back(c);
+          point_data_offset.push_back(data_offset + q);
+          point_jacobian_offset.push_back(compressed_data_offset +
+                                          (is_affine ? 0 : q));
+        }
+    }
+
+  const unsigned int n_points  = point_cell.size();
+  const unsigned int n_batches = (n_points + n_lanes - 1) / n_lanes;
+
+  if (update_flags & update_values)
+    values.resize(n_points);
+  if (update_flags & update_gradients)
+    gradients.resize(n_points);
+
+  // collect the points in reference coordinates into batches, filling the
+  // unused lanes of the last batch with the last point, and evaluate the 1d
+  // polynomials
+  const unsigned int n_shapes = poly.size();
+  shapes.resize_fast(n_batches * n_shapes);
+  for (unsigned int b = 0; b < n_batches; ++b)
+    {
+      Point<dim, VectorizedArrayType> unit_point;
+      for (unsigned int v = 0; v < n_lanes; ++v)
+        {
+          const Point<dim> &p =
+            all_unit_points[std::min(b * n_lanes + v, n_points - 1)];
+          for (unsigned int d = 0; d < dim; ++d)
+            unit_point[d][v] = p[d];
+        }
+      internal::compute_values_of_array(shapes.data() + b * n_shapes,
+                                        poly,
+                                        unit_point);
+    }
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::
+  prepare_local_dof_indices(
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+{
+  if (local_dof_indices_partitioner == partitioner &&
+      local_dof_indices.size() == dof_indices.size())
+    return;
+
+  local_dof_indices.resize(dof_indices.size());
+  for (unsigned int i = 0; i < dof_indices.size(); ++i)
+    local_dof_indices[i] = partitioner->global_to_local(dof_indices[i]);
+  local_dof_indices_partitioner = partitioner;
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+template <typename VectorType>
+inline void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::gather(
+  const VectorType  &solution,
+  const unsigned int batch)
+{
+  const unsigned int n_points      = point_cell.size();
+  const unsigned int dofs_per_cell = fe->n_dofs_per_cell();
+
+  unsigned int previous_cell = numbers::invalid_unsigned_int;
+  for (unsigned int v = 0; v < n_lanes; ++v)
+    {
+      const unsigned int cell =
+        point_cell[std::min(batch * n_lanes + v, n_points - 1)];
+
+      // several points of the same cell are typically in consecutive lanes,
+      // in which case we can copy the values from the previous lane
+      if (cell == previous_cell)
+        {
+          for (unsigned int i = 0; i < dofs_per_component; ++i)
+            {
+              typename ETT::scalar_value_type value;
+              ETT::set_value(solution_vectorized[i], v - 1, value);
+              ETT::get_value(solution_vectorized[i], v, value);
+            }
+          continue;
+        }
+      previous_cell = cell;
+
+      for (unsigned int i = 0; i < dofs_per_component; ++i)
+        {
+          typename ETT::scalar_value_type value;
+          for (unsigned int comp = 0; comp < n_components; ++comp)
+            {
+              const unsigned int index_in_cell =
+                (component_in_base_element + comp) * dofs_per_component + i;
+              const unsigned int local_index =
+                cell * dofs_per_cell +
+                (renumber.empty() ? index_in_cell : renumber[index_in_cell]);
+              if constexpr (internal::FEPointEvaluation::HasPartitioner<
+                              VectorType>::value)
+                ETT::read_value(solution.local_element(
+                                  local_dof_indices[local_index]),
+                                comp,
+                                value);
+              else
+                ETT::read_value(internal::ElementAccess<VectorType>::get(
+                                  solution, dof_indices[local_index]),
+                                comp,
+                                value);
+            }
+          ETT::get_value(solution_vectorized[i], v, value);
+        }
+    }
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+template <typename VectorType>
+inline void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::scatter_add(
+  VectorType        &destination,
+  const unsigned int batch) const
+{
+  const unsigned int n_points      = point_cell.size();
+  const unsigned int dofs_per_cell = fe->n_dofs_per_cell();
+
+  for (unsigned int v = 0; v < n_lanes && batch * n_lanes + v < n_points; ++v)
+    {
+      const unsigned int cell = point_cell[batch * n_lanes + v];
+      for (unsigned int i = 0; i < dofs_per_component; ++i)
+        {
+          typename ETT::scalar_value_type value;
+          ETT::set_value(solution_vectorized[i], v, value);
+          for (unsigned int comp = 0; comp < n_components; ++comp)
+            {
+              ScalarNumber component_value;
+              if constexpr (n_components == 1)
+                component_value = value;
+              else
+                component_value = value[comp];
+
+              const unsigned int index_in_cell =
+                (component_in_base_element + comp) * dofs_per_component + i;
+              const unsigned int local_index =
+                cell * dofs_per_cell +
+                (renumber.empty() ? index_in_cell : renumber[index_in_cell]);
+              if constexpr (internal::FEPointEvaluation::HasPartitioner<
+                              VectorType>::value)
+                destination.local_element(local_dof_indices[local_index]) +=
+                  component_value;
+              else
+                internal::ElementAccess<VectorType>::add(
+                  component_value, dof_indices[local_index], destination);
+            }
+        }
+    }
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+template <typename VectorType>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::evaluate(
+  const VectorType                       &solution,
+  const EvaluationFlags::EvaluationFlags &evaluation_flags)
+{
+  Assert(!(evaluation_flags & EvaluationFlags::hessians), ExcNotImplemented());
+  Assert(!(evaluation_flags & EvaluationFlags::values) ||
+           (update_flags & update_values),
+         ExcNotInitialized());
+  Assert(!(evaluation_flags & EvaluationFlags::gradients) ||
+           (update_flags & update_gradients),
+         ExcNotInitialized());
+
+  if constexpr (internal::FEPointEvaluation::HasPartitioner<VectorType>::value)
+    prepare_local_dof_indices(solution.get_partitioner());
+
+  const unsigned int n_points  = point_cell.size();
+  const unsigned int n_shapes  = poly.size();
+  const unsigned int n_batches = (n_points + n_lanes - 1) / n_lanes;
+
+  for (unsigned int b = 0; b < n_batches; ++b)
+    {
+      gather(solution, b);
+
+      vectorized_value_type                                 value;
+      typename ETT::interface_vectorized_unit_gradient_type gradient;
+      if (evaluation_flags & EvaluationFlags::gradients)
+        {
+          const std::array<vectorized_value_type, dim + 1> result =
+            internal::evaluate_tensor_product_value_and_gradient_shapes<
+              dim,
+              vectorized_value_type,
+              VectorizedArrayType,
+              1,
+              false>(shapes.data() + b * n_shapes,
+                     n_shapes,
+                     solution_vectorized.data());
+          for (unsigned int d = 0; d < dim; ++d)
+            gradient[d] = result[d];
+          value = result[dim];
+        }
+      else
+        value = internal::evaluate_tensor_product_value_shapes<
+          dim,
+          vectorized_value_type,
+          VectorizedArrayType,
+          false>(shapes.data() + b * n_shapes,
+                 n_shapes,
+                 solution_vectorized.data());
+
+      for (unsigned int v = 0, q = b * n_lanes; v < n_lanes && q < n_points;
+           ++v, ++q)
+        {
+          if (evaluation_flags & EvaluationFlags::values)
+            ETT::set_value(value, v, values[q]);
+          if (evaluation_flags & EvaluationFlags::gradients)
+            {
+              typename ETT::unit_gradient_type unit_gradient;
+              ETT::set_gradient(gradient, v, unit_gradient);
+              gradients[q] = apply_transformation(
+                mapping_info.get_inverse_jacobian(point_jacobian_offset[q])[0]
+                  .transpose(),
+                unit_gradient);
+            }
+        }
+    }
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+template <bool do_JxW, typename VectorType>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::do_integrate(
+  VectorType                             &destination,
+  const EvaluationFlags::EvaluationFlags &integration_flags)
+{
+  Assert(!(integration_flags & EvaluationFlags::hessians), ExcNotImplemented());
+  Assert(!do_JxW || (update_flags & update_JxW_values), ExcNotInitialized());
+
+  if constexpr (internal::FEPointEvaluation::HasPartitioner<VectorType>::value)
+    prepare_local_dof_indices(destination.get_partitioner());
+
+  const unsigned int n_points  = point_cell.size();
+  const unsigned int n_shapes  = poly.size();
+  const unsigned int n_batches = (n_points + n_lanes - 1) / n_lanes;
+
+  for (unsigned int b = 0; b < n_batches; ++b)
+    {
+      // the unused lanes of the last batch stay at zero
+      vectorized_value_type                                 value    = {};
+      typename ETT::interface_vectorized_unit_gradient_type gradient = {};
+      for (unsigned int v = 0, q = b * n_lanes; v < n_lanes && q < n_points;
+           ++v, ++q)
+        {
+          const Number JxW =
+            do_JxW ? mapping_info.get_JxW(point_data_offset[q])[0] : Number(1);
+          if (integration_flags & EvaluationFlags::values)
+            ETT::get_value(value, v, values[q] * JxW);
+          if (integration_flags & EvaluationFlags::gradients)
+            ETT::get_gradient(
+              gradient,
+              v,
+              apply_transformation(
+                mapping_info.get_inverse_jacobian(point_jacobian_offset[q])[0],
+                gradients[q] * JxW));
+        }
+
+      if (integration_flags & EvaluationFlags::gradients)
+        internal::integrate_tensor_product_value_and_gradient<
+          false,
+          dim,
+          VectorizedArrayType,
+          vectorized_value_type>(shapes.data() + b * n_shapes,
+                                 n_shapes,
+                                 &value,
+                                 gradient,
+                                 solution_vectorized.data(),
+                                 Point<dim, VectorizedArrayType>(),
+                                 false);
+      else
+        internal::integrate_tensor_product_value<false,
+                                                 dim,
+                                                 VectorizedArrayType,
+                                                 vectorized_value_type>(
+          shapes.data() + b * n_shapes,
+          n_shapes,
+          value,
+          solution_vectorized.data(),
+          Point<dim, VectorizedArrayType>(),
+          false);
+
+      scatter_add(destination, b);
+    }
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+template <typename VectorType>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::integrate(
+  VectorType                             &destination,
+  const EvaluationFlags::EvaluationFlags &integration_flags)
+{
+  do_integrate<true>(destination, integration_flags);
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+template <typename VectorType>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::test_and_sum(
+  VectorType                             &destination,
+  const EvaluationFlags::EvaluationFlags &integration_flags)
+{
+  do_integrate<false>(destination, integration_flags);
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline const typename FEPointBatchEvaluation<n_components_,
+                                             dim,
+                                             spacedim,
+                                             Number>::value_type &
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::get_value(
+  const unsigned int point_index) const
+{
+  AssertIndexRange(point_index, values.size());
+  return values[point_index];
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::submit_value(
+  const value_type  &value,
+  const unsigned int point_index)
+{
+  AssertIndexRange(point_index, values.size());
+  values[point_index] = value;
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline const typename FEPointBatchEvaluation<n_components_,
+                                             dim,
+                                             spacedim,
+                                             Number>::gradient_type &
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::get_gradient(
+  const unsigned int point_index) const
+{
+  AssertIndexRange(point_index, gradients.size());
+  return gradients[point_index];
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::submit_gradient(
+  const gradient_type &gradient,
+  const unsigned int   point_index)
+{
+  AssertIndexRange(point_index, gradients.size());
+  gradients[point_index] = gradient;
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline Number
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::JxW(
+  const unsigned int point_index) const
+{
+  AssertIndexRange(point_index, point_data_offset.size());
+  Assert(update_flags & update_JxW_values, ExcNotInitialized());
+  return mapping_info.get_JxW(point_data_offset[point_index])[0];
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline Point<spacedim, Number>
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::quadrature_point(
+  const unsigned int point_index) const
+{
+  AssertIndexRange(point_index, point_data_offset.size());
+  return mapping_info.get_real_point(point_data_offset[point_index])[0];
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline unsigned int
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::n_points() const
+{
+  return point_cell.size();
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::
+  quadrature_point_indices() const
+{
+  return {0U, n_points()};
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -1126,6 +1126,11 @@ protected:
  * topic. In those cases, the cost implied
  * by this class is similar (or sometimes even somewhat lower) than using
  * `FEValues::reinit(cell)` followed by `FEValues::get_function_gradients`.
+ *
+ * Since this class vectorizes over the points of a single cell, the SIMD
+ * lanes are poorly utilized if there are only a few points per cell, as is
+ * common in particle simulations. The class FEPointBatchEvaluation
+ * vectorizes over points of several cells instead.
  */
 template <int n_components_,
           int dim,
@@ -60,6 +60,10 @@ namespace internal
        * for different kinds of iterators, e.g. standard DoFHandler,
        * multigrid, etc.)  on a fixed Triangulation. In addition, a mapping
        * and several 1d quadrature formulas are given.
+       *
+       * If @p compute_jacobians_on_the_fly is set, only the support points
+       * of the mapping are stored for the cells of general type, see
+       * MatrixFree::AdditionalData::compute_jacobians_on_the_fly.
        */
       void
       initialize(
@@ -73,7 +77,8 @@ namespace internal
         const UpdateFlags update_flags_boundary_faces,
         const UpdateFlags update_flags_inner_faces,
         const UpdateFlags update_flags_faces_by_cells,
-        const bool        piola_transform);
+        const bool        piola_transform,
+        const bool        compute_jacobians_on_the_fly = false);
 
       /**
        * Update the information in the given cells and faces that is the
@@ -139,6 +144,13 @@ namespace internal
        */
       UpdateFlags update_flags_faces_by_cells;
 
+      /**
+       * Whether the Jacobians on cells of general type should be computed on
+       * the fly from the support points of the mapping rather than being
+       * stored on all quadrature points.
+       */
+      bool compute_jacobians_on_the_fly = false;
+
       /**
        * Stores whether a cell is Cartesian (cell type 0), has constant
        * transform data (Jacobians) (cell type 1), or is general (cell type
@@ -71,11 +71,13 @@ namespace internal
       const UpdateFlags update_flags_boundary_faces,
       const UpdateFlags update_flags_inner_faces,
       const UpdateFlags update_flags_faces_by_cells,
-      const bool        piola_transform)
+      const bool        piola_transform,
+      const bool        compute_jacobians_on_the_fly)
     {
       clear();
-      this->mapping_collection = mapping;
-      this->mapping            = &mapping->operator[](0);
+      this->mapping_collection           = mapping;
+      this->mapping                      = &mapping->operator[](0);
+      this->compute_jacobians_on_the_fly = compute_jacobians_on_the_fly;
 
       cell_data.resize(quad.size());
       face_data.resize(quad.size());
@@ -1230,9 +1232,30 @@ namespace internal
                           quadrature_points[q][d]);
                 }
 
+              // in case the Jacobians of the cell are computed on the fly,
+              // store the support points relative to the first one instead
+              // of the data on the quadrature points
+              const bool on_the_fly =
+                cell_type[cell] > affine && my_data.jacobians_on_the_fly();
+              if (process_cell[cell] && on_the_fly)
+                for (unsigned int v = 0; v < n_lanes_d; ++v)
+                  {
+                    const double *cell_points =
+                      plain_quadrature_points.data() +
+                      (cell * n_lanes + vv + v) * n_mapping_points * dim;
+                    VectorizedArrayType *support_points =
+                      my_data.mapping_support_points.data() +
+                      my_data.mapping_support_point_offsets[cell];
+                    for (unsigned int d = 0; d < dim; ++d)
+                      for (unsigned int i = 0; i < n_mapping_points; ++i)
+                        support_points[d * n_mapping_points + i][vv + v] =
+                          cell_points[d * n_mapping_points + i] -
+                          cell_points[d * n_mapping_points];
+                  }
+
               const unsigned int n_points =
                 cell_type[cell] <= affine ? 1 : n_q_points;
-              if (process_cell[cell])
+              if (process_cell[cell] && !on_the_fly)
                 for (unsigned int q = 0; q < n_points; ++q)
                   {
                     const unsigned int idx =
@@ -2793,25 +2816,79 @@ namespace internal
             cell_data[my_q];
 
           // step 4a: set the index offsets, find out how much to allocate,
-          // and allocate the memory
+          // and allocate the memory. If the Jacobians on cells of general
+          // type are computed on the fly, which requires a tensor-product
+          // quadrature formula, we number these cells after all other cells,
+          // such that the data fields only need to hold the latter.
           const unsigned int n_q_points = my_data.descriptor[0].n_q_points;
-          unsigned int       max_size   = 0;
+          const bool         jacobians_on_the_fly =
+            compute_jacobians_on_the_fly &&
+            (update_flags_cells & update_jacobian_grads) == 0 &&
+            my_data.descriptor[0].quadrature_1d.size() > 0 &&
+            shape_infos[my_q].data[0].n_q_points_1d ==
+              my_data.descriptor[0].quadrature_1d.size();
+          unsigned int max_size    = 0;
+          unsigned int stored_size = 0;
           my_data.data_index_offsets.resize(cell_type.size());
-          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+          for (unsigned int round = 0; round < (jacobians_on_the_fly ? 2 : 1);
+               ++round)
             {
-              if (process_cell[cell] == false)
-                my_data.data_index_offsets[cell] =
-                  my_data.data_index_offsets[cell_data_index_vect[cell]];
-              else
-                my_data.data_index_offsets[cell] = max_size;
-              max_size =
-                std::max(max_size,
-                         my_data.data_index_offsets[cell] +
-                           (cell_type[cell] <= affine ? 2 : n_q_points));
+              for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+                {
+                  if (jacobians_on_the_fly &&
+                      (cell_type[cell] > affine) != (round == 1))
+                    continue;
+                  if (process_cell[cell] == false)
+                    my_data.data_index_offsets[cell] =
+                      my_data.data_index_offsets[cell_data_index_vect[cell]];
+                  else
+                    my_data.data_index_offsets[cell] = max_size;
+                  max_size =
+                    std::max(max_size,
+                             my_data.data_index_offsets[cell] +
+                               (cell_type[cell] <= affine ? 2 : n_q_points));
+                }
+              if (round == 0)
+                stored_size = max_size;
             }
 
-          my_data.JxW_values.resize_fast(max_size);
-          my_data.jacobians[0].resize_fast(max_size);
+          my_data.JxW_values.resize_fast(stored_size);
+          my_data.jacobians[0].resize_fast(stored_size);
+
+          if (jacobians_on_the_fly)
+            {
+              unsigned int n_general_cells = 0;
+              my_data.mapping_support_point_offsets.resize(cell_type.size());
+              for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+                if (cell_type[cell] <= affine)
+                  my_data.mapping_support_point_offsets[cell] =
+                    numbers::invalid_unsigned_int;
+                else if (process_cell[cell] == false)
+                  my_data.mapping_support_point_offsets[cell] =
+                    my_data.mapping_support_point_offsets
+                      [cell_data_index_vect[cell]];
+                else
+                  my_data.mapping_support_point_offsets[cell] =
+                    (n_general_cells++) * n_mapping_points * dim;
+              my_data.mapping_support_points.resize_fast(
+                n_general_cells * n_mapping_points * dim);
+
+              const UnivariateShapeData<double> &univariate_shape_data =
+                shape_infos[my_q].data[0];
+              my_data.mapping_shape_values.resize(
+                univariate_shape_data.shape_values.size());
+              my_data.mapping_shape_gradients.resize(
+                univariate_shape_data.shape_gradients.size());
+              for (unsigned int i = 0;
+                   i < univariate_shape_data.shape_values.size();
+                   ++i)
+                {
+                  my_data.mapping_shape_values[i] =
+                    univariate_shape_data.shape_values[i];
+                  my_data.mapping_shape_gradients[i] =
+                    univariate_shape_data.shape_gradients[i];
+                }
+            }
           if (update_flags_cells & update_jacobian_grads)
             {
               my_data.jacobian_gradients[0].resize_fast(max_size);
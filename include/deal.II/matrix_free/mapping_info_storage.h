@@ -196,7 +196,11 @@ namespace internal
        * Stores the index offset into the arrays @p jxw_values, @p jacobians,
        * @p normal_vectors and the second derivatives. Note that affine cells
        * have shorter fields of length 1, where the others have lengths equal
-       * to the number of quadrature points of the given cell.
+       * to the number of quadrature points of the given cell. If the
+       * Jacobians are computed on the fly, the offsets of cells of general
+       * type are placed after all other cells and exceed the size of the
+       * data arrays, but they can still be used to index user data with the
+       * same compression.
        */
       AlignedVector<unsigned int> data_index_offsets;
 
@@ -306,6 +310,55 @@ namespace internal
        */
       AlignedVector<Point<spacedim, Number>> quadrature_points;
 
+      /**
+       * Stores the index offset of a cell batch into the array @p
+       * mapping_support_points. This field is only filled for cells of
+       * general type when the Jacobians are computed on the fly, see
+       * jacobians_on_the_fly().
+       */
+      AlignedVector<unsigned int> mapping_support_point_offsets;
+
+      /**
+       * Stores the support points of a MappingQ on the cells of general type
+       * in case the Jacobians are not stored for each quadrature point but
+       * computed on the fly in FEEvaluation::reinit(). The points of a cell
+       * batch are arranged in the lexicographic order of the tensor-product
+       * Lagrange polynomials of the mapping, with all points of the first
+       * coordinate first, followed by the second coordinate, and so on. In
+       * order to not lose accuracy in single precision, the coordinates are
+       * stored relative to the first support point of each cell, which does
+       * not change the Jacobians.
+       *
+       * Indexed by @p mapping_support_point_offsets.
+       */
+      AlignedVector<Number> mapping_support_points;
+
+      /**
+       * The values of the one-dimensional Lagrange polynomials of the
+       * mapping in the points of the one-dimensional quadrature formula, as
+       * used by the tensor product evaluators. Only filled if the Jacobians
+       * are computed on the fly.
+       */
+      AlignedVector<typename VectorizedArrayTrait<Number>::value_type>
+        mapping_shape_values;
+
+      /**
+       * The derivatives of the one-dimensional Lagrange polynomials of the
+       * mapping in the points of the one-dimensional quadrature formula. Only
+       * filled if the Jacobians are computed on the fly.
+       */
+      AlignedVector<typename VectorizedArrayTrait<Number>::value_type>
+        mapping_shape_gradients;
+
+      /**
+       * Return whether the inverse Jacobians and JxW values of the cells of
+       * general type are computed on the fly from @p mapping_support_points
+       * rather than being stored in @p jacobians and @p JxW_values. Cells
+       * of Cartesian or affine type use the regular storage in any case.
+       */
+      bool
+      jacobians_on_the_fly() const;
+
       /**
        * Clears all data fields except the descriptor vector.
        */
@@ -363,6 +416,16 @@ namespace internal
       return 0;
     }
 
+
+
+    template <int structdim, int spacedim, typename Number>
+    inline bool
+    MappingInfoStorage<structdim, spacedim, Number>::jacobians_on_the_fly()
+      const
+    {
+      return !mapping_shape_values.empty();
+    }
+
   } // end of namespace MatrixFreeFunctions
 } // end of namespace internal
 
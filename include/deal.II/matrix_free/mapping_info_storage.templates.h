@@ -113,6 +113,10 @@ namespace internal
         }
       quadrature_point_offsets.clear();
       quadrature_points.clear();
+      mapping_support_point_offsets.clear();
+      mapping_support_points.clear();
+      mapping_shape_values.clear();
+      mapping_shape_gradients.clear();
     }
 
 
@@ -187,7 +191,12 @@ namespace internal
              MemoryConsumption::memory_consumption(normals_times_jacobians[0]) +
              MemoryConsumption::memory_consumption(normals_times_jacobians[1]) +
              MemoryConsumption::memory_consumption(quadrature_point_offsets) +
-             MemoryConsumption::memory_consumption(quadrature_points);
+             MemoryConsumption::memory_consumption(quadrature_points) +
+             MemoryConsumption::memory_consumption(
+               mapping_support_point_offsets) +
+             MemoryConsumption::memory_consumption(mapping_support_points) +
+             MemoryConsumption::memory_consumption(mapping_shape_values) +
+             MemoryConsumption::memory_consumption(mapping_shape_gradients);
     }
 
 
@@ -249,6 +258,19 @@ namespace internal
             MemoryConsumption::memory_consumption(quadrature_point_offsets) +
               MemoryConsumption::memory_consumption(quadrature_points));
         }
+
+      const std::size_t support_point_size =
+        Utilities::MPI::sum(mapping_support_points.size(),
+                            task_info.communicator);
+      if (support_point_size > 0)
+        {
+          out << "      Memory mapping support points: ";
+          task_info.print_memory_statistics(
+            out,
+            MemoryConsumption::memory_consumption(
+              mapping_support_point_offsets) +
+              MemoryConsumption::memory_consumption(mapping_support_points));
+        }
     }
 
   } // namespace MatrixFreeFunctions
@@ -250,6 +250,8 @@ public:
           cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
       , store_ghost_cells(false)
+      , fuse_cell_and_face_loops(false)
+      , compute_jacobians_on_the_fly(false)
       , communicator_sm(MPI_COMM_SELF)
     {}
 
@@ -277,6 +279,8 @@ public:
           other.cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(other.allow_ghosted_vectors_in_loops)
       , store_ghost_cells(other.store_ghost_cells)
+      , fuse_cell_and_face_loops(other.fuse_cell_and_face_loops)
+      , compute_jacobians_on_the_fly(other.compute_jacobians_on_the_fly)
       , communicator_sm(other.communicator_sm)
     {}
 
@@ -306,6 +310,8 @@ public:
         other.cell_vectorization_categories_strict;
       allow_ghosted_vectors_in_loops = other.allow_ghosted_vectors_in_loops;
       store_ghost_cells              = other.store_ghost_cells;
+      fuse_cell_and_face_loops       = other.fuse_cell_and_face_loops;
+      compute_jacobians_on_the_fly   = other.compute_jacobians_on_the_fly;
       communicator_sm                = other.communicator_sm;
 
       return *this;
@@ -557,6 +563,70 @@ public:
      */
     bool store_ghost_cells;
 
+    /**
+     * Option to interleave the work on cells and faces in MatrixFree::loop()
+     * at a fine granularity. By default, the loop runs the cell operation on
+     * a partition of several hundred cells before it runs the operations on
+     * the interior and boundary faces of that partition. If this option is
+     * set to true, the face batches within each partition are sorted by the
+     * last of their adjacent cell batches, and the loop alternates between
+     * the cell operation on a few cell batches and the face operations on
+     * all faces whose adjacent cells have then been visited. The vector
+     * entries and the geometry data of a cell are thus read from caches
+     * rather than from main memory when its faces are processed. The number
+     * of cell batches in each step is chosen such that the vector entries of
+     * a step fit into the level-one cache.
+     *
+     * As opposed to MatrixFree::loop_cell_centric(), each face integral is
+     * still computed only once and its result is written to the cells on
+     * both sides by the face operation, so the operations passed to
+     * MatrixFree::loop() do not need to be changed. This is most beneficial
+     * for discontinuous Galerkin methods, where the face integrals access
+     * the same vector entries as the cell integrals. Since the operations are
+     * called on shorter ranges, there is a small overhead for each call,
+     * e.g., for the construction of FEEvaluation and FEFaceEvaluation
+     * objects inside the operations.
+     *
+     * This option only has an effect if face integrals are set up via
+     * @p mapping_update_flags_inner_faces or
+     * @p mapping_update_flags_boundary_faces and if the loop runs without
+     * threads, i.e., @p tasks_parallel_scheme is @p none. It is ignored for
+     * hp-adaptive computations and for mixed meshes with several reference
+     * cell types. The default value is false.
+     */
+    bool fuse_cell_and_face_loops;
+
+    /**
+     * Option to compute the inverse Jacobians and JxW values on the cells
+     * on the fly in FEEvaluation::reinit() rather than loading them from
+     * memory. By default, the geometry of each cell that is neither
+     * Cartesian nor affine is stored on all quadrature points, which are
+     * $(d^2+1) n_q^d$ numbers per cell for $n_q$ quadrature points per
+     * direction. For high-order curved meshes, these data can take more
+     * memory and memory bandwidth than the vector entries of the finite
+     * element solution. If this option is set to true, only the $d (k+1)^d$
+     * coordinates of the support points of a MappingQ of degree $k$ are
+     * stored for these cells, and the Jacobians are interpolated with sum
+     * factorization whenever FEEvaluation::reinit() is called for a cell
+     * batch. This replaces memory transfer by a few arithmetic operations
+     * per quadrature point, which is typically faster for mapping degrees
+     * of three and higher when the operator evaluation is limited by the
+     * memory bandwidth.
+     *
+     * This option only has an effect if the mapping is a MappingQ (or a
+     * derived class) without hp-adaptivity and for quadrature formulas that
+     * are tensor products of the same 1d formula. It does not apply to the
+     * face data and is ignored if the derivatives of the Jacobians are
+     * requested, e.g., via @p update_hessians. Geometry data requested
+     * from a cell in other ways than FEEvaluation::reinit() with the index
+     * of a cell batch, e.g., in FEEvaluation::reinit() with an array of
+     * cell indices, is not supported for cells whose Jacobians are
+     * computed on the fly. The quadrature points in real space are still
+     * stored if requested via @p update_quadrature_points. The default
+     * value is false.
+     */
+    bool compute_jacobians_on_the_fly;
+
     /**
      * Shared-memory MPI communicator. Default: MPI_COMM_SELF.
      */
@@ -1027,7 +1097,16 @@ public:
    * data exchange on the source vector and destination vector. As opposed to
    * the other variants that only runs a function on cells, this method also
    * takes as arguments a function for the interior faces and for the boundary
-   * faces, respectively.
+   * faces, respectively. By default, the cell function is called on a
+   * partition of cells before the face functions are called on the faces of
+   * that partition. The three functions are instead called on alternating
+   * short ranges of cells and faces, which keeps the vector entries of the
+   * cells in the level-one cache for the face integrals, if all of the
+   * following conditions are met: AdditionalData::fuse_cell_and_face_loops
+   * is set to true, AdditionalData::tasks_parallel_scheme is
+   * AdditionalData::none, the object is not set up for hp-adaptive
+   * computations, and the mesh is not a mixed mesh with several reference
+   * cell types.
    *
    * @param cell_operation `std::function` with the signature <tt>cell_operation
    * (const MatrixFree<dim,Number> &, OutVector &, InVector &,
@@ -4793,6 +4872,35 @@ namespace internal
                     range_index);
     }
 
+    // Runs the face work on the given range of face batches, which must not
+    // mix different active FE indices. If no function is given, nothing is
+    // done
+    virtual void
+    face(const std::pair<unsigned int, unsigned int> &face_range) override
+    {
+      if (face_function != nullptr && face_range.second > face_range.first)
+        (container.*face_function)(matrix_free,
+                                   this->dst,
+                                   this->src,
+                                   face_range);
+    }
+
+    virtual void
+    boundary(const std::pair<unsigned int, unsigned int> &face_range) override
+    {
+      if (boundary_function != nullptr && face_range.second > face_range.first)
+        (container.*boundary_function)(matrix_free,
+                                       this->dst,
+                                       this->src,
+                                       face_range);
+    }
+
+    virtual bool
+    has_face_work() const override
+    {
+      return face_function != nullptr || boundary_function != nullptr;
+    }
+
   private:
     void
     process_range(const function_type             &fu,
@@ -850,7 +850,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         additional_data.mapping_update_flags_boundary_faces,
         additional_data.mapping_update_flags_inner_faces,
         additional_data.mapping_update_flags_faces_by_cells,
-        piola_transform);
+        piola_transform,
+        additional_data.compute_jacobians_on_the_fly);
 
       mapping_is_initialized = true;
     }
@@ -2042,6 +2043,24 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
         face_info.faces,
         dof_info_hp.cell_active_fe_index);
 
+      // sort the faces for interleaving the work on cells and faces in
+      // steps whose vector entries fit into the level-one cache, taking
+      // roughly 1024 entries per step
+      if (additional_data.fuse_cell_and_face_loops &&
+          task_info.scheme == internal::MatrixFreeFunctions::TaskInfo::none &&
+          dof_info_hp.cell_active_fe_index.empty() &&
+          dof_handlers[0]->get_triangulation().is_mixed_mesh() == false)
+        {
+          unsigned int max_dofs_per_cell = 1;
+          for (const auto &info : dof_info)
+            for (const auto &dofs : info.dofs_per_cell)
+              max_dofs_per_cell = std::max(max_dofs_per_cell, dofs);
+          internal::MatrixFreeFunctions::setup_fused_cell_face_loop(
+            std::max(1U, 1024U / (max_dofs_per_cell * n_lanes)),
+            face_info.faces,
+            task_info);
+        }
+
       // for the other ghosted faces, there are no scheduling restrictions
       hard_vectorization_boundary.clear();
       hard_vectorization_boundary.resize(
@@ -25,6 +25,8 @@
 #include <deal.II/base/table.h>
 #include <deal.II/base/vectorization.h>
 
+#include <array>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -379,6 +381,282 @@ namespace internal
 
 
 
+    /**
+     * This struct stores the shape functions of elements on wedges whose
+     * basis functions are products of a polynomial on the triangle spanned
+     * by the first two coordinate directions and a polynomial on the line in
+     * the third direction, such as FE_WedgeP, evaluated in a quadrature
+     * formula with the same product structure, such as QGaussWedge. In that
+     * case, the evaluation of the element in the quadrature points can be
+     * factorized into an interpolation along the line direction, done for
+     * all triangle basis functions at once, followed by an interpolation on
+     * the triangle, done separately for each layer of quadrature points along
+     * the line. This reduces the work from the product of the number of
+     * degrees of freedom and the number of quadrature points to the sum of
+     * the respective operations for the line and the triangle.
+     *
+     * The data is only set up if the element and the quadrature formula
+     * have been verified to have this structure, as indicated by
+     * is_initialized(). Otherwise, the generic path for elements without
+     * tensor-product structure is used.
+     *
+     * @ingroup matrixfree
+     */
+    template <typename Number>
+    struct WedgeShapeData
+    {
+      /**
+       * Empty constructor. Sets all sizes to zero.
+       */
+      WedgeShapeData();
+
+      /**
+       * Try to factorize the scalar finite element @p fe evaluated in the
+       * quadrature formula @p quad. If the element is not defined on a
+       * wedge, or if either the shape functions or the quadrature formula do
+       * not have the product structure described above, the object is left
+       * uninitialized.
+       */
+      template <int dim, int spacedim>
+      void
+      reinit(const Quadrature<dim>               &quad,
+             const FiniteElement<dim, spacedim> &fe);
+
+      /**
+       * Return whether the element and quadrature formula passed to
+       * reinit() could be factorized.
+       */
+      bool
+      is_initialized() const;
+
+      /**
+       * Return the memory consumption of this class in bytes.
+       */
+      std::size_t
+      memory_consumption() const;
+
+      /**
+       * The number of shape functions of the triangle factor.
+       */
+      unsigned int n_dofs_triangle;
+
+      /**
+       * The number of shape functions of the line factor.
+       */
+      unsigned int n_dofs_line;
+
+      /**
+       * The number of quadrature points of the triangle factor.
+       */
+      unsigned int n_q_points_triangle;
+
+      /**
+       * The number of quadrature points of the line factor.
+       */
+      unsigned int n_q_points_line;
+
+      /**
+       * The index of the shape function of the wedge element that is the
+       * product of the triangle shape function <code>t</code> and the line
+       * shape function <code>l</code>, stored at position
+       * <code>l * n_dofs_triangle + t</code>.
+       */
+      std::vector<unsigned int> dof_numbering;
+
+      /**
+       * The values of the triangle shape functions in the triangle
+       * quadrature points, with <code>n_q_points_triangle</code> entries for
+       * each shape function.
+       */
+      AlignedVector<Number> triangle_values;
+
+      /**
+       * The gradients of the triangle shape functions in the triangle
+       * quadrature points, with the two derivatives of each quadrature point
+       * stored next to each other.
+       */
+      AlignedVector<Number> triangle_gradients;
+
+      /**
+       * The values of the line shape functions in the line quadrature
+       * points, with <code>n_q_points_line</code> entries for each shape
+       * function.
+       */
+      AlignedVector<Number> line_values;
+
+      /**
+       * The derivatives of the line shape functions in the line quadrature
+       * points.
+       */
+      AlignedVector<Number> line_gradients;
+    };
+
+
+
+    /**
+     * This struct stores the shape functions of polynomial elements on
+     * triangles, tetrahedra and pyramids, such as FE_SimplexP or
+     * FE_PyramidP, in a form that allows for sum factorization. The
+     * reference cell is written as the image of the unit hypercube under the
+     * collapsed (Duffy) transformation $x = a (1-b) (1-c)$, $y = b (1-c)$,
+     * $z = c$ for the tetrahedron (and the respective two-dimensional
+     * transformation for the triangle), and $x = a (1-c)$, $y = b (1-c)$,
+     * $z = c$ with $a, b \in [-1, 1]$ for the pyramid. In these coordinates,
+     * the polynomial space of the element is spanned by a modal basis of
+     * warped products $\phi_{pqr}(a, b, c) = A_p(a) B_{pq}(b) C_{pqr}(c)$
+     * of Legendre and Jacobi polynomials as proposed by Dubiner and Sherwin
+     * and Karniadakis. If the quadrature points also form a tensor product
+     * in the collapsed coordinates, such as for QCollapsedGaussSimplex or
+     * QGaussPyramid, the interpolation of the modal coefficients into the
+     * quadrature points can be done one coordinate at a time. The
+     * coefficients of the modal basis are obtained from the values of the
+     * element by multiplication with a square matrix.
+     *
+     * For an element of degree $k$ on a tetrahedron with $(k+1)^3$
+     * quadrature points, the cost of the evaluation is proportional to
+     * $k^4$, compared to $k^6$ for the multiplication with the full matrix of
+     * shape values.
+     *
+     * The data is only set up if the element and the quadrature formula
+     * have been verified to have this structure, as indicated by
+     * is_initialized(). Otherwise, the generic path for elements without
+     * tensor-product structure is used.
+     *
+     * @ingroup matrixfree
+     */
+    template <typename Number>
+    struct CollapsedShapeData
+    {
+      /**
+       * Empty constructor. Sets all sizes to zero.
+       */
+      CollapsedShapeData();
+
+      /**
+       * Try to factorize the scalar finite element @p fe evaluated in the
+       * quadrature formula @p quad. If the element is not defined on a
+       * triangle, tetrahedron or pyramid, if the quadrature points are not a
+       * tensor product in the collapsed coordinates, or if the modal basis
+       * does not reproduce the shape functions of the element, the object
+       * is left uninitialized.
+       */
+      template <int dim, int spacedim>
+      void
+      reinit(const Quadrature<dim>               &quad,
+             const FiniteElement<dim, spacedim> &fe);
+
+      /**
+       * Return whether the element and quadrature formula passed to
+       * reinit() could be factorized.
+       */
+      bool
+      is_initialized() const;
+
+      /**
+       * Return the memory consumption of this class in bytes.
+       */
+      std::size_t
+      memory_consumption() const;
+
+      /**
+       * The number of shape functions of the element, which is also the
+       * number of modal basis functions.
+       */
+      unsigned int n_dofs;
+
+      /**
+       * The number of quadrature points in each of the collapsed coordinates
+       * $a$, $b$, $c$, where the last entry is one for triangles.
+       */
+      std::array<unsigned int, 3> n_q_points_1d;
+
+      /**
+       * The number of functions $A_p$ in the first coordinate.
+       */
+      unsigned int n_modes_a;
+
+      /**
+       * The functions $B_{pq}$ of the second coordinate that belong to the
+       * function $A_p$ are numbered from <code>pair_start[p]</code> to
+       * <code>pair_start[p + 1]</code>.
+       */
+      std::vector<unsigned int> pair_start;
+
+      /**
+       * The modal basis functions that belong to the function $B_{pq}$ with
+       * index <code>s</code> are numbered from <code>mode_start[s]</code> to
+       * <code>mode_start[s + 1]</code>. Their coefficients are multiplied
+       * with the functions $C_{pqr}$ of the third coordinate.
+       */
+      std::vector<unsigned int> mode_start;
+
+      /**
+       * The values of the functions $A_p$ in the quadrature points of the
+       * first coordinate, with <code>n_q_points_1d[0]</code> entries for
+       * each function.
+       */
+      AlignedVector<Number> values_a;
+
+      /**
+       * The derivatives of the functions $A_p$.
+       */
+      AlignedVector<Number> gradients_a;
+
+      /**
+       * The values of the functions $B_{pq}$ in the quadrature points of the
+       * second coordinate, with <code>n_q_points_1d[1]</code> entries for
+       * each function.
+       */
+      AlignedVector<Number> values_b;
+
+      /**
+       * The derivatives of the functions $B_{pq}$.
+       */
+      AlignedVector<Number> gradients_b;
+
+      /**
+       * The values of the functions $C_{pqr}$ in the quadrature points of
+       * the third coordinate, with <code>n_q_points_1d[2]</code> entries for
+       * each modal basis function.
+       */
+      AlignedVector<Number> values_c;
+
+      /**
+       * The derivatives of the functions $C_{pqr}$.
+       */
+      AlignedVector<Number> gradients_c;
+
+      /**
+       * The matrix that computes the coefficients of the modal basis from
+       * the values of the element, stored row by row.
+       */
+      AlignedVector<Number> nodal_to_modal;
+
+      /**
+       * The transformation from the derivatives in the collapsed coordinates
+       * to the derivatives in the reference coordinates, i.e., the transpose
+       * of the inverse Jacobian of the collapsed transformation, stored as a
+       * <code>dim</code> by <code>dim</code> matrix for each quadrature point
+       * in the order of the tensor product.
+       */
+      AlignedVector<Number> derivative_transform;
+
+      /**
+       * The index of the quadrature point of the quadrature formula for each
+       * point of the tensor product, where the first collapsed coordinate
+       * runs fastest.
+       */
+      std::vector<unsigned int> quadrature_numbering;
+
+      /**
+       * The number of entries of the scratch data of FEEvaluation needed for
+       * the intermediate results of the factorized evaluation.
+       */
+      unsigned int scratch_size;
+    };
+
+
+
     /**
      * This struct stores a tensor (Kronecker) product view of the finite
      * element and quadrature formula used for evaluation. It is based on a
@@ -491,6 +769,21 @@ namespace internal
        */
       dealii::Table<2, UnivariateShapeData<Number> *> data_access;
 
+      /**
+       * A factorized representation of elements on wedges with a product
+       * structure, which is used instead of the full matrices stored in
+       * @p data when available. See WedgeShapeData for details.
+       */
+      WedgeShapeData<Number> wedge_data;
+
+      /**
+       * A factorized representation of elements on triangles, tetrahedra and
+       * pyramids in collapsed coordinates, which is used instead of the full
+       * matrices stored in @p data when available. See CollapsedShapeData
+       * for details.
+       */
+      CollapsedShapeData<Number> collapsed_data;
+
       /**
        * Stores the number of space dimensions.
        */
@@ -628,6 +921,44 @@ namespace internal
 
     // ------------------------------------------ inline functions
 
+    template <typename Number>
+    inline WedgeShapeData<Number>::WedgeShapeData()
+      : n_dofs_triangle(0)
+      , n_dofs_line(0)
+      , n_q_points_triangle(0)
+      , n_q_points_line(0)
+    {}
+
+
+
+    template <typename Number>
+    inline bool
+    WedgeShapeData<Number>::is_initialized() const
+    {
+      return n_dofs_triangle > 0;
+    }
+
+
+
+    template <typename Number>
+    inline CollapsedShapeData<Number>::CollapsedShapeData()
+      : n_dofs(0)
+      , n_q_points_1d{{0, 0, 0}}
+      , n_modes_a(0)
+      , scratch_size(0)
+    {}
+
+
+
+    template <typename Number>
+    inline bool
+    CollapsedShapeData<Number>::is_initialized() const
+    {
+      return n_dofs > 0;
+    }
+
+
+
     template <typename Number>
     inline const UnivariateShapeData<Number> &
     ShapeInfo<Number>::get_shape_data(const unsigned int dimension,
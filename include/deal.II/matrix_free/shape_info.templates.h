@@ -20,8 +20,10 @@
 
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/polynomial.h>
+#include <deal.II/base/polynomials_barycentric.h>
 #include <deal.II/base/polynomials_piecewise.h>
 #include <deal.II/base/polynomials_raviart_thomas.h>
+#include <deal.II/base/polynomials_wedge.h>
 #include <deal.II/base/qprojector.h>
 #include <deal.II/base/tensor_product_polynomials.h>
 #include <deal.II/base/utilities.h>
@@ -43,6 +45,7 @@
 
 #include <deal.II/grid/reference_cell.h>
 
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/householder.h>
 
 #include <deal.II/matrix_free/shape_info.h>
@@ -213,6 +216,576 @@ namespace internal
 
 
 
+    template <typename Number>
+    template <int dim, int spacedim>
+    void
+    WedgeShapeData<Number>::reinit(const Quadrature<dim>               &quad,
+                                   const FiniteElement<dim, spacedim> &fe)
+    {
+      *this = WedgeShapeData<Number>();
+
+      if constexpr (dim == 3)
+        {
+          // the decomposition of the shape functions into a triangle and a
+          // line factor is known for the polynomial space of FE_WedgeP and
+          // FE_WedgeDGP, which is only implemented for degrees one and two
+          if (fe.reference_cell() != ReferenceCells::Wedge ||
+              fe.n_components() != 1 || (fe.degree != 1 && fe.degree != 2))
+            return;
+
+          const unsigned int n_dofs_tri =
+            (fe.degree + 1) * (fe.degree + 2) / 2;
+          const unsigned int n_dofs    = fe.n_dofs_per_cell();
+          const unsigned int n_dofs_1d = fe.degree + 1;
+          if (n_dofs != n_dofs_tri * n_dofs_1d)
+            return;
+
+          // the quadrature points must consist of the points of a triangle
+          // formula repeated for each point of a line formula, with the
+          // triangle points running fastest, as in QGaussWedge
+          const unsigned int n_q_points = quad.size();
+          unsigned int       n_q_tri    = 1;
+          while (n_q_tri < n_q_points &&
+                 quad.point(n_q_tri)[2] == quad.point(0)[2])
+            ++n_q_tri;
+          if (n_q_points % n_q_tri != 0)
+            return;
+          const unsigned int n_q_1d = n_q_points / n_q_tri;
+          for (unsigned int q1 = 0; q1 < n_q_1d; ++q1)
+            for (unsigned int qt = 0; qt < n_q_tri; ++qt)
+              {
+                const Point<dim> &p = quad.point(q1 * n_q_tri + qt);
+                if (p[0] != quad.point(qt)[0] || p[1] != quad.point(qt)[1] ||
+                    p[2] != quad.point(q1 * n_q_tri)[2])
+                  return;
+              }
+
+          // the intermediate results of the factorized evaluation are stored
+          // in the scratch data of FEEvaluation, which is sized for the
+          // number of quadrature points of the cell; this is enough as long
+          // as the triangle formula has at least as many points as there are
+          // triangle shape functions, which is also the case where the
+          // factorization pays off
+          if (n_q_tri < n_dofs_tri)
+            return;
+
+          const BarycentricPolynomials<2> poly_triangle =
+            BarycentricPolynomials<2>::get_fe_p_basis(fe.degree);
+          const BarycentricPolynomials<1> poly_line =
+            BarycentricPolynomials<1>::get_fe_p_basis(fe.degree);
+
+          std::vector<double> values_tri(n_dofs_tri * n_q_tri);
+          std::vector<double> gradients_tri(2 * n_dofs_tri * n_q_tri);
+          for (unsigned int t = 0; t < n_dofs_tri; ++t)
+            for (unsigned int qt = 0; qt < n_q_tri; ++qt)
+              {
+                const Point<2> p(quad.point(qt)[0], quad.point(qt)[1]);
+                values_tri[t * n_q_tri + qt] =
+                  poly_triangle.compute_value(t, p);
+                const Tensor<1, 2> gradient = poly_triangle.compute_grad(t, p);
+                for (unsigned int d = 0; d < 2; ++d)
+                  gradients_tri[(t * n_q_tri + qt) * 2 + d] = gradient[d];
+              }
+
+          std::vector<double> values_1d(n_dofs_1d * n_q_1d);
+          std::vector<double> gradients_1d(n_dofs_1d * n_q_1d);
+          for (unsigned int l = 0; l < n_dofs_1d; ++l)
+            for (unsigned int q1 = 0; q1 < n_q_1d; ++q1)
+              {
+                const Point<1> p(quad.point(q1 * n_q_tri)[2]);
+                values_1d[l * n_q_1d + q1] = poly_line.compute_value(l, p);
+                gradients_1d[l * n_q_1d + q1] = poly_line.compute_grad(l, p)[0];
+              }
+
+          std::vector<unsigned int> numbering(n_dofs,
+                                              numbers::invalid_unsigned_int);
+          for (unsigned int i = 0; i < n_dofs; ++i)
+            {
+              const auto pair = fe.degree == 1 ?
+                                  dealii::internal::wedge_table_1[i] :
+                                  dealii::internal::wedge_table_2[i];
+              numbering[pair[1] * n_dofs_tri + pair[0]] = i;
+            }
+          if (std::find(numbering.begin(),
+                        numbering.end(),
+                        numbers::invalid_unsigned_int) != numbering.end())
+            return;
+
+          // other elements on wedges may use a different basis, so check
+          // that the products indeed give the shape functions of the element
+          for (unsigned int l = 0; l < n_dofs_1d; ++l)
+            for (unsigned int t = 0; t < n_dofs_tri; ++t)
+              for (unsigned int q1 = 0; q1 < n_q_1d; ++q1)
+                for (unsigned int qt = 0; qt < n_q_tri; ++qt)
+                  {
+                    const unsigned int  i = numbering[l * n_dofs_tri + t];
+                    const Point<dim>   &p = quad.point(q1 * n_q_tri + qt);
+                    const double        v_tri = values_tri[t * n_q_tri + qt];
+                    const double        v_1d  = values_1d[l * n_q_1d + q1];
+                    const Tensor<1, dim> gradient = fe.shape_grad(i, p);
+                    if (std::abs(fe.shape_value(i, p) - v_tri * v_1d) > 1e-12 ||
+                        std::abs(gradient[0] -
+                                 gradients_tri[(t * n_q_tri + qt) * 2] *
+                                   v_1d) > 1e-10 ||
+                        std::abs(gradient[1] -
+                                 gradients_tri[(t * n_q_tri + qt) * 2 + 1] *
+                                   v_1d) > 1e-10 ||
+                        std::abs(gradient[2] -
+                                 v_tri * gradients_1d[l * n_q_1d + q1]) > 1e-10)
+                      return;
+                  }
+
+          n_dofs_triangle     = n_dofs_tri;
+          n_dofs_line         = n_dofs_1d;
+          n_q_points_triangle = n_q_tri;
+          n_q_points_line     = n_q_1d;
+          dof_numbering       = numbering;
+
+          triangle_values.resize_fast(values_tri.size());
+          std::copy(values_tri.begin(),
+                    values_tri.end(),
+                    triangle_values.begin());
+          triangle_gradients.resize_fast(gradients_tri.size());
+          std::copy(gradients_tri.begin(),
+                    gradients_tri.end(),
+                    triangle_gradients.begin());
+          line_values.resize_fast(values_1d.size());
+          std::copy(values_1d.begin(), values_1d.end(), line_values.begin());
+          line_gradients.resize_fast(gradients_1d.size());
+          std::copy(gradients_1d.begin(),
+                    gradients_1d.end(),
+                    line_gradients.begin());
+        }
+      else
+        {
+          (void)quad;
+          (void)fe;
+        }
+    }
+
+
+
+    template <typename Number>
+    std::size_t
+    WedgeShapeData<Number>::memory_consumption() const
+    {
+      return sizeof(*this) +
+             MemoryConsumption::memory_consumption(dof_numbering) +
+             MemoryConsumption::memory_consumption(triangle_values) +
+             MemoryConsumption::memory_consumption(triangle_gradients) +
+             MemoryConsumption::memory_consumption(line_values) +
+             MemoryConsumption::memory_consumption(line_gradients);
+    }
+
+
+
+    template <typename Number>
+    template <int dim, int spacedim>
+    void
+    CollapsedShapeData<Number>::reinit(
+      const Quadrature<dim>               &quad,
+      const FiniteElement<dim, spacedim> &fe)
+    {
+      *this = CollapsedShapeData<Number>();
+
+      if constexpr (dim == 2 || dim == 3)
+        {
+          const bool is_pyramid =
+            fe.reference_cell() == ReferenceCells::Pyramid;
+          if ((fe.reference_cell() != ReferenceCells::get_simplex<dim>() &&
+               !is_pyramid) ||
+              fe.n_components() != 1 || quad.empty())
+            return;
+
+          const unsigned int degree     = fe.degree;
+          const unsigned int n_q_points = quad.size();
+
+          // compute the collapsed coordinates a, b, c of the quadrature
+          // points, where c is zero on triangles; the transformation is
+          // singular in the top vertex, which is never a quadrature point of
+          // the formulas we are interested in
+          std::array<std::vector<double>, 3> coordinates;
+          for (auto &coordinate : coordinates)
+            coordinate.resize(n_q_points);
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              const Point<dim> &p = quad.point(q);
+              const double      c = dim == 3 ? p[dim - 1] : 0.;
+              const double      denominator_a =
+                is_pyramid ? 1. - c : 1. - p[1] - c;
+              if (denominator_a < 1e-12 || 1. - c < 1e-12)
+                return;
+              coordinates[0][q] = p[0] / denominator_a;
+              coordinates[1][q] = p[1] / (1. - c);
+              coordinates[2][q] = c;
+            }
+
+          // the quadrature points must be the tensor product of the points
+          // in the three collapsed coordinates, in any order
+          std::array<std::vector<double>, 3> points_1d;
+          std::array<unsigned int, 3>        n_points_1d;
+          for (unsigned int d = 0; d < 3; ++d)
+            {
+              std::vector<double> sorted = coordinates[d];
+              std::sort(sorted.begin(), sorted.end());
+              for (const double x : sorted)
+                if (points_1d[d].empty() || x - points_1d[d].back() > 1e-10)
+                  points_1d[d].push_back(x);
+              n_points_1d[d] = points_1d[d].size();
+            }
+          if (n_points_1d[0] * n_points_1d[1] * n_points_1d[2] != n_q_points)
+            return;
+
+          std::vector<unsigned int> numbering(n_q_points,
+                                              numbers::invalid_unsigned_int);
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              std::array<unsigned int, 3> indices;
+              for (unsigned int d = 0; d < 3; ++d)
+                {
+                  indices[d] = std::lower_bound(points_1d[d].begin(),
+                                                points_1d[d].end(),
+                                                coordinates[d][q] - 1e-10) -
+                               points_1d[d].begin();
+                  if (indices[d] == n_points_1d[d] ||
+                      std::abs(points_1d[d][indices[d]] - coordinates[d][q]) >
+                        1e-10)
+                    return;
+                }
+              const unsigned int index =
+                (indices[2] * n_points_1d[1] + indices[1]) * n_points_1d[0] +
+                indices[0];
+              if (numbering[index] != numbers::invalid_unsigned_int)
+                return;
+              numbering[index] = q;
+            }
+
+          // set up the modal basis phi_pqr = A_p(a) B_pq(b) C_pqr(c) of
+          // Legendre and Jacobi polynomials, see the book by Karniadakis and
+          // Sherwin, where the coefficients are enumerated with r running
+          // fastest; the degree in c is limited by p + q on tetrahedra and by
+          // max(p, q) on pyramids
+          std::vector<std::array<unsigned int, 3>> modes;
+          std::vector<unsigned int>                pairs_of_a = {0};
+          std::vector<unsigned int>                modes_of_pair = {0};
+          for (unsigned int p = 0; p <= degree; ++p)
+            {
+              for (unsigned int q = 0; q <= (is_pyramid ? degree : degree - p);
+                   ++q)
+                {
+                  const unsigned int degree_pq =
+                    is_pyramid ? std::max(p, q) : p + q;
+                  for (unsigned int r = 0;
+                       r <= (dim == 3 ? degree - degree_pq : 0);
+                       ++r)
+                    modes.push_back({{p, q, r}});
+                  modes_of_pair.push_back(modes.size());
+                }
+              pairs_of_a.push_back(modes_of_pair.size() - 1);
+            }
+          if (modes.size() != fe.n_dofs_per_cell())
+            return;
+
+          // value and derivative of (1-x)^e P_n^{(alpha,0)}(x) on the unit
+          // interval
+          const auto warped_jacobi = [](const unsigned int e,
+                                        const unsigned int n,
+                                        const int          alpha,
+                                        const double       x) {
+            const double value =
+              Polynomials::jacobi_polynomial_value(n, alpha, 0, x);
+            const double derivative =
+              n == 0 ? 0. :
+                       (n + alpha + 1) *
+                         Polynomials::jacobi_polynomial_value(n - 1,
+                                                              alpha + 1,
+                                                              1,
+                                                              x);
+            const double factor = std::pow(1. - x, e);
+            return std::array<double, 2>{
+              {factor * value,
+               factor * derivative -
+                 (e > 0 ? e * std::pow(1. - x, e - 1.) * value : 0.)}};
+          };
+
+          // the functions of the three collapsed coordinates; the first two
+          // coordinates of the pyramid are defined on [-1, 1]
+          const auto evaluate_a = [&](const unsigned int p, const double a) {
+            if (is_pyramid)
+              {
+                const auto result = warped_jacobi(0, p, 0, 0.5 * (a + 1.));
+                return std::array<double, 2>{{result[0], 0.5 * result[1]}};
+              }
+            else
+              return warped_jacobi(0, p, 0, a);
+          };
+          const auto evaluate_b =
+            [&](const unsigned int p, const unsigned int q, const double b) {
+              if (is_pyramid)
+                {
+                  const auto result = warped_jacobi(0, q, 0, 0.5 * (b + 1.));
+                  return std::array<double, 2>{{result[0], 0.5 * result[1]}};
+                }
+              else
+                return warped_jacobi(p, q, 2 * p + 1, b);
+            };
+          const auto evaluate_c = [&](const std::array<unsigned int, 3> &mode,
+                                      const double                       c) {
+            const unsigned int degree_pq =
+              is_pyramid ? std::max(mode[0], mode[1]) : mode[0] + mode[1];
+            if (dim == 2)
+              return std::array<double, 2>{{1., 0.}};
+            else
+              return warped_jacobi(degree_pq, mode[2], 2 * degree_pq + 2, c);
+          };
+
+          // the transpose of the inverse Jacobian of the collapsed
+          // transformation, which maps derivatives with respect to a, b, c
+          // to derivatives in the reference coordinates
+          const auto compute_derivative_transform =
+            [&](const std::array<double, 3> &x) {
+              const double   one_minus_c = 1. - x[2];
+              Tensor<2, dim> transform;
+              if (is_pyramid)
+                {
+                  transform[0][0]             = 1. / one_minus_c;
+                  transform[1][1]             = 1. / one_minus_c;
+                  transform[dim - 1][0]       = x[0] / one_minus_c;
+                  transform[dim - 1][1]       = x[1] / one_minus_c;
+                  transform[dim - 1][dim - 1] = 1.;
+                }
+              else
+                {
+                  const double one_minus_b = 1. - x[1];
+                  transform[0][0] = 1. / (one_minus_b * one_minus_c);
+                  transform[1][0] = x[0] / (one_minus_b * one_minus_c);
+                  transform[1][1] = 1. / one_minus_c;
+                  if (dim == 3)
+                    {
+                      transform[dim - 1][0]       = transform[1][0];
+                      transform[dim - 1][1]       = x[1] / one_minus_c;
+                      transform[dim - 1][dim - 1] = 1.;
+                    }
+                }
+              return transform;
+            };
+
+          const auto compute_reference_point =
+            [&](const std::array<double, 3> &x) {
+              const std::array<double, 3> reference_coordinates = {
+                {x[0] * (is_pyramid ? 1. : 1. - x[1]) * (1. - x[2]),
+                 x[1] * (1. - x[2]),
+                 x[2]}};
+              Point<dim> point;
+              for (unsigned int d = 0; d < dim; ++d)
+                point[d] = reference_coordinates[d];
+              return point;
+            };
+
+          // value and gradient in reference coordinates of all modal
+          // basis functions in the given point of collapsed coordinates
+          const auto evaluate_modes =
+            [&](const std::array<double, 3> &x,
+                std::vector<double>         &values,
+                std::vector<Tensor<1, dim>> &gradients) {
+              const Tensor<2, dim> transform = compute_derivative_transform(x);
+              for (unsigned int m = 0; m < modes.size(); ++m)
+                {
+                  const auto value_a = evaluate_a(modes[m][0], x[0]);
+                  const auto value_b =
+                    evaluate_b(modes[m][0], modes[m][1], x[1]);
+                  const auto value_c = evaluate_c(modes[m], x[2]);
+                  values[m]          = value_a[0] * value_b[0] * value_c[0];
+
+                  const std::array<double, 3> collapsed_gradient = {
+                    {value_a[1] * value_b[0] * value_c[0],
+                     value_a[0] * value_b[1] * value_c[0],
+                     value_a[0] * value_b[0] * value_c[1]}};
+                  for (unsigned int d = 0; d < dim; ++d)
+                    {
+                      gradients[m][d] = 0.;
+                      for (unsigned int e = 0; e < dim; ++e)
+                        gradients[m][d] +=
+                          transform[d][e] * collapsed_gradient[e];
+                    }
+                }
+            };
+
+          // express the shape functions of the element in the modal basis
+          // by an L2 projection, using a Gauss formula in the collapsed
+          // coordinates that integrates the products exactly
+          const unsigned int          n_dofs_fe = fe.n_dofs_per_cell();
+          std::vector<double>         mode_values(n_dofs_fe);
+          std::vector<Tensor<1, dim>> mode_gradients(n_dofs_fe);
+
+          const QGauss<1>     quad_projection(degree + 2);
+          const unsigned int  n_points_projection = quad_projection.size();
+          FullMatrix<double>  mass_matrix(n_dofs_fe, n_dofs_fe);
+          FullMatrix<double>  projection(n_dofs_fe, n_dofs_fe);
+          std::vector<double> shape_values(n_dofs_fe);
+          for (unsigned int qc = 0; qc < (dim == 3 ? n_points_projection : 1);
+               ++qc)
+            for (unsigned int qb = 0; qb < n_points_projection; ++qb)
+              for (unsigned int qa = 0; qa < n_points_projection; ++qa)
+                {
+                  const double a = quad_projection.point(qa)[0];
+                  const double b = quad_projection.point(qb)[0];
+                  const double c =
+                    dim == 3 ? quad_projection.point(qc)[0] : 0.;
+                  const double weight =
+                    quad_projection.weight(qa) * quad_projection.weight(qb) *
+                    (dim == 3 ? quad_projection.weight(qc) : 1.) *
+                    (is_pyramid ? 1. : 1. - b) * (1. - c) * (1. - c);
+
+                  const std::array<double, 3> x = {
+                    {is_pyramid ? 2. * a - 1. : a,
+                     is_pyramid ? 2. * b - 1. : b,
+                     c}};
+                  evaluate_modes(x, mode_values, mode_gradients);
+
+                  const Point<dim> point = compute_reference_point(x);
+                  for (unsigned int i = 0; i < n_dofs_fe; ++i)
+                    shape_values[i] = fe.shape_value(i, point);
+
+                  for (unsigned int m = 0; m < n_dofs_fe; ++m)
+                    {
+                      for (unsigned int n = 0; n < n_dofs_fe; ++n)
+                        mass_matrix(m, n) +=
+                          mode_values[m] * mode_values[n] * weight;
+                      for (unsigned int i = 0; i < n_dofs_fe; ++i)
+                        projection(m, i) +=
+                          mode_values[m] * shape_values[i] * weight;
+                    }
+                }
+          mass_matrix.gauss_jordan();
+          FullMatrix<double> modal_coefficients(n_dofs_fe, n_dofs_fe);
+          mass_matrix.mmult(modal_coefficients, projection);
+
+          // the element might use a different polynomial space, so check
+          // that the modal expansion reproduces the values and gradients of
+          // the shape functions in all quadrature points
+          for (unsigned int t = 0; t < n_q_points; ++t)
+            {
+              const std::array<double, 3> x = {
+                {points_1d[0][t % n_points_1d[0]],
+                 points_1d[1][(t / n_points_1d[0]) % n_points_1d[1]],
+                 points_1d[2][t / (n_points_1d[0] * n_points_1d[1])]}};
+              evaluate_modes(x, mode_values, mode_gradients);
+              for (unsigned int i = 0; i < n_dofs_fe; ++i)
+                {
+                  double         value = 0.;
+                  Tensor<1, dim> gradient;
+                  for (unsigned int m = 0; m < n_dofs_fe; ++m)
+                    {
+                      value += modal_coefficients(m, i) * mode_values[m];
+                      gradient +=
+                        modal_coefficients(m, i) * mode_gradients[m];
+                    }
+                  const Point<dim>    &point       = quad.point(numbering[t]);
+                  const Tensor<1, dim> gradient_fe = fe.shape_grad(i, point);
+                  if (std::abs(value - fe.shape_value(i, point)) > 1e-10 ||
+                      (gradient - gradient_fe).norm() >
+                        1e-10 * (1. + gradient_fe.norm()))
+                    return;
+                }
+            }
+
+          n_dofs               = n_dofs_fe;
+          n_q_points_1d        = n_points_1d;
+          n_modes_a            = degree + 1;
+          pair_start           = pairs_of_a;
+          mode_start           = modes_of_pair;
+          quadrature_numbering = numbering;
+
+          const unsigned int n_pairs = mode_start.size() - 1;
+          values_a.resize_fast(n_modes_a * n_q_points_1d[0]);
+          gradients_a.resize_fast(n_modes_a * n_q_points_1d[0]);
+          for (unsigned int p = 0; p < n_modes_a; ++p)
+            for (unsigned int i = 0; i < n_q_points_1d[0]; ++i)
+              {
+                const auto value = evaluate_a(p, points_1d[0][i]);
+                values_a[p * n_q_points_1d[0] + i]    = value[0];
+                gradients_a[p * n_q_points_1d[0] + i] = value[1];
+              }
+
+          values_b.resize_fast(n_pairs * n_q_points_1d[1]);
+          gradients_b.resize_fast(n_pairs * n_q_points_1d[1]);
+          for (unsigned int p = 0; p < n_modes_a; ++p)
+            for (unsigned int s = pair_start[p]; s < pair_start[p + 1]; ++s)
+              for (unsigned int j = 0; j < n_q_points_1d[1]; ++j)
+                {
+                  const auto value =
+                    evaluate_b(p, modes[mode_start[s]][1], points_1d[1][j]);
+                  values_b[s * n_q_points_1d[1] + j]    = value[0];
+                  gradients_b[s * n_q_points_1d[1] + j] = value[1];
+                }
+
+          values_c.resize_fast(n_dofs * n_q_points_1d[2]);
+          gradients_c.resize_fast(n_dofs * n_q_points_1d[2]);
+          for (unsigned int m = 0; m < n_dofs; ++m)
+            for (unsigned int k = 0; k < n_q_points_1d[2]; ++k)
+              {
+                const auto value = evaluate_c(modes[m], points_1d[2][k]);
+                values_c[m * n_q_points_1d[2] + k]    = value[0];
+                gradients_c[m * n_q_points_1d[2] + k] = value[1];
+              }
+
+          nodal_to_modal.resize_fast(n_dofs * n_dofs);
+          for (unsigned int m = 0; m < n_dofs; ++m)
+            for (unsigned int i = 0; i < n_dofs; ++i)
+              nodal_to_modal[m * n_dofs + i] = modal_coefficients(m, i);
+
+          derivative_transform.resize_fast(n_q_points * dim * dim);
+          for (unsigned int t = 0; t < n_q_points; ++t)
+            {
+              const std::array<double, 3> x = {
+                {points_1d[0][t % n_q_points_1d[0]],
+                 points_1d[1][(t / n_q_points_1d[0]) % n_q_points_1d[1]],
+                 points_1d[2][t / (n_q_points_1d[0] * n_q_points_1d[1])]}};
+              const Tensor<2, dim> transform_q =
+                compute_derivative_transform(x);
+              for (unsigned int d = 0; d < dim; ++d)
+                for (unsigned int e = 0; e < dim; ++e)
+                  derivative_transform[(t * dim + d) * dim + e] =
+                    transform_q[d][e];
+            }
+
+          // the modal coefficients, the partial sums over the third and the
+          // second coordinate with their derivatives, and the values and
+          // collapsed derivatives along one line of quadrature points during
+          // integration
+          scratch_size = n_dofs + 2 * n_pairs * n_q_points_1d[2] +
+                         3 * n_modes_a * n_q_points_1d[1] * n_q_points_1d[2] +
+                         4 * n_q_points_1d[0];
+        }
+      else
+        {
+          (void)quad;
+          (void)fe;
+        }
+    }
+
+
+
+    template <typename Number>
+    std::size_t
+    CollapsedShapeData<Number>::memory_consumption() const
+    {
+      return sizeof(*this) + MemoryConsumption::memory_consumption(pair_start) +
+             MemoryConsumption::memory_consumption(mode_start) +
+             MemoryConsumption::memory_consumption(values_a) +
+             MemoryConsumption::memory_consumption(gradients_a) +
+             MemoryConsumption::memory_consumption(values_b) +
+             MemoryConsumption::memory_consumption(gradients_b) +
+             MemoryConsumption::memory_consumption(values_c) +
+             MemoryConsumption::memory_consumption(gradients_c) +
+             MemoryConsumption::memory_consumption(nodal_to_modal) +
+             MemoryConsumption::memory_consumption(derivative_transform) +
+             MemoryConsumption::memory_consumption(quadrature_numbering);
+    }
+
+
+
     template <typename Number>
     template <int dim, int spacedim, int dim_q>
     inline ShapeInfo<Number>::ShapeInfo(
@@ -239,6 +812,9 @@ namespace internal
                               const FiniteElement<dim, spacedim> &fe_in,
                               const unsigned int base_element_number)
     {
+      wedge_data = WedgeShapeData<Number>();
+      collapsed_data = CollapsedShapeData<Number>();
+
       // ShapeInfo for RT elements. Here, data is of size 2 instead of 1.
       // data[0] is univariate_shape_data in normal direction and
       // data[1] is univariate_shape_data in tangential direction
@@ -378,6 +954,11 @@ namespace internal
                   shape_gradients[i * dim * n_q_points + q * dim + d] = grad[d];
               }
 
+          // elements on wedges with a product structure can be evaluated
+          // more cheaply in factorized form
+          wedge_data.reinit(quad, fe);
+          collapsed_data.reinit(quad, fe);
+
           {
             const auto reference_cell = fe.reference_cell();
 
@@ -1319,6 +1900,8 @@ namespace internal
       std::size_t memory = sizeof(*this);
       for (const auto &univariate_shape_data : data)
         memory += univariate_shape_data.memory_consumption();
+      memory += wedge_data.memory_consumption() - sizeof(wedge_data);
+      memory += collapsed_data.memory_consumption() - sizeof(collapsed_data);
       return memory;
     }
 
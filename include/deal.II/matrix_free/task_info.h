@@ -92,6 +92,21 @@ namespace internal
     /// MatrixFree::loop
     virtual void
     boundary(const unsigned int range_index) = 0;
+
+    /// Runs the body of the work on interior faces specified by
+    /// MatrixFree::loop on the given range of face batches
+    virtual void
+    face(const std::pair<unsigned int, unsigned int> &face_range) = 0;
+
+    /// Runs the body of the work on boundary faces specified by
+    /// MatrixFree::loop on the given range of face batches
+    virtual void
+    boundary(const std::pair<unsigned int, unsigned int> &face_range) = 0;
+
+    /// Returns whether work on faces has been specified, in which case the
+    /// loop may interleave the work on cells and faces in small steps
+    virtual bool
+    has_face_work() const = 0;
   };
 
 
@@ -530,6 +545,28 @@ namespace internal
        */
       std::vector<unsigned int> boundary_partition_data_hp_ptr;
 
+      /**
+       * Subdivision of the partitions into smaller steps for the loop that
+       * interleaves the work on cells and faces, see
+       * MatrixFree::AdditionalData::fuse_cell_and_face_loops. The entries
+       * fused_partition_data_ptr[idx] to fused_partition_data_ptr[idx+1]
+       * index the steps of partition idx. For each step, fused_partition_data
+       * stores three consecutive numbers, namely the end of the range of cell
+       * batches, of interior face batches, and of boundary face batches of
+       * the step. The ranges start at the end of the previous step, or at the
+       * start of the partition given by cell_partition_data,
+       * face_partition_data, and boundary_partition_data for the first step.
+       * Both fields are empty if the work is not interleaved.
+       */
+      std::vector<unsigned int> fused_partition_data_ptr;
+
+      /**
+       * The end points of the ranges of cell batches, interior face batches,
+       * and boundary face batches of each step of the interleaved loop, see
+       * fused_partition_data_ptr.
+       */
+      std::vector<unsigned int> fused_partition_data;
+
       /**
        * This is a linear storage of all partitions of interior faces on
        * boundaries to other processors that are not locally used, building a
@@ -17,14 +17,19 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/grid/tria.h>
 
+#include <deal.II/lac/concurrent_assembly.h>
+
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/matrix_free/portable_fe_evaluation.h>
 #include <deal.II/matrix_free/portable_matrix_free.h>
 #include <deal.II/matrix_free/vector_access_internal.h>
 
+#include <mutex>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -266,6 +271,20 @@ namespace MatrixFreeTools
    * @p matrix_free and the local cell integral operation @p cell_operation.
    * Constrained entries on the diagonal are set to one.
    *
+   * The element matrices are computed for a whole batch of cells at once by
+   * applying @p cell_operation to the unit vectors. If @p matrix_free was
+   * set up with a task-parallel scheme, i.e., with
+   * MatrixFree::AdditionalData::tasks_parallel_scheme different from
+   * MatrixFree::AdditionalData::none, the batches are distributed among the
+   * available threads, see MultithreadInfo, and @p cell_operation must be
+   * safe to be called by several threads at the same time. In that case, the
+   * element matrices are added into a SparseMatrix by the threads
+   * concurrently with atomic operations, see ConcurrentSparseMatrixAdder,
+   * whereas for the other matrix types, such as the wrappers of PETSc and
+   * Trilinos matrices, which do not support concurrent writes, only one
+   * thread at a time adds its contributions. Without a task-parallel scheme,
+   * all batches are processed by the calling thread.
+   *
    * The parameters @p dof_no, @p quad_no, and @p first_selected_component are
    * passed to the constructor of the FEEvaluation that is internally set up.
    */
@@ -2405,12 +2424,51 @@ namespace MatrixFreeTools
         internal::create_new_affine_constraints_if_needed(
           matrix, constraints_in, constraints_for_matrix);
 
-      const auto batch_operation =
-        [&matrix_free, &constraints, &matrix](
-          auto &data, const std::pair<unsigned int, unsigned int> &range) {
-          if (!data.op_compute)
-            return; // nothing to do
+      // Threads are only used if MatrixFree was set up with a task-parallel
+      // scheme, in which case several threads write into the matrix at the
+      // same time. A SparseMatrix is then written to with atomic additions
+      // through ConcurrentSparseMatrixAdder, whereas the other matrix types
+      // are protected by a mutex, such that only the computation of the
+      // element matrices runs in parallel.
+      const bool use_threads =
+        matrix_free.get_task_info().scheme !=
+        dealii::internal::MatrixFreeFunctions::TaskInfo::none;
+      std::mutex mutex;
+      const auto distribute_local_to_global =
+        [&constraints, &matrix, &mutex, use_threads](const auto &...args) {
+          if constexpr (std::is_same_v<
+                          MatrixType,
+                          SparseMatrix<typename MatrixType::value_type>> &&
+                        !numbers::NumberTraits<
+                          typename MatrixType::value_type>::is_complex)
+            {
+              if (use_threads)
+                {
+                  ConcurrentSparseMatrixAdder<typename MatrixType::value_type>
+                    matrix_adder(matrix);
+                  constraints.distribute_local_to_global(args...,
+                                                         matrix_adder);
+                  return;
+                }
+            }
 
+          if (use_threads)
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              constraints.distribute_local_to_global(args..., matrix);
+            }
+          else
+            constraints.distribute_local_to_global(args..., matrix);
+        };
+
+      // compute the element matrices of the batches [begin, end) within the
+      // given range of batches and add them into the matrix
+      const auto batch_operation_on_subrange =
+        [&matrix_free, &distribute_local_to_global](
+          auto                                        &data,
+          const std::pair<unsigned int, unsigned int> &range,
+          const unsigned int                           begin,
+          const unsigned int                           end) {
           auto phi = data.op_create(range);
 
           const unsigned int n_blocks = phi.size();
@@ -2473,7 +2531,7 @@ namespace MatrixFreeTools
                           FullMatrix<typename MatrixType::value_type>(
                             dofs_per_cell[bi], dofs_per_cell[bj]));
 
-          for (auto batch = range.first; batch < range.second; ++batch)
+          for (auto batch = begin; batch < end; ++batch)
             {
               data.op_reinit(phi, batch);
 
@@ -2534,18 +2592,40 @@ namespace MatrixFreeTools
                         // matrix if the corresponding degree of freedom
                         // is constrained, see also the documentation
                         // of AffineConstraints::distribute_local_to_global()
-                        constraints.distribute_local_to_global(
-                          matrices[bi][bi][v], dof_indices_mf[bi][v], matrix);
+                        distribute_local_to_global(matrices[bi][bi][v],
+                                                   dof_indices_mf[bi][v]);
                       else
-                        constraints.distribute_local_to_global(
-                          matrices[bi][bj][v],
-                          dof_indices_mf[bi][v],
-                          dof_indices_mf[bj][v],
-                          matrix);
+                        distribute_local_to_global(matrices[bi][bj][v],
+                                                   dof_indices_mf[bi][v],
+                                                   dof_indices_mf[bj][v]);
                 }
             }
         };
 
+      // Each batch requires as many evaluations of the operator as there are
+      // unknowns per cell, so the batches of a range are distributed among
+      // the threads if a task-parallel scheme was selected in MatrixFree.
+      const auto batch_operation =
+        [&batch_operation_on_subrange, use_threads](
+          auto &data, const std::pair<unsigned int, unsigned int> &range) {
+          if (!data.op_compute)
+            return; // nothing to do
+
+          if (use_threads)
+            parallel::apply_to_subranges(
+              range.first,
+              range.second,
+              [&](const unsigned int begin, const unsigned int end) {
+                batch_operation_on_subrange(data, range, begin, end);
+              },
+              1);
+          else
+            batch_operation_on_subrange(data,
+                                        range,
+                                        range.first,
+                                        range.second);
+        };
+
       const auto cell_operation_wrapped =
         [&](const auto &, auto &, const auto &, const auto range) {
           batch_operation(data_cell, range);
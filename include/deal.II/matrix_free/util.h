@@ -59,6 +59,12 @@ namespace internal
                       dealii::hp::QCollection<dim - 1>(
                         QWitherdenVincentSimplex<dim - 1>(i))};
 
+          for (unsigned int i = 1; i <= 5; ++i)
+            if (quad == QCollapsedGaussSimplex<dim>(i))
+              return {ReferenceCells::get_simplex<dim>(),
+                      dealii::hp::QCollection<dim - 1>(
+                        QCollapsedGaussSimplex<dim - 1>(i))};
+
           for (unsigned int i = 1; i <= 3; ++i)
             {
               const FE_SimplexP<dim> fe(i);
@@ -150,6 +156,17 @@ namespace internal
                           QWitherdenVincentSimplex<dim - 1>(i)};
               }
 
+          for (unsigned int i = 1; i <= 5; ++i)
+            if (quad == QCollapsedGaussSimplex<dim>(i))
+              {
+                if (dim == 2)
+                  return {QCollapsedGaussSimplex<dim - 1>(i), // line!
+                          Quadrature<dim - 1>()};
+                else
+                  return {Quadrature<dim - 1>(),
+                          QCollapsedGaussSimplex<dim - 1>(i)};
+              }
+
           for (unsigned int i = 1; i <= 3; ++i)
             {
               const FE_SimplexP<dim> fe(i);
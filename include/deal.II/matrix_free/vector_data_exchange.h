@@ -283,6 +283,23 @@ namespace internal
         MPI_Comm
         get_sm_mpi_communicator() const;
 
+        /**
+         * Signal to the processes of the shared-memory communicator whose
+         * memory the present process has accessed in the preceding call to
+         * export_to_ghosted_array_finish() (if @p vector_operation is
+         * VectorOperation::insert) or import_from_ghosted_array_finish()
+         * (otherwise) that it is done, and wait for the same signal from the
+         * processes that have accessed the memory of the present process.
+         * Afterwards, the locally owned and ghost entries may be modified
+         * again. In contrast to a barrier on the shared-memory communicator,
+         * only the neighbors in the shared-memory domain exchange (zero-byte)
+         * messages.
+         */
+        void
+        finish_shared_memory_access(
+          const VectorOperation::values vector_operation,
+          const unsigned int            communication_channel) const;
+
         void
         export_to_ghosted_array_start(
           const unsigned int                          communication_channel,
@@ -0,0 +1,524 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_cell_schwarz_h
+#define dealii_mg_cell_schwarz_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <array>
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+#ifndef DOXYGEN
+namespace internal
+{
+  namespace MGCellSchwarz
+  {
+    // compute the mass and Laplace matrices of the 1d shape functions on the
+    // unit interval, without any face terms
+    template <typename Number>
+    void
+    compute_unit_matrices(
+      const MatrixFreeFunctions::UnivariateShapeData<Number> &shape_data,
+      Table<2, double>                                       &mass_unit,
+      Table<2, double>                                       &laplace_unit)
+    {
+      const unsigned int n          = shape_data.fe_degree + 1;
+      const unsigned int n_q_points = shape_data.n_q_points_1d;
+
+      mass_unit.reinit(n, n);
+      laplace_unit.reinit(n, n);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j < n; ++j)
+          {
+            double sum_mass = 0, sum_laplace = 0;
+            for (unsigned int q = 0; q < n_q_points; ++q)
+              {
+                const double weight = shape_data.quadrature.weight(q);
+                sum_mass += shape_data.shape_values[i * n_q_points + q] *
+                            shape_data.shape_values[j * n_q_points + q] *
+                            weight;
+                sum_laplace +=
+                  shape_data.shape_gradients[i * n_q_points + q] *
+                  shape_data.shape_gradients[j * n_q_points + q] * weight;
+              }
+            mass_unit(i, j)    = sum_mass;
+            laplace_unit(i, j) = sum_laplace;
+          }
+    }
+
+
+
+    // compute the extent of the Cartesian surrogate of the cells of the batch
+    // that phi is set to, i.e., the average length of the columns of the
+    // Jacobian of the mapping, weighted by the JxW values
+    template <int dim, typename Number, typename VectorizedArrayType>
+    std::array<VectorizedArrayType, dim>
+    compute_cartesian_extent(
+      const FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> &phi)
+    {
+      std::array<VectorizedArrayType, dim> extent;
+      VectorizedArrayType                  volume = 0.;
+      for (unsigned int d = 0; d < dim; ++d)
+        extent[d] = 0.;
+      for (const unsigned int q : phi.quadrature_point_indices())
+        {
+          const Tensor<2, dim, VectorizedArrayType> jacobian =
+            invert(phi.inverse_jacobian(q));
+          const VectorizedArrayType JxW = phi.JxW(q);
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              VectorizedArrayType length_square = 0.;
+              for (unsigned int e = 0; e < dim; ++e)
+                length_square += jacobian[e][d] * jacobian[e][d];
+              extent[d] += std::sqrt(length_square) * JxW;
+            }
+          volume += JxW;
+        }
+      for (unsigned int d = 0; d < dim; ++d)
+        extent[d] /= volume;
+
+      return extent;
+    }
+  } // namespace MGCellSchwarz
+} // namespace internal
+#endif
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * The cell-wise block-Jacobi preconditioner of step-59 in a reusable form,
+ * i.e., a non-overlapping additive Schwarz method with one subdomain per
+ * cell, for discontinuous Galerkin discretizations of the Laplacian with the
+ * symmetric interior penalty method, set up from a MatrixFree object. It is
+ * meant as inner preconditioner of a PreconditionChebyshev smoother in
+ * geometric multigrid methods, where it gives considerably better smoothing
+ * than the point-Jacobi method for elements of high polynomial degree, at a
+ * cost per application that is comparable to a matrix-vector product.
+ * Overlapping subdomains, i.e., patches of the cells around a vertex, are
+ * provided by the class PreconditionVertexPatchSchwarz.
+ *
+ * The cell matrices of the interior penalty method are approximated by the
+ * Kronecker form
+ * @f[
+ *   A_\text{cell} \approx \sum_{d=1}^{\text{dim}} M_\text{dim} \otimes \cdots
+ *   \otimes K_d \otimes \cdots \otimes M_1,
+ * @f]
+ * where $M_d$ is the 1d mass matrix and $K_d$ the 1d Laplace matrix including
+ * the face terms of the interior penalty method with penalty parameter
+ * $\sigma = \text{penalty\_factor} / h_d$, see AdditionalData::penalty_factor.
+ * The approximate cell matrices are inverted by the fast diagonalization
+ * method with the class TensorProductMatrixSymmetricSumCollection, which
+ * stores the 1d matrices only once if they are the same on several cells.
+ * The following approximations are made:
+ * <ul>
+ * <li> The 1d matrices are computed from the 1d shape functions and the 1d
+ * quadrature formula stored in the MatrixFree object. The face terms use a
+ * weight of one half for the derivative terms on all faces, i.e., the terms
+ * at interior faces are also used at the boundary.
+ * <li> Cells are replaced by a Cartesian surrogate: The extent $h_d$ in
+ * direction $d$ is the average length of the $d$-th column of the Jacobian
+ * of the mapping over the quadrature points, weighted by the
+ * $\text{JxW}$ values. For affine, axis-parallel cells, this gives the exact
+ * cell matrices of the interior penalty method without the coupling to the
+ * neighbors.
+ * </ul>
+ *
+ * Since the degrees of freedom of different cells are disjoint for DG
+ * elements, the subdomain problems are independent. The vmult() function
+ * works on batches of cells, vectorized over the lanes of
+ * @p VectorizedArrayType, and distributes the batches among the available
+ * threads. It does not need to exchange ghost values.
+ *
+ * The class only works for scalar discontinuous tensor-product elements such
+ * as FE_DGQ or FE_DGQHermite on hypercube cells.
+ *
+ * A typical use as smoother is:
+ * @code
+ * using SmootherType =
+ *   PreconditionChebyshev<LevelMatrixType,
+ *                         LinearAlgebra::distributed::Vector<float>,
+ *                         PreconditionCellSchwarz<dim, float>>;
+ * MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+ *   0, n_levels - 1);
+ * for (unsigned int level = 0; level < n_levels; ++level)
+ *   {
+ *     smoother_data[level].preconditioner =
+ *       std::make_shared<PreconditionCellSchwarz<dim, float>>();
+ *     smoother_data[level].preconditioner->initialize(
+ *       *mg_matrices[level].get_matrix_free());
+ *     smoother_data[level].smoothing_range = 15.;
+ *     smoother_data[level].degree          = 3;
+ *   }
+ * @endcode
+ *
+ * The object stores a pointer to the MatrixFree object, which must be kept
+ * alive as long as the preconditioner is used.
+ */
+template <int dim,
+          typename Number,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class PreconditionCellSchwarz : public EnableObserverPointer
+{
+public:
+  /**
+   * The type of vectors this preconditioner works on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * The underlying scalar type.
+   */
+  using value_type = Number;
+
+  /**
+   * Parameters of the preconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const double       penalty_factor    = -1.,
+                   const unsigned int dof_index         = 0,
+                   const unsigned int quad_index        = 0,
+                   const bool         compress_matrices = true);
+
+    /**
+     * The factor of the penalty parameter of the interior penalty method,
+     * i.e., the penalty parameter on a face is this factor divided by the
+     * extent of the cell normal to the face. It should match the one of the
+     * operator the preconditioner is used for. A negative value selects
+     * $k(k+1)$ for elements of degree $k$, which is the choice of step-59.
+     */
+    double penalty_factor;
+
+    /**
+     * The index of the DoFHandler within the MatrixFree object.
+     */
+    unsigned int dof_index;
+
+    /**
+     * The index of the quadrature formula within the MatrixFree object that
+     * is used for the 1d matrices and for the Cartesian surrogate.
+     */
+    unsigned int quad_index;
+
+    /**
+     * Store the 1d matrices only once if they are the same on several
+     * cells, see the member @p compress_matrices of
+     * TensorProductMatrixSymmetricSumCollection::AdditionalData.
+     */
+    bool compress_matrices;
+  };
+
+  /**
+   * Constructor. The object needs to be set up with initialize() before it
+   * can be used.
+   */
+  PreconditionCellSchwarz() = default;
+
+  /**
+   * Compute the approximate cell matrices and their inverses for all cells
+   * of @p matrix_free. Previous content of this object is lost.
+   */
+  void
+  initialize(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory and return to the state directly after the
+   * constructor was called.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the preconditioner, i.e., the inverse of the approximate cell
+   * matrix on every cell. All locally owned entries of @p dst are
+   * overwritten.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner. Since the cell matrices are
+   * symmetric, this is the same as vmult().
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcNotInitialized,
+                   "The preconditioner has not been set up. Call "
+                   "initialize() before using it.");
+
+private:
+  /**
+   * A pointer to the MatrixFree object.
+   */
+  ObserverPointer<const MatrixFree<dim, Number, VectorizedArrayType>,
+                  PreconditionCellSchwarz>
+    matrix_free;
+
+  /**
+   * The index of the DoFHandler within the MatrixFree object.
+   */
+  unsigned int dof_index = 0;
+
+  /**
+   * The index of the quadrature formula within the MatrixFree object.
+   */
+  unsigned int quad_index = 0;
+
+  /**
+   * The fast diagonalization of the approximate cell matrices, indexed by
+   * the cell batch.
+   */
+  std::unique_ptr<
+    TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>
+    cell_matrices;
+
+  /**
+   * The minimal number of cell batches that vmult() assigns to a thread.
+   */
+  static constexpr unsigned int minimum_parallel_grain_size = 16;
+};
+
+/** @} */
+
+/* --------------------------- inline functions --------------------------- */
+
+#ifndef DOXYGEN
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline PreconditionCellSchwarz<dim, Number, VectorizedArrayType>::
+  AdditionalData::AdditionalData(const double       penalty_factor,
+                                 const unsigned int dof_index,
+                                 const unsigned int quad_index,
+                                 const bool         compress_matrices)
+  : penalty_factor(penalty_factor)
+  , dof_index(dof_index)
+  , quad_index(quad_index)
+  , compress_matrices(compress_matrices)
+{}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionCellSchwarz<dim, Number, VectorizedArrayType>::initialize(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  const AdditionalData                               &additional_data)
+{
+  clear();
+
+  this->matrix_free = &matrix_free;
+  dof_index         = additional_data.dof_index;
+  quad_index        = additional_data.quad_index;
+
+  const FiniteElement<dim> &fe =
+    matrix_free.get_dof_handler(dof_index).get_fe();
+  const auto &shape_data =
+    matrix_free.get_shape_info(dof_index, quad_index).data[0];
+  const unsigned int n = shape_data.fe_degree + 1;
+  AssertThrow(fe.n_components() == 1 && fe.n_dofs_per_vertex() == 0 &&
+                fe.reference_cell().is_hyper_cube() &&
+                fe.n_dofs_per_cell() == Utilities::pow(n, dim),
+              ExcMessage("PreconditionCellSchwarz only works for scalar "
+                         "discontinuous tensor-product elements."));
+
+  // compute the 1d mass and Laplace matrices on the unit interval,
+  // including the face terms of the interior penalty method on both ends
+  const double penalty_factor =
+    additional_data.penalty_factor < 0. ?
+      static_cast<double>(shape_data.fe_degree * (shape_data.fe_degree + 1)) :
+      additional_data.penalty_factor;
+  const auto &values_0 = shape_data.shape_data_on_face[0];
+  const auto &values_1 = shape_data.shape_data_on_face[1];
+
+  Table<2, double> mass_unit, laplace_unit;
+  internal::MGCellSchwarz::compute_unit_matrices(shape_data,
+                                                 mass_unit,
+                                                 laplace_unit);
+
+  // the outer normal is -1 at the left end and +1 at the right end of the
+  // interval
+  for (unsigned int i = 0; i < n; ++i)
+    for (unsigned int j = 0; j < n; ++j)
+      {
+        laplace_unit(i, j) += penalty_factor * values_0[i] * values_0[j] +
+                              0.5 * values_0[n + i] * values_0[j] +
+                              0.5 * values_0[n + j] * values_0[i];
+        laplace_unit(i, j) += penalty_factor * values_1[i] * values_1[j] -
+                              0.5 * values_1[n + i] * values_1[j] -
+                              0.5 * values_1[n + j] * values_1[i];
+      }
+
+  // go through the cell batches, compute the extent of the Cartesian
+  // surrogate of each cell, and scale the 1d matrices accordingly: the mass
+  // matrix scales with h, the Laplace matrix including the penalty terms
+  // with 1/h
+  const unsigned int n_cell_batches = matrix_free.n_cell_batches();
+  cell_matrices = std::make_unique<
+    TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>(
+    typename TensorProductMatrixSymmetricSumCollection<dim,
+                                                       VectorizedArrayType>::
+      AdditionalData(additional_data.compress_matrices));
+  cell_matrices->reserve(n_cell_batches);
+
+  FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(matrix_free,
+                                                               dof_index,
+                                                               quad_index);
+  std::array<Table<2, VectorizedArrayType>, dim> mass_matrices;
+  std::array<Table<2, VectorizedArrayType>, dim> laplace_matrices;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      mass_matrices[d].reinit(n, n);
+      laplace_matrices[d].reinit(n, n);
+    }
+
+  for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      phi.reinit(cell);
+      std::array<VectorizedArrayType, dim> extent =
+        internal::MGCellSchwarz::compute_cartesian_extent(phi);
+
+      // fill unused lanes of the last batch by the first cell to keep the
+      // matrices invertible
+      const unsigned int n_filled_lanes =
+        matrix_free.n_active_entries_per_cell_batch(cell);
+      for (unsigned int d = 0; d < dim; ++d)
+        for (unsigned int v = n_filled_lanes; v < VectorizedArrayType::size();
+             ++v)
+          extent[d][v] = extent[d][0];
+
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          const VectorizedArrayType inverse_extent =
+            VectorizedArrayType(1.) / extent[d];
+          for (unsigned int i = 0; i < n; ++i)
+            for (unsigned int j = 0; j < n; ++j)
+              {
+                mass_matrices[d](i, j) = extent[d] * mass_unit(i, j);
+                laplace_matrices[d](i, j) =
+                  inverse_extent * laplace_unit(i, j);
+              }
+        }
+
+      cell_matrices->insert(cell, mass_matrices, laplace_matrices);
+    }
+
+  cell_matrices->finalize();
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionCellSchwarz<dim, Number, VectorizedArrayType>::clear()
+{
+  cell_matrices.reset();
+  matrix_free = nullptr;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionCellSchwarz<dim, Number, VectorizedArrayType>::vmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  Assert(cell_matrices != nullptr, ExcNotInitialized());
+
+  // the cells of a DG discretization have independent unknowns, so we can
+  // overwrite the content of dst and work on the cell batches in any order
+  parallel::apply_to_subranges(
+    0U,
+    matrix_free->n_cell_batches(),
+    [&](const unsigned int begin, const unsigned int end) {
+      FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(
+        *matrix_free, dof_index, quad_index);
+      for (unsigned int cell = begin; cell < end; ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          cell_matrices->apply_inverse(
+            cell,
+            ArrayView<VectorizedArrayType>(phi.begin_dof_values(),
+                                           phi.dofs_per_cell),
+            ArrayView<const VectorizedArrayType>(phi.begin_dof_values(),
+                                                 phi.dofs_per_cell));
+          phi.set_dof_values(dst);
+        }
+    },
+    minimum_parallel_grain_size);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionCellSchwarz<dim, Number, VectorizedArrayType>::Tvmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline std::size_t
+PreconditionCellSchwarz<dim, Number, VectorizedArrayType>::memory_consumption()
+  const
+{
+  return sizeof(*this) +
+         (cell_matrices != nullptr ? cell_matrices->memory_consumption() : 0);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/partitioner.h>
 
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/householder.h>
@@ -289,6 +290,115 @@ private:
   LAPACKFullMatrix<number> matrix;
 };
 
+
+
+/**
+ * Coarse grid solver that runs another coarse grid solver on the
+ * subcommunicator of the processes that own unknowns on the coarse level.
+ *
+ * On the coarsest levels of global-coarsening multigrid, the few remaining
+ * cells are typically agglomerated on a small number of processes by a
+ * repartitioning policy, see
+ * MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence() and
+ * RepartitioningPolicyTools::MinimalGranularityPolicy. The transfer between
+ * the levels, MGTwoLevelTransfer, then moves the data between the
+ * partitionings of the levels. However, all processes remain part of the
+ * communicator of the coarse level, so that each collective operation of an
+ * iterative coarse-grid solver, like the inner products of SolverCG, would
+ * involve all processes. This class instead hands the coarse-grid problem to
+ * a solver set up on a triangulation that only lives on the processes with
+ * cells, as created by
+ * MGTransferGlobalCoarseningTools::create_agglomerated_triangulation() from
+ * the coarse level, which must be a parallel::fullydistributed::Triangulation.
+ * Since the unknowns are enumerated in the same way on both triangulations,
+ * the locally owned values are simply copied between the vectors of the
+ * coarse level and those of the subcommunicator, without any communication.
+ *
+ * A typical setup looks as follows:
+ * @code
+ * const auto agglomerated_tria =
+ *   MGTransferGlobalCoarseningTools::create_agglomerated_triangulation(
+ *     *trias[0]);
+ *
+ * MGCoarseGridAgglomeration<VectorType> mg_coarse;
+ * if (agglomerated_tria != nullptr)
+ *   {
+ *     // set up a DoFHandler, the operator, and a coarse-grid solver
+ *     // coarse_grid_solver on agglomerated_tria, as on the coarse level
+ *     ...
+ *     mg_coarse.initialize(coarse_grid_solver, partitioner);
+ *   }
+ * @endcode
+ * On the processes that do not own cells, the object is left uninitialized
+ * and the operator() simply returns.
+ *
+ * The class is intended for vectors of type
+ * LinearAlgebra::distributed::Vector.
+ */
+template <typename VectorType>
+class MGCoarseGridAgglomeration : public MGCoarseGridBase<VectorType>
+{
+public:
+  /**
+   * Default constructor, leaving an uninitialized object as needed on the
+   * processes that are not part of the subcommunicator.
+   */
+  MGCoarseGridAgglomeration();
+
+  /**
+   * Constructor, see initialize().
+   */
+  MGCoarseGridAgglomeration(
+    const MGCoarseGridBase<VectorType> &coarse_grid_solver,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner);
+
+  /**
+   * Initialize the object with a @p coarse_grid_solver that works on vectors
+   * with the parallel layout given by @p partitioner on the subcommunicator.
+   * Only a reference to the solver is stored, so its lifetime needs to
+   * exceed the usage in this class.
+   */
+  void
+  initialize(
+    const MGCoarseGridBase<VectorType> &coarse_grid_solver,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner);
+
+  /**
+   * Clear the pointer to the solver and the internal vectors.
+   */
+  void
+  clear();
+
+  /**
+   * Implementation of the abstract function. Copies @p src into a vector on
+   * the subcommunicator, calls the solver given to initialize(), and copies
+   * the result back into @p dst.
+   */
+  void
+  operator()(const unsigned int level,
+             VectorType        &dst,
+             const VectorType  &src) const override;
+
+private:
+  /**
+   * Reference to the solver on the subcommunicator.
+   */
+  ObserverPointer<const MGCoarseGridBase<VectorType>,
+                  MGCoarseGridAgglomeration<VectorType>>
+    coarse_grid_solver;
+
+  /**
+   * The parallel layout of the vectors on the subcommunicator.
+   */
+  std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
+
+  /**
+   * Source and destination vectors on the subcommunicator.
+   */
+  mutable VectorType src_agglomerated;
+  mutable VectorType dst_agglomerated;
+};
+
 /** @} */
 
 #ifndef DOXYGEN
@@ -563,6 +673,79 @@ MGCoarseGridSVD<number, VectorType>::log() const
 }
 
 
+/* ------------------ Functions for MGCoarseGridAgglomeration ------------ */
+
+template <typename VectorType>
+MGCoarseGridAgglomeration<VectorType>::MGCoarseGridAgglomeration()
+  : coarse_grid_solver(nullptr)
+{}
+
+
+
+template <typename VectorType>
+MGCoarseGridAgglomeration<VectorType>::MGCoarseGridAgglomeration(
+  const MGCoarseGridBase<VectorType>                       &coarse_grid_solver,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+  : coarse_grid_solver(nullptr)
+{
+  initialize(coarse_grid_solver, partitioner);
+}
+
+
+
+template <typename VectorType>
+void
+MGCoarseGridAgglomeration<VectorType>::initialize(
+  const MGCoarseGridBase<VectorType>                       &coarse_grid_solver_,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner_)
+{
+  coarse_grid_solver = &coarse_grid_solver_;
+  partitioner        = partitioner_;
+  src_agglomerated.reinit(partitioner);
+  dst_agglomerated.reinit(partitioner);
+}
+
+
+
+template <typename VectorType>
+void
+MGCoarseGridAgglomeration<VectorType>::clear()
+{
+  coarse_grid_solver = nullptr;
+  partitioner.reset();
+  src_agglomerated.reinit(0);
+  dst_agglomerated.reinit(0);
+}
+
+
+
+template <typename VectorType>
+void
+MGCoarseGridAgglomeration<VectorType>::operator()(const unsigned int level,
+                                                  VectorType        &dst,
+                                                  const VectorType  &src) const
+{
+  if (coarse_grid_solver == nullptr)
+    {
+      // this process does not own unknowns on the coarse level and is not
+      // part of the subcommunicator
+      AssertDimension(src.locally_owned_size(), 0);
+      dst = 0;
+      return;
+    }
+
+  Assert(src.get_partitioner()->local_range() == partitioner->local_range(),
+         ExcMessage("The locally owned ranges of the vectors on the coarse "
+                    "level and on the subcommunicator do not match. Make "
+                    "sure that the same unknowns are owned on both "
+                    "triangulations."));
+
+  src_agglomerated.copy_locally_owned_data_from(src);
+  (*coarse_grid_solver)(level, dst_agglomerated, src_agglomerated);
+  dst.copy_locally_owned_data_from(dst_agglomerated);
+}
+
+
 #endif // DOXYGEN
 
 DEAL_II_NAMESPACE_CLOSE
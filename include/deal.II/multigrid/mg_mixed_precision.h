@@ -0,0 +1,503 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_mixed_precision_h
+#define dealii_mg_mixed_precision_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/precondition.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+#ifndef DOXYGEN
+namespace internal
+{
+  namespace PreconditionMGMixedPrecisionImplementation
+  {
+    // a helper type-trait leveraging SFINAE to figure out if type T has
+    // ... T::get_matrix_diagonal_inverse() const
+    template <typename T>
+    using get_matrix_diagonal_inverse_t =
+      decltype(std::declval<const T>().get_matrix_diagonal_inverse());
+
+    template <typename T>
+    constexpr bool has_get_matrix_diagonal_inverse =
+      is_supported_operation<get_matrix_diagonal_inverse_t, T>;
+
+
+
+    // a helper type-trait leveraging SFINAE to figure out if type T has
+    // void T::compute_inverse_diagonal(VectorType &) const
+    template <typename T, typename VectorType>
+    using compute_inverse_diagonal_t =
+      decltype(std::declval<const T>().compute_inverse_diagonal(
+        std::declval<VectorType &>()));
+
+    template <typename T, typename VectorType>
+    constexpr bool has_compute_inverse_diagonal =
+      is_supported_operation<compute_inverse_diagonal_t, T, VectorType>;
+  } // namespace PreconditionMGMixedPrecisionImplementation
+} // namespace internal
+#endif
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * A geometric multigrid preconditioner with Chebyshev smoothing on all
+ * levels whose level operators, smoothers, and transfers work in a precision
+ * that may differ from the one of the outer solver. The typical use case
+ * are matrix-free level operators and transfers in single precision, i.e.,
+ * with @p VectorType set to LinearAlgebra::distributed::Vector<float>, within
+ * a conjugate gradient solver working on vectors of type
+ * LinearAlgebra::distributed::Vector<double>. Since the cost of matrix-free
+ * operator evaluation, of the smoothers, and of the transfers is mostly
+ * determined by the memory transfer of the vectors and of the cached
+ * geometry, running the multigrid cycle in single precision makes it up to
+ * twice as fast, whereas the accuracy of the final solution is determined by
+ * the outer solver only.
+ *
+ * The class collects the setup that programs such as step-37 and step-75 do
+ * by hand:
+ * <ul>
+ * <li> On every level but the coarsest one, a PreconditionChebyshev object
+ * with the inverse of the diagonal of the level operator as inner
+ * preconditioner is set up as pre- and post-smoother, using the parameters
+ * AdditionalData::smoothing_degree, AdditionalData::smoothing_range, and
+ * AdditionalData::eig_cg_n_iterations.
+ * <li> On the coarsest level, a PreconditionChebyshev object with degree
+ * numbers::invalid_unsigned_int is used as coarse solver, i.e., the
+ * Chebyshev iteration is run until the residual has been reduced by
+ * AdditionalData::coarse_tolerance, see
+ * PreconditionChebyshev::AdditionalData::degree. This works in the
+ * precision of the levels as well and does not need a matrix.
+ * <li> These objects are combined into a Multigrid object with the given
+ * transfer and the cycle AdditionalData::cycle, and wrapped into a
+ * PreconditionMG object.
+ * </ul>
+ *
+ * The inverse of the diagonal is obtained from the level operators. If
+ * @p LevelMatrixType provides a function
+ * <code>get_matrix_diagonal_inverse()</code> like the classes derived from
+ * MatrixFreeOperators::Base, that one is used, which requires that the
+ * diagonal has been computed with <code>compute_diagonal()</code> before
+ * calling initialize(). Otherwise, @p LevelMatrixType must provide a function
+ * <code>compute_inverse_diagonal(VectorType &) const</code> that fills the
+ * given vector, as the operators in step-75 do.
+ *
+ * The vmult() function is a template on the vector type of the outer solver.
+ * The conversion between that vector type and @p VectorType is done once in
+ * each application of the preconditioner by the functions
+ * <code>copy_to_mg()</code> and <code>copy_from_mg()</code> of the transfer
+ * object, when the right hand side is copied to the finest level and the
+ * result back from it, whereas the smoothers work in place on the level
+ * vectors. Both MGTransferMF and MGTransferMatrixFree support this. A typical
+ * use is:
+ * @code
+ * using LevelVectorType = LinearAlgebra::distributed::Vector<float>;
+ * using VectorType      = LinearAlgebra::distributed::Vector<double>;
+ *
+ * MGLevelObject<LevelMatrixType> mg_matrices(0, n_levels - 1);
+ * // set up level operators with MatrixFree<dim, float> and call
+ * // compute_diagonal() on them
+ * ...
+ * MGTransferMF<dim, float> mg_transfer(mg_constrained_dofs);
+ * mg_transfer.build(dof_handler);
+ *
+ * PreconditionMGMixedPrecision<dim,
+ *                              LevelVectorType,
+ *                              LevelMatrixType,
+ *                              MGTransferMF<dim, float>>
+ *   preconditioner;
+ * preconditioner.initialize(dof_handler, mg_matrices, mg_transfer);
+ *
+ * SolverCG<VectorType> solver(solver_control);
+ * solver.solve(system_matrix, solution, system_rhs, preconditioner);
+ * @endcode
+ *
+ * The object stores pointers to the DoFHandler, the level operators, and the
+ * transfer passed to initialize(), so these objects must be kept alive as
+ * long as the preconditioner is used.
+ *
+ * @note For local smoothing on adaptively refined meshes, the interface
+ * matrices need to be passed to the Multigrid object returned by
+ * get_multigrid() with Multigrid::set_edge_in_matrices() and
+ * Multigrid::set_edge_out_matrices() after initialize(). This is not
+ * necessary for global coarsening with MGTransferGlobalCoarsening.
+ */
+template <int dim,
+          typename VectorType,
+          typename LevelMatrixType,
+          typename TransferType>
+class PreconditionMGMixedPrecision : public EnableObserverPointer
+{
+public:
+  /**
+   * The type of the inner preconditioner of the Chebyshev smoothers.
+   */
+  using SmootherPreconditionerType = DiagonalMatrix<VectorType>;
+
+  /**
+   * The type of the smoothers on the levels.
+   */
+  using SmootherType = PreconditionChebyshev<LevelMatrixType,
+                                             VectorType,
+                                             SmootherPreconditionerType>;
+
+  /**
+   * Parameters of the smoothers, the coarse solver, and the cycle.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor. The default values correspond to the settings of
+     * step-37.
+     */
+    AdditionalData(const unsigned int smoothing_degree    = 5,
+                   const double       smoothing_range     = 15.,
+                   const unsigned int eig_cg_n_iterations = 10,
+                   const double       coarse_tolerance    = 1e-3,
+                   const typename Multigrid<VectorType>::Cycle cycle =
+                     Multigrid<VectorType>::v_cycle);
+
+    /**
+     * The degree of the Chebyshev smoothers, see
+     * PreconditionChebyshev::AdditionalData::degree.
+     */
+    unsigned int smoothing_degree;
+
+    /**
+     * The range of eigenvalues the Chebyshev smoothers act on, see
+     * PreconditionChebyshev::AdditionalData::smoothing_range.
+     */
+    double smoothing_range;
+
+    /**
+     * The number of iterations of the eigenvalue estimate of the Chebyshev
+     * smoothers, see
+     * PreconditionChebyshev::AdditionalData::eig_cg_n_iterations.
+     */
+    unsigned int eig_cg_n_iterations;
+
+    /**
+     * The relative reduction of the residual the Chebyshev iteration on the
+     * coarsest level runs to.
+     */
+    double coarse_tolerance;
+
+    /**
+     * The type of the multigrid cycle.
+     */
+    typename Multigrid<VectorType>::Cycle cycle;
+  };
+
+  /**
+   * Constructor. The object needs to be set up with initialize() before it
+   * can be used.
+   */
+  PreconditionMGMixedPrecision() = default;
+
+  /**
+   * Set up the smoothers, the coarse solver, and the multigrid cycle for the
+   * level operators @p level_matrices, which may be given as objects or as
+   * (smart) pointers, and the given @p transfer. Previous content of this
+   * object is lost.
+   */
+  template <typename MatrixType2>
+  void
+  initialize(const DoFHandler<dim>            &dof_handler,
+             const MGLevelObject<MatrixType2> &level_matrices,
+             const TransferType               &transfer,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory and return to the state directly after the
+   * constructor was called.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the preconditioner. The vectors @p dst and @p src may be of a type
+   * different from @p VectorType, see the general documentation of this
+   * class.
+   */
+  template <typename OtherVectorType>
+  void
+  vmult(OtherVectorType &dst, const OtherVectorType &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner. Since the same smoother is
+   * used for pre- and post-smoothing, this is the same as vmult().
+   */
+  template <typename OtherVectorType>
+  void
+  Tvmult(OtherVectorType &dst, const OtherVectorType &src) const;
+
+  /**
+   * Return the underlying Multigrid object, e.g., to connect to its
+   * signals.
+   */
+  Multigrid<VectorType> &
+  get_multigrid();
+
+  /**
+   * Return the smoother on the given @p level. On the coarsest level, this
+   * is the Chebyshev iteration used as coarse solver.
+   */
+  const SmootherType &
+  get_smoother(const unsigned int level) const;
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcNotInitialized,
+                   "The preconditioner has not been set up. Call "
+                   "initialize() before using it.");
+
+private:
+  /**
+   * The level operators.
+   */
+  mg::Matrix<VectorType> mg_matrix;
+
+  /**
+   * The smoothers on all levels, including the Chebyshev iteration used as
+   * coarse solver.
+   */
+  MGSmootherPrecondition<LevelMatrixType, SmootherType, VectorType> mg_smoother;
+
+  /**
+   * The coarse solver, applying the smoother of the coarsest level.
+   */
+  MGCoarseGridApplySmoother<VectorType> mg_coarse;
+
+  /**
+   * The multigrid object, combining the objects above with the transfer.
+   */
+  std::unique_ptr<Multigrid<VectorType>> multigrid;
+
+  /**
+   * The preconditioner wrapping the multigrid cycle.
+   */
+  std::unique_ptr<PreconditionMG<dim, VectorType, TransferType>>
+    preconditioner;
+};
+
+/** @} */
+
+/* --------------------------- inline functions --------------------------- */
+
+#ifndef DOXYGEN
+
+template <int dim,
+          typename VectorType,
+          typename LevelMatrixType,
+          typename TransferType>
+inline PreconditionMGMixedPrecision<dim,
+                                    VectorType,
+                                    LevelMatrixType,
+                                    TransferType>::AdditionalData::
+  AdditionalData(const unsigned int smoothing_degree,
+                 const double       smoothing_range,
+                 const unsigned int eig_cg_n_iterations,
+                 const double       coarse_tolerance,
+                 const typename Multigrid<VectorType>::Cycle cycle)
+  : smoothing_degree(smoothing_degree)
+  , smoothing_range(smoothing_range)
+  , eig_cg_n_iterations(eig_cg_n_iterations)
+  , coarse_tolerance(coarse_tolerance)
+  , cycle(cycle)
+{}
+
+
+
+template <int dim,
+          typename VectorType,
+          typename LevelMatrixType,
+          typename TransferType>
+template <typename MatrixType2>
+inline void
+PreconditionMGMixedPrecision<dim, VectorType, LevelMatrixType, TransferType>::
+  initialize(const DoFHandler<dim>            &dof_handler,
+             const MGLevelObject<MatrixType2> &level_matrices,
+             const TransferType               &transfer,
+             const AdditionalData             &additional_data)
+{
+  using namespace internal::PreconditionMGMixedPrecisionImplementation;
+
+  clear();
+
+  const unsigned int min_level = level_matrices.min_level();
+  const unsigned int max_level = level_matrices.max_level();
+
+  MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+    min_level, max_level);
+  for (unsigned int level = min_level; level <= max_level; ++level)
+    {
+      const LevelMatrixType &matrix =
+        Utilities::get_underlying_value(level_matrices[level]);
+
+      if constexpr (has_get_matrix_diagonal_inverse<LevelMatrixType>)
+        smoother_data[level].preconditioner =
+          matrix.get_matrix_diagonal_inverse();
+      else
+        {
+          static_assert(
+            has_compute_inverse_diagonal<LevelMatrixType, VectorType>,
+            "The level matrix type must provide either a function "
+            "get_matrix_diagonal_inverse() or a function "
+            "compute_inverse_diagonal(VectorType &).");
+
+          smoother_data[level].preconditioner =
+            std::make_shared<SmootherPreconditionerType>();
+          matrix.compute_inverse_diagonal(
+            smoother_data[level].preconditioner->get_vector());
+        }
+
+      smoother_data[level].eig_cg_n_iterations =
+        additional_data.eig_cg_n_iterations;
+      if (level > min_level)
+        {
+          smoother_data[level].degree = additional_data.smoothing_degree;
+          smoother_data[level].smoothing_range =
+            additional_data.smoothing_range;
+        }
+      else
+        {
+          smoother_data[level].degree = numbers::invalid_unsigned_int;
+          smoother_data[level].smoothing_range =
+            additional_data.coarse_tolerance;
+        }
+    }
+
+  mg_matrix.initialize(level_matrices);
+  mg_smoother.initialize(level_matrices, smoother_data);
+  mg_coarse.initialize(mg_smoother);
+
+  multigrid = std::make_unique<Multigrid<VectorType>>(mg_matrix,
+                                                      mg_coarse,
+                                                      transfer,
+                                                      mg_smoother,
+                                                      mg_smoother,
+                                                      min_level,
+                                                      max_level,
+                                                      additional_data.cycle);
+  preconditioner =
+    std::make_unique<PreconditionMG<dim, VectorType, TransferType>>(
+      dof_handler, *multigrid, transfer);
+}
+
+
+
+template <int dim,
+          typename VectorType,
+          typename LevelMatrixType,
+          typename TransferType>
+inline void
+PreconditionMGMixedPrecision<dim, VectorType, LevelMatrixType, TransferType>::
+  clear()
+{
+  // release the objects in the opposite order of their creation because
+  // they hold pointers to each other
+  preconditioner.reset();
+  multigrid.reset();
+  mg_coarse.clear();
+  mg_smoother.clear();
+  mg_matrix.reset();
+}
+
+
+
+template <int dim,
+          typename VectorType,
+          typename LevelMatrixType,
+          typename TransferType>
+template <typename OtherVectorType>
+inline void
+PreconditionMGMixedPrecision<dim, VectorType, LevelMatrixType, TransferType>::
+  vmult(OtherVectorType &dst, const OtherVectorType &src) const
+{
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+  preconditioner->vmult(dst, src);
+}
+
+
+
+template <int dim,
+          typename VectorType,
+          typename LevelMatrixType,
+          typename TransferType>
+template <typename OtherVectorType>
+inline void
+PreconditionMGMixedPrecision<dim, VectorType, LevelMatrixType, TransferType>::
+  Tvmult(OtherVectorType &dst, const OtherVectorType &src) const
+{
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+  preconditioner->Tvmult(dst, src);
+}
+
+
+
+template <int dim,
+          typename VectorType,
+          typename LevelMatrixType,
+          typename TransferType>
+inline Multigrid<VectorType> &
+PreconditionMGMixedPrecision<dim, VectorType, LevelMatrixType, TransferType>::
+  get_multigrid()
+{
+  Assert(multigrid != nullptr, ExcNotInitialized());
+  return *multigrid;
+}
+
+
+
+template <int dim,
+          typename VectorType,
+          typename LevelMatrixType,
+          typename TransferType>
+inline const typename PreconditionMGMixedPrecision<dim,
+                                                   VectorType,
+                                                   LevelMatrixType,
+                                                   TransferType>::SmootherType &
+PreconditionMGMixedPrecision<dim, VectorType, LevelMatrixType, TransferType>::
+  get_smoother(const unsigned int level) const
+{
+  Assert(multigrid != nullptr, ExcNotInitialized());
+  return mg_smoother.smoothers[level];
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
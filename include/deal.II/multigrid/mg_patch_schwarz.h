@@ -0,0 +1,1278 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_patch_schwarz_h
+#define dealii_mg_patch_schwarz_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/graph_coloring.h>
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/distributed/tria_base.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/linear_operator.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/multigrid/mg_cell_schwarz.h>
+#include <deal.II/multigrid/mg_smoother.h>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * An overlapping additive Schwarz preconditioner for the Laplacian whose
+ * subdomains are the patches of the $2^\text{dim}$ cells around the interior
+ * vertices of the mesh, set up from a MatrixFree object. Compared to the
+ * non-overlapping method of PreconditionCellSchwarz, the local problems on
+ * the vertex patches also couple neighboring cells, which gives a smoother
+ * for geometric multigrid methods whose quality is independent of the
+ * polynomial degree. The class can be used as the inner preconditioner of
+ * PreconditionChebyshev in the same way as PreconditionCellSchwarz, or
+ * through the multigrid smoother MGSmootherSchwarz, which also provides the
+ * multiplicative variant of the method.
+ *
+ * Both continuous elements such as FE_Q and discontinuous elements such as
+ * FE_DGQ are supported:
+ * <ul>
+ * <li> For continuous elements, the unknowns of a patch are the ones in the
+ * interior of the patch, i.e., $(2k-1)^\text{dim}$ unknowns for elements of
+ * degree $k$, and the local problem is the Laplacian on the patch with
+ * homogeneous Dirichlet conditions on its boundary.
+ * <li> For discontinuous elements, the unknowns of a patch are all the
+ * unknowns of its cells, i.e., $(2k+2)^\text{dim}$ unknowns, and the local
+ * problem is the symmetric interior penalty discretization of the Laplacian
+ * on the patch. The faces at the boundary of the patch are treated as in
+ * PreconditionCellSchwarz, see AdditionalData::penalty_factor.
+ * </ul>
+ * The matrices of the local problems are approximated by the Kronecker form
+ * @f[
+ *   A_\text{patch} \approx \sum_{d=1}^{\text{dim}} M_\text{dim} \otimes
+ *   \cdots \otimes K_d \otimes \cdots \otimes M_1,
+ * @f]
+ * where $M_d$ and $K_d$ are the mass and Laplace matrices of the 1d patch of
+ * two intervals in direction $d$. Their lengths are the extents of the
+ * Cartesian surrogates of the cells on either side of the vertex, computed
+ * from the mapping data of the MatrixFree object in the same way as in
+ * PreconditionCellSchwarz. On affine, axis-parallel meshes, this gives the
+ * exact patch matrices. The patch matrices are inverted by the fast
+ * diagonalization method with the class
+ * TensorProductMatrixSymmetricSumCollection.
+ *
+ * The application of the preconditioner is
+ * @f[
+ *   P^{-1} = \sum_{i} R_i^T A_i^{-1} R_i,
+ * @f]
+ * where the restriction $R_i$ picks the unknowns of patch $i$ from the
+ * global vector and the prolongation $R_i^T$ adds the local solution back.
+ * Since the patches overlap, the vector entries of the neighboring MPI
+ * processes are read through ghost values and the contributions to them
+ * are sent back with a compress() operation. The class sets up its own
+ * ghosted vectors for this purpose, so the vectors passed to vmult() only
+ * need to have the layout of MatrixFree::initialize_dof_vector(). Each patch
+ * is handled by the process that owns the cell of the patch with the lowest
+ * subdomain id.
+ *
+ * The patches are colored such that the patches of one color have no
+ * unknowns in common. The vmult() function works on the colors one after
+ * the other, on batches of patches of the same color vectorized over the
+ * lanes of @p VectorizedArrayType, and distributes the batches of a color
+ * among the available threads. The function vmult_color() only applies the
+ * patches of one color, which is the building block of the multiplicative
+ * Schwarz method in MGSmootherSchwarz.
+ *
+ * The following restrictions apply:
+ * <ul>
+ * <li> The element must be a scalar tensor-product element on hypercube
+ * cells.
+ * <li> Only vertices with $2^\text{dim}$ adjacent cells that are arranged
+ * as a tensor product with standard orientation give a patch. The mesh must
+ * be such that all unknowns that are not constrained lie in at least one
+ * patch, otherwise initialize() throws an exception. This excludes the
+ * coarsest level of a multigrid hierarchy with a single cell per coarse cell
+ * and, for continuous elements, boundaries without Dirichlet conditions.
+ * <li> Constrained unknowns, e.g., at Dirichlet boundaries or at refinement
+ * edges, are left out of the restriction and prolongation, but the patch
+ * matrices do not take the constraints into account.
+ * <li> For parallel triangulations, the extents of the ghost cells are
+ * exchanged with GridTools::exchange_cell_data_to_ghosts(), which requires
+ * a single layer of ghost cells.
+ * </ul>
+ *
+ * A typical use as smoother inside a Chebyshev iteration is
+ * @code
+ * using SmootherType =
+ *   PreconditionChebyshev<LevelMatrixType,
+ *                         LinearAlgebra::distributed::Vector<float>,
+ *                         PreconditionVertexPatchSchwarz<dim, float>>;
+ * @endcode
+ * with the same setup as for PreconditionCellSchwarz.
+ */
+template <int dim,
+          typename Number,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class PreconditionVertexPatchSchwarz : public EnableObserverPointer
+{
+public:
+  /**
+   * The type of vectors this preconditioner works on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * The underlying scalar type.
+   */
+  using value_type = Number;
+
+  /**
+   * Parameters of the preconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const double       penalty_factor    = -1.,
+                   const unsigned int dof_index         = 0,
+                   const unsigned int quad_index        = 0,
+                   const bool         compress_matrices = true);
+
+    /**
+     * The factor of the penalty parameter of the interior penalty method
+     * for discontinuous elements, see
+     * PreconditionCellSchwarz::AdditionalData::penalty_factor. On the face
+     * between the two intervals of a 1d patch, the penalty parameter is
+     * this factor divided by the smaller of the two extents. A negative
+     * value selects $k(k+1)$ for elements of degree $k$. The value is
+     * ignored for continuous elements.
+     */
+    double penalty_factor;
+
+    /**
+     * The index of the DoFHandler within the MatrixFree object.
+     */
+    unsigned int dof_index;
+
+    /**
+     * The index of the quadrature formula within the MatrixFree object that
+     * is used for the 1d matrices and for the Cartesian surrogate.
+     */
+    unsigned int quad_index;
+
+    /**
+     * Store the 1d matrices only once if they are the same on several
+     * patches, see the member @p compress_matrices of
+     * TensorProductMatrixSymmetricSumCollection::AdditionalData.
+     */
+    bool compress_matrices;
+  };
+
+  /**
+   * Constructor. The object needs to be set up with initialize() before it
+   * can be used.
+   */
+  PreconditionVertexPatchSchwarz() = default;
+
+  /**
+   * Find the vertex patches of the cells of @p matrix_free, compute the
+   * approximate patch matrices and their inverses, and color the patches.
+   * Previous content of this object is lost. The MatrixFree object is not
+   * needed after this call.
+   */
+  void
+  initialize(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory and return to the state directly after the
+   * constructor was called.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the preconditioner, i.e., the sum of the inverse patch matrices
+   * over all patches. All locally owned entries of @p dst are overwritten.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner. Since the patch matrices are
+   * symmetric, this is the same as vmult().
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the inverse patch matrices of the patches of color @p color only.
+   * All locally owned entries of @p dst are overwritten, and the entries
+   * outside of the patches of this color are set to zero.
+   */
+  void
+  vmult_color(const unsigned int color,
+              VectorType        &dst,
+              const VectorType  &src) const;
+
+  /**
+   * Return the number of colors of the patches, which is the same on all
+   * MPI processes.
+   */
+  unsigned int
+  n_colors() const;
+
+  /**
+   * Return the number of patches handled by the current MPI process.
+   */
+  unsigned int
+  n_patches() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcNotInitialized,
+                   "The preconditioner has not been set up. Call "
+                   "initialize() before using it.");
+
+private:
+  /**
+   * Apply the inverse patch matrices of the colors in the range
+   * [@p first_color, @p end_color) to @p src and write the result into
+   * @p dst.
+   */
+  void
+  apply_patches(const unsigned int first_color,
+                const unsigned int end_color,
+                VectorType        &dst,
+                const VectorType  &src) const;
+
+  /**
+   * The number of unknowns of a patch.
+   */
+  unsigned int n_patch_dofs = 0;
+
+  /**
+   * The number of patches handled by the current MPI process.
+   */
+  unsigned int n_local_patches = 0;
+
+  /**
+   * The indices of the unknowns of the patches within the ghosted vectors
+   * @p src_ghosted and @p dst_ghosted, stored by batch, then by unknown,
+   * and then by lane. Unused lanes and constrained unknowns are marked by
+   * numbers::invalid_unsigned_int.
+   */
+  std::vector<unsigned int> patch_dof_indices;
+
+  /**
+   * The first batch of each color, with one additional entry for the end
+   * of the last color.
+   */
+  std::vector<unsigned int> color_batch_start;
+
+  /**
+   * The fast diagonalization of the approximate patch matrices, indexed by
+   * the batch.
+   */
+  std::unique_ptr<
+    TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>
+    patch_matrices;
+
+  /**
+   * Vector with the ghost entries of all patches of the current MPI
+   * process, to which the input vector is copied.
+   */
+  mutable VectorType src_ghosted;
+
+  /**
+   * Vector with the ghost entries of all patches of the current MPI
+   * process, into which the patch contributions are summed.
+   */
+  mutable VectorType dst_ghosted;
+
+  /**
+   * The minimal number of batches of patches that vmult() assigns to a
+   * thread.
+   */
+  static constexpr unsigned int minimum_parallel_grain_size = 16;
+};
+
+
+
+/**
+ * A multigrid smoother with the overlapping Schwarz method on the vertex
+ * patches of PreconditionVertexPatchSchwarz, in either its additive or its
+ * multiplicative form. One step of the additive method is the damped
+ * Richardson iteration
+ * @f[
+ *   u \leftarrow u + \omega \sum_i R_i^T A_i^{-1} R_i (f - A u),
+ * @f]
+ * whereas the multiplicative method updates the solution after each color
+ * of patches,
+ * @f[
+ *   u \leftarrow u + \omega \sum_{i \in \text{color } c} R_i^T A_i^{-1} R_i
+ *   (f - A u), \quad c = 1, \ldots, n_\text{colors}.
+ * @f]
+ * Since the patches of one color have no unknowns in common, the latter is
+ * a Gauss-Seidel iteration over the colors with block-Jacobi updates inside
+ * each color, at the cost of one matrix-vector product per color. Within a
+ * color, patches on different MPI processes are combined additively. The
+ * transpose of the multiplicative method goes through the colors in reverse
+ * order, so symmetric smoothing (see MGSmoother::set_symmetric()) alternates
+ * between the forward and the backward sweep.
+ *
+ * The smoother is set up from the level matrices, which need to provide a
+ * function <tt>get_matrix_free()</tt> that returns a pointer to the
+ * MatrixFree object of the level, as the classes derived from
+ * MatrixFreeOperators::Base do. The preconditioners are not set up on the
+ * coarsest level, where the Multigrid class calls the coarse-grid solver
+ * instead of the smoother.
+ *
+ * A typical use is
+ * @code
+ * MGSmootherSchwarz<dim, float> mg_smoother(2);
+ * mg_smoother.set_symmetric(true);
+ * mg_smoother.initialize(mg_matrices);
+ * @endcode
+ */
+template <int dim,
+          typename Number,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class MGSmootherSchwarz
+  : public MGSmoother<LinearAlgebra::distributed::Vector<Number>>
+{
+public:
+  /**
+   * The type of vectors this smoother works on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * The type of the preconditioner on each level.
+   */
+  using PreconditionerType =
+    PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>;
+
+  /**
+   * Parameters of the smoother.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(
+      const bool   multiplicative = true,
+      const double relaxation     = -1.,
+      const typename PreconditionerType::AdditionalData &patch_data =
+        typename PreconditionerType::AdditionalData());
+
+    /**
+     * Select the multiplicative method if true and the additive method
+     * otherwise.
+     */
+    bool multiplicative;
+
+    /**
+     * The damping factor $\omega$. A negative value selects one for the
+     * multiplicative method and the inverse of the number of colors for the
+     * additive method, which bounds the largest eigenvalue of the additive
+     * Schwarz operator.
+     */
+    double relaxation;
+
+    /**
+     * The parameters of the preconditioners on the levels.
+     */
+    typename PreconditionerType::AdditionalData patch_data;
+  };
+
+  /**
+   * Constructor. Sets smoothing parameters.
+   */
+  MGSmootherSchwarz(const unsigned int steps     = 1,
+                    const bool         variable  = false,
+                    const bool         symmetric = false,
+                    const bool         transpose = false);
+
+  /**
+   * Store the level matrices and set up the preconditioners on all levels
+   * except the coarsest one.
+   */
+  template <typename MatrixType>
+  void
+  initialize(const MGLevelObject<MatrixType> &matrices,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory.
+   */
+  void
+  clear() override;
+
+  /**
+   * The smoothing method.
+   */
+  virtual void
+  smooth(const unsigned int level,
+         VectorType        &u,
+         const VectorType  &rhs) const override;
+
+  /**
+   * The apply variant of smoothing, setting the vector @p u to zero before
+   * calling the smooth function. The first residual evaluation is skipped.
+   */
+  virtual void
+  apply(const unsigned int level,
+        VectorType        &u,
+        const VectorType  &rhs) const override;
+
+  /**
+   * Memory used by this object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * The preconditioners on the levels.
+   */
+  MGLevelObject<PreconditionerType> smoothers;
+
+private:
+  /**
+   * Run the smoothing steps on @p level. If @p u_is_zero is true, the
+   * residual of the first step is @p rhs.
+   */
+  void
+  smooth_steps(const unsigned int level,
+               VectorType        &u,
+               const VectorType  &rhs,
+               const bool         u_is_zero) const;
+
+  /**
+   * The level matrices.
+   */
+  MGLevelObject<LinearOperator<VectorType>> matrices;
+
+  /**
+   * The damping factor on each level.
+   */
+  MGLevelObject<double> relaxation;
+
+  /**
+   * Whether to use the multiplicative method.
+   */
+  bool multiplicative = true;
+};
+
+/** @} */
+
+/* --------------------------- inline functions --------------------------- */
+
+#ifndef DOXYGEN
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::
+  AdditionalData::AdditionalData(const double       penalty_factor,
+                                 const unsigned int dof_index,
+                                 const unsigned int quad_index,
+                                 const bool         compress_matrices)
+  : penalty_factor(penalty_factor)
+  , dof_index(dof_index)
+  , quad_index(quad_index)
+  , compress_matrices(compress_matrices)
+{}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::initialize(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  const AdditionalData                               &additional_data)
+{
+  clear();
+
+  using CellIterator = typename DoFHandler<dim>::cell_iterator;
+  constexpr unsigned int n_cells = GeometryInfo<dim>::vertices_per_cell;
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  const unsigned int     dof_index   = additional_data.dof_index;
+  const unsigned int     mg_level    = matrix_free.get_mg_level();
+  const DoFHandler<dim> &dof_handler = matrix_free.get_dof_handler(dof_index);
+  const Triangulation<dim> &tria     = dof_handler.get_triangulation();
+  const FiniteElement<dim> &fe       = dof_handler.get_fe();
+  const auto &shape_info =
+    matrix_free.get_shape_info(dof_index, additional_data.quad_index);
+  const auto        &shape_data = shape_info.data[0];
+  const unsigned int degree     = shape_data.fe_degree;
+  const unsigned int n          = degree + 1;
+  const bool         is_dg      = fe.n_dofs_per_vertex() == 0;
+  AssertThrow(fe.n_components() == 1 && fe.reference_cell().is_hyper_cube() &&
+                fe.n_dofs_per_cell() == Utilities::pow(n, dim) &&
+                fe.n_dofs_per_vertex() == (is_dg ? 0 : 1),
+              ExcMessage("PreconditionVertexPatchSchwarz only works for "
+                         "scalar tensor-product elements."));
+
+  // the 1d patch consists of two intervals; for continuous elements, the
+  // unknowns at its ends and thus the node shared by the two intervals
+  // are counted once and the ones at the ends are left out
+  const unsigned int n_1d = is_dg ? 2 * n : 2 * degree - 1;
+  n_patch_dofs            = Utilities::pow(n_1d, dim);
+
+  Table<2, double> mass_unit, laplace_unit;
+  internal::MGCellSchwarz::compute_unit_matrices(shape_data,
+                                                 mass_unit,
+                                                 laplace_unit);
+  const double penalty_factor =
+    additional_data.penalty_factor < 0. ?
+      static_cast<double>(degree * (degree + 1)) :
+      additional_data.penalty_factor;
+  const auto &values_0 = shape_data.shape_data_on_face[0];
+  const auto &values_1 = shape_data.shape_data_on_face[1];
+
+  // compute the extents of the Cartesian surrogates of the cells of the
+  // MatrixFree object and send them to the ghost cells
+  std::map<std::pair<int, int>, std::array<double, dim>> cell_extents;
+  {
+    FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(
+      matrix_free, dof_index, additional_data.quad_index);
+    for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+      {
+        phi.reinit(cell);
+        const std::array<VectorizedArrayType, dim> extent =
+          internal::MGCellSchwarz::compute_cartesian_extent(phi);
+        for (unsigned int v = 0;
+             v < matrix_free.n_active_entries_per_cell_batch(cell);
+             ++v)
+          {
+            const CellIterator cell_it =
+              matrix_free.get_cell_iterator(cell, v, dof_index);
+            std::array<double, dim> &cell_extent =
+              cell_extents[std::make_pair(cell_it->level(), cell_it->index())];
+            for (unsigned int d = 0; d < dim; ++d)
+              cell_extent[d] = extent[d][v];
+          }
+      }
+  }
+
+  if (dynamic_cast<const parallel::TriangulationBase<dim> *>(&tria) !=
+      nullptr)
+    {
+      const auto pack = [&](const auto &cell) {
+        const auto entry =
+          cell_extents.find(std::make_pair(cell->level(), cell->index()));
+        return entry != cell_extents.end() ?
+                 std::optional<std::array<double, dim>>(entry->second) :
+                 std::optional<std::array<double, dim>>();
+      };
+      const auto unpack = [&](const auto                    &cell,
+                              const std::array<double, dim> &extent) {
+        cell_extents[std::make_pair(cell->level(), cell->index())] = extent;
+      };
+
+      if (mg_level == numbers::invalid_unsigned_int)
+        GridTools::exchange_cell_data_to_ghosts<std::array<double, dim>,
+                                                DoFHandler<dim>>(dof_handler,
+                                                                 pack,
+                                                                 unpack);
+      else
+        GridTools::exchange_cell_data_to_level_ghosts<std::array<double, dim>,
+                                                      DoFHandler<dim>>(
+          dof_handler,
+          pack,
+          unpack,
+          [&](const typename DoFHandler<dim>::level_cell_iterator &cell) {
+            return cell->level() == static_cast<int>(mg_level);
+          });
+    }
+
+  // collect the cells around each vertex, sorted by their position in the
+  // patch: the cell at position p contains the vertex with the local index
+  // whose bits are the complement of the bits of p
+  std::vector<std::array<CellIterator, n_cells>> cells_at_vertex(
+    tria.n_vertices());
+  std::vector<unsigned int> filled_positions(tria.n_vertices(), 0U);
+  std::vector<bool>         is_irregular(tria.n_vertices(), false);
+  const auto                add_cell = [&](const CellIterator &cell) {
+    for (const unsigned int v : cell->vertex_indices())
+      {
+        const unsigned int vertex   = cell->vertex_index(v);
+        const unsigned int position = (n_cells - 1) ^ v;
+        if (filled_positions[vertex] & (1U << position))
+          is_irregular[vertex] = true;
+        filled_positions[vertex] |= 1U << position;
+        cells_at_vertex[vertex][position] = cell;
+      }
+  };
+  if (mg_level == numbers::invalid_unsigned_int)
+    {
+      for (const auto &cell : dof_handler.active_cell_iterators())
+        if (!cell->is_artificial())
+          add_cell(cell);
+    }
+  else
+    {
+      for (const auto &cell : dof_handler.cell_iterators_on_level(mg_level))
+        if (!cell->is_artificial_on_level())
+          add_cell(cell);
+    }
+
+  // set up the patches of the vertices surrounded by 2^dim cells in a
+  // tensor-product arrangement, where the current process owns the cell
+  // with the lowest subdomain id
+  const types::subdomain_id my_subdomain = tria.locally_owned_subdomain();
+  std::vector<std::vector<types::global_dof_index>> patch_indices;
+  std::vector<std::array<std::array<double, 2>, dim>> patch_extents;
+  std::vector<types::global_dof_index> cell_dof_indices(fe.n_dofs_per_cell());
+  for (unsigned int vertex = 0; vertex < tria.n_vertices(); ++vertex)
+    {
+      if (filled_positions[vertex] != (1U << n_cells) - 1 ||
+          is_irregular[vertex])
+        continue;
+
+      const std::array<CellIterator, n_cells> &cells = cells_at_vertex[vertex];
+
+      bool                is_tensor_product = true;
+      types::subdomain_id owner = numbers::invalid_subdomain_id;
+      for (unsigned int p = 0; p < n_cells; ++p)
+        {
+          for (unsigned int d = 0; d < dim; ++d)
+            if ((p & (1U << d)) == 0)
+              {
+                const CellIterator &other = cells[p | (1U << d)];
+                if (cells[p]->neighbor_level(2 * d + 1) != other->level() ||
+                    cells[p]->neighbor_index(2 * d + 1) != other->index())
+                  is_tensor_product = false;
+              }
+          owner = std::min(owner,
+                           mg_level == numbers::invalid_unsigned_int ?
+                             cells[p]->subdomain_id() :
+                             cells[p]->level_subdomain_id());
+        }
+      if (!is_tensor_product ||
+          (my_subdomain != numbers::invalid_subdomain_id &&
+           owner != my_subdomain))
+        continue;
+
+      std::vector<types::global_dof_index> indices(
+        n_patch_dofs, numbers::invalid_dof_index);
+      std::array<std::array<double, 2>, dim> extents = {};
+      for (unsigned int p = 0; p < n_cells; ++p)
+        {
+          if (mg_level == numbers::invalid_unsigned_int)
+            cells[p]->get_dof_indices(cell_dof_indices);
+          else
+            cells[p]->get_mg_dof_indices(cell_dof_indices);
+
+          for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+            {
+              unsigned int patch_index = 0;
+              bool         is_inside   = true;
+              for (unsigned int d = 0, stride = 1; d < dim;
+                   ++d, stride *= n_1d)
+                {
+                  const unsigned int index_1d =
+                    (i / Utilities::pow(n, d)) % n;
+                  const unsigned int position_1d = (p >> d) & 1U;
+                  if (is_dg)
+                    patch_index += (position_1d * n + index_1d) * stride;
+                  else
+                    {
+                      const unsigned int node = position_1d * degree + index_1d;
+                      if (node == 0 || node == 2 * degree)
+                        is_inside = false;
+                      else
+                        patch_index += (node - 1) * stride;
+                    }
+                }
+              if (!is_inside)
+                continue;
+
+              const types::global_dof_index dof_index_global =
+                cell_dof_indices[shape_info.lexicographic_numbering[i]];
+              if (indices[patch_index] != numbers::invalid_dof_index &&
+                  indices[patch_index] != dof_index_global)
+                is_tensor_product = false;
+              indices[patch_index] = dof_index_global;
+            }
+
+          const auto entry = cell_extents.find(
+            std::make_pair(cells[p]->level(), cells[p]->index()));
+          Assert(entry != cell_extents.end(), ExcInternalError());
+          for (unsigned int d = 0; d < dim; ++d)
+            extents[d][(p >> d) & 1U] += entry->second[d] / (n_cells / 2);
+        }
+
+      // the unknowns of the cells of continuous elements do not match if
+      // the cells are not in standard orientation
+      if (!is_tensor_product)
+        continue;
+
+      patch_indices.push_back(std::move(indices));
+      patch_extents.push_back(extents);
+    }
+  n_local_patches = patch_indices.size();
+
+  // color the patches such that the patches of one color do not share
+  // unknowns
+  std::vector<std::vector<std::vector<unsigned int>::const_iterator>> colors;
+  std::vector<unsigned int> patch_numbers(n_local_patches);
+  for (unsigned int i = 0; i < n_local_patches; ++i)
+    patch_numbers[i] = i;
+  if (n_local_patches > 0)
+    colors = GraphColoring::make_graph_coloring(
+      patch_numbers.cbegin(),
+      patch_numbers.cend(),
+      std::function<std::vector<types::global_dof_index>(
+        const std::vector<unsigned int>::const_iterator &)>(
+        [&](const std::vector<unsigned int>::const_iterator &patch) {
+          std::vector<types::global_dof_index> indices = patch_indices[*patch];
+          std::sort(indices.begin(), indices.end());
+          return indices;
+        }));
+
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &vector_partitioner =
+    matrix_free.get_vector_partitioner(dof_index);
+  const MPI_Comm     communicator = vector_partitioner->get_mpi_communicator();
+  const unsigned int n_global_colors =
+    Utilities::MPI::max(static_cast<unsigned int>(colors.size()),
+                        communicator);
+
+  // set up vectors that contain the unknowns of all patches as ghosts, and
+  // mark the constrained unknowns
+  {
+    IndexSet ghost_indices(vector_partitioner->size());
+    for (const std::vector<types::global_dof_index> &indices : patch_indices)
+      {
+        std::vector<types::global_dof_index> sorted_indices = indices;
+        std::sort(sorted_indices.begin(), sorted_indices.end());
+        ghost_indices.add_indices(sorted_indices.begin(), sorted_indices.end());
+      }
+    ghost_indices.subtract_set(vector_partitioner->locally_owned_range());
+    const auto partitioner = std::make_shared<Utilities::MPI::Partitioner>(
+      vector_partitioner->locally_owned_range(), ghost_indices, communicator);
+    src_ghosted.reinit(partitioner);
+    dst_ghosted.reinit(partitioner);
+  }
+  for (const unsigned int i : matrix_free.get_constrained_dofs(dof_index))
+    if (i < src_ghosted.locally_owned_size())
+      src_ghosted.local_element(i) = 1.;
+  src_ghosted.update_ghost_values();
+
+  // go through the colors and assemble the patches into batches
+  color_batch_start.resize(n_global_colors + 1);
+  color_batch_start[0] = 0;
+  for (unsigned int color = 0; color < n_global_colors; ++color)
+    color_batch_start[color + 1] =
+      color_batch_start[color] +
+      (color < colors.size() ? (colors[color].size() + n_lanes - 1) / n_lanes :
+                               0);
+  const unsigned int n_batches = color_batch_start.back();
+
+  patch_dof_indices.resize(n_batches * n_patch_dofs * n_lanes,
+                           numbers::invalid_unsigned_int);
+  patch_matrices = std::make_unique<
+    TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>(
+    typename TensorProductMatrixSymmetricSumCollection<dim,
+                                                       VectorizedArrayType>::
+      AdditionalData(additional_data.compress_matrices));
+  patch_matrices->reserve(n_batches);
+
+  std::array<Table<2, VectorizedArrayType>, dim> mass_matrices;
+  std::array<Table<2, VectorizedArrayType>, dim> laplace_matrices;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      mass_matrices[d].reinit(n_1d, n_1d);
+      laplace_matrices[d].reinit(n_1d, n_1d);
+    }
+  Table<2, double> mass_1d(n_1d, n_1d), laplace_1d(n_1d, n_1d);
+
+  for (unsigned int color = 0; color < colors.size(); ++color)
+    for (unsigned int batch = color_batch_start[color];
+         batch < color_batch_start[color + 1];
+         ++batch)
+      {
+        const unsigned int first = (batch - color_batch_start[color]) * n_lanes;
+        for (unsigned int v = 0; v < n_lanes; ++v)
+          {
+            // fill unused lanes of the last batch by the first patch to keep
+            // the matrices invertible, but do not read or write vector
+            // entries for them
+            const bool         is_filled = first + v < colors[color].size();
+            const unsigned int patch =
+              *colors[color][is_filled ? first + v : first];
+
+            if (is_filled)
+              for (unsigned int i = 0; i < n_patch_dofs; ++i)
+                {
+                  const unsigned int local_index =
+                    src_ghosted.get_partitioner()->global_to_local(
+                      patch_indices[patch][i]);
+                  if (src_ghosted.local_element(local_index) == Number())
+                    patch_dof_indices[(batch * n_patch_dofs + i) * n_lanes +
+                                      v] = local_index;
+                }
+
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                const double h_left  = patch_extents[patch][d][0];
+                const double h_right = patch_extents[patch][d][1];
+                mass_1d.reset_values();
+                laplace_1d.reset_values();
+                if (is_dg)
+                  {
+                    // the interior penalty terms of the face between the two
+                    // intervals, where the normal points from the left to
+                    // the right interval; the faces at the ends of the patch
+                    // are treated as in PreconditionCellSchwarz
+                    const double sigma =
+                      penalty_factor / std::min(h_left, h_right);
+                    for (unsigned int i = 0; i < n; ++i)
+                      for (unsigned int j = 0; j < n; ++j)
+                        {
+                          mass_1d(i, j)         = h_left * mass_unit(i, j);
+                          mass_1d(n + i, n + j) = h_right * mass_unit(i, j);
+
+                          laplace_1d(i, j) =
+                            (laplace_unit(i, j) +
+                             penalty_factor * values_0[i] * values_0[j] +
+                             0.5 * values_0[n + i] * values_0[j] +
+                             0.5 * values_0[n + j] * values_0[i]) /
+                              h_left +
+                            sigma * values_1[i] * values_1[j] -
+                            0.5 / h_left *
+                              (values_1[n + i] * values_1[j] +
+                               values_1[n + j] * values_1[i]);
+                          laplace_1d(n + i, n + j) =
+                            (laplace_unit(i, j) +
+                             penalty_factor * values_1[i] * values_1[j] -
+                             0.5 * values_1[n + i] * values_1[j] -
+                             0.5 * values_1[n + j] * values_1[i]) /
+                              h_right +
+                            sigma * values_0[i] * values_0[j] +
+                            0.5 / h_right *
+                              (values_0[n + i] * values_0[j] +
+                               values_0[n + j] * values_0[i]);
+                          laplace_1d(i, n + j) =
+                            -sigma * values_1[i] * values_0[j] -
+                            0.5 / h_right * values_0[n + j] * values_1[i] +
+                            0.5 / h_left * values_1[n + i] * values_0[j];
+                          laplace_1d(n + j, i) = laplace_1d(i, n + j);
+                        }
+                  }
+                else
+                  {
+                    // assemble the matrices of the two intervals and leave
+                    // out the nodes at the ends of the patch
+                    for (unsigned int i = 0; i < n; ++i)
+                      for (unsigned int j = 0; j < n; ++j)
+                        {
+                          if (i > 0 && j > 0)
+                            {
+                              mass_1d(i - 1, j - 1) += h_left * mass_unit(i, j);
+                              laplace_1d(i - 1, j - 1) +=
+                                laplace_unit(i, j) / h_left;
+                            }
+                          if (i < degree && j < degree)
+                            {
+                              mass_1d(degree + i - 1, degree + j - 1) +=
+                                h_right * mass_unit(i, j);
+                              laplace_1d(degree + i - 1, degree + j - 1) +=
+                                laplace_unit(i, j) / h_right;
+                            }
+                        }
+                  }
+
+                for (unsigned int i = 0; i < n_1d; ++i)
+                  for (unsigned int j = 0; j < n_1d; ++j)
+                    {
+                      mass_matrices[d](i, j)[v]    = mass_1d(i, j);
+                      laplace_matrices[d](i, j)[v] = laplace_1d(i, j);
+                    }
+              }
+          }
+
+        patch_matrices->insert(batch, mass_matrices, laplace_matrices);
+      }
+
+  patch_matrices->finalize();
+
+  // check that all unknowns that are not constrained are in some patch
+  dst_ghosted = 0.;
+  for (const unsigned int index : patch_dof_indices)
+    if (index != numbers::invalid_unsigned_int)
+      dst_ghosted.local_element(index) = 1.;
+  dst_ghosted.compress(VectorOperation::add);
+  unsigned int n_uncovered_dofs = 0;
+  for (unsigned int i = 0; i < dst_ghosted.locally_owned_size(); ++i)
+    if (dst_ghosted.local_element(i) == Number() &&
+        src_ghosted.local_element(i) == Number())
+      ++n_uncovered_dofs;
+  n_uncovered_dofs = Utilities::MPI::sum(n_uncovered_dofs, communicator);
+  AssertThrow(n_uncovered_dofs == 0,
+              ExcMessage(
+                "There are " + std::to_string(n_uncovered_dofs) +
+                " unknowns that are neither constrained nor inside one of "
+                "the vertex patches of PreconditionVertexPatchSchwarz. "
+                "Vertex patches need 2^dim cells around interior vertices "
+                "of the mesh in a tensor-product arrangement."));
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::clear()
+{
+  patch_matrices.reset();
+  patch_dof_indices.clear();
+  color_batch_start.clear();
+  n_patch_dofs    = 0;
+  n_local_patches = 0;
+  src_ghosted.reinit(0);
+  dst_ghosted.reinit(0);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::vmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  Assert(patch_matrices != nullptr, ExcNotInitialized());
+  apply_patches(0, n_colors(), dst, src);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::Tvmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::vmult_color(
+  const unsigned int color,
+  VectorType        &dst,
+  const VectorType  &src) const
+{
+  Assert(patch_matrices != nullptr, ExcNotInitialized());
+  AssertIndexRange(color, n_colors());
+  apply_patches(color, color + 1, dst, src);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline unsigned int
+PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::n_colors()
+  const
+{
+  return color_batch_start.empty() ? 0 : color_batch_start.size() - 1;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline unsigned int
+PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::n_patches()
+  const
+{
+  return n_local_patches;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::
+  apply_patches(const unsigned int first_color,
+                const unsigned int end_color,
+                VectorType        &dst,
+                const VectorType  &src) const
+{
+  AssertDimension(src.locally_owned_size(), src_ghosted.locally_owned_size());
+  AssertDimension(dst.locally_owned_size(), dst_ghosted.locally_owned_size());
+
+  src_ghosted.copy_locally_owned_data_from(src);
+  src_ghosted.update_ghost_values();
+  dst_ghosted = 0.;
+
+  // the patches of one color do not share unknowns, so the batches of a
+  // color can be distributed among threads
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+  for (unsigned int color = first_color; color < end_color; ++color)
+    parallel::apply_to_subranges(
+      color_batch_start[color],
+      color_batch_start[color + 1],
+      [&](const unsigned int begin, const unsigned int end) {
+        AlignedVector<VectorizedArrayType> values(n_patch_dofs);
+        for (unsigned int batch = begin; batch < end; ++batch)
+          {
+            const unsigned int *indices =
+              patch_dof_indices.data() + batch * n_patch_dofs * n_lanes;
+            for (unsigned int i = 0; i < n_patch_dofs; ++i)
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                values[i][v] =
+                  indices[i * n_lanes + v] == numbers::invalid_unsigned_int ?
+                    Number() :
+                    src_ghosted.local_element(indices[i * n_lanes + v]);
+
+            patch_matrices->apply_inverse(
+              batch,
+              ArrayView<VectorizedArrayType>(values.data(), n_patch_dofs),
+              ArrayView<const VectorizedArrayType>(values.data(),
+                                                   n_patch_dofs));
+
+            for (unsigned int i = 0; i < n_patch_dofs; ++i)
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                if (indices[i * n_lanes + v] != numbers::invalid_unsigned_int)
+                  dst_ghosted.local_element(indices[i * n_lanes + v]) +=
+                    values[i][v];
+          }
+      },
+      minimum_parallel_grain_size);
+
+  src_ghosted.zero_out_ghost_values();
+  dst_ghosted.compress(VectorOperation::add);
+  dst.copy_locally_owned_data_from(dst_ghosted);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline std::size_t
+PreconditionVertexPatchSchwarz<dim, Number, VectorizedArrayType>::
+  memory_consumption() const
+{
+  return sizeof(*this) +
+         MemoryConsumption::memory_consumption(patch_dof_indices) +
+         MemoryConsumption::memory_consumption(color_batch_start) +
+         src_ghosted.memory_consumption() + dst_ghosted.memory_consumption() +
+         (patch_matrices != nullptr ? patch_matrices->memory_consumption() : 0);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline MGSmootherSchwarz<dim, Number, VectorizedArrayType>::AdditionalData::
+  AdditionalData(
+    const bool                                         multiplicative,
+    const double                                       relaxation,
+    const typename PreconditionerType::AdditionalData &patch_data)
+  : multiplicative(multiplicative)
+  , relaxation(relaxation)
+  , patch_data(patch_data)
+{}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline MGSmootherSchwarz<dim, Number, VectorizedArrayType>::MGSmootherSchwarz(
+  const unsigned int steps,
+  const bool         variable,
+  const bool         symmetric,
+  const bool         transpose)
+  : MGSmoother<VectorType>(steps, variable, symmetric, transpose)
+{}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename MatrixType>
+inline void
+MGSmootherSchwarz<dim, Number, VectorizedArrayType>::initialize(
+  const MGLevelObject<MatrixType> &m,
+  const AdditionalData            &additional_data)
+{
+  const unsigned int min = m.min_level();
+  const unsigned int max = m.max_level();
+
+  matrices.resize(min, max);
+  smoothers.resize(min, max);
+  relaxation.resize(min, max);
+  multiplicative = additional_data.multiplicative;
+
+  for (unsigned int level = min; level <= max; ++level)
+    {
+      matrices[level] =
+        linear_operator<VectorType>(LinearOperator<VectorType>(),
+                                    Utilities::get_underlying_value(m[level]));
+      if (level == min)
+        continue;
+
+      smoothers[level].initialize(
+        *Utilities::get_underlying_value(m[level]).get_matrix_free(),
+        additional_data.patch_data);
+      relaxation[level] =
+        additional_data.relaxation >= 0. ? additional_data.relaxation :
+        multiplicative                   ? 1. :
+                                           1. / smoothers[level].n_colors();
+    }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+MGSmootherSchwarz<dim, Number, VectorizedArrayType>::clear()
+{
+  smoothers.clear_elements();
+
+  for (unsigned int level = matrices.min_level(); level <= matrices.max_level();
+       ++level)
+    matrices[level] = LinearOperator<VectorType>();
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+MGSmootherSchwarz<dim, Number, VectorizedArrayType>::smooth(
+  const unsigned int level,
+  VectorType        &u,
+  const VectorType  &rhs) const
+{
+  smooth_steps(level, u, rhs, false);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+MGSmootherSchwarz<dim, Number, VectorizedArrayType>::apply(
+  const unsigned int level,
+  VectorType        &u,
+  const VectorType  &rhs) const
+{
+  u = Number();
+  smooth_steps(level, u, rhs, true);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+MGSmootherSchwarz<dim, Number, VectorizedArrayType>::smooth_steps(
+  const unsigned int level,
+  VectorType        &u,
+  const VectorType  &rhs,
+  const bool         u_is_zero) const
+{
+  unsigned int steps2 = this->steps;
+  if (this->variable)
+    steps2 *= (1 << (matrices.max_level() - level));
+
+  typename VectorMemory<VectorType>::Pointer r(this->vector_memory);
+  typename VectorMemory<VectorType>::Pointer d(this->vector_memory);
+  r->reinit(u, true);
+  d->reinit(u, true);
+
+  bool T = this->transpose;
+  if (this->symmetric && (steps2 % 2 == 0))
+    T = false;
+
+  bool               residual_is_rhs = u_is_zero;
+  const unsigned int n_colors        = smoothers[level].n_colors();
+  for (unsigned int step = 0; step < steps2; ++step)
+    {
+      // the additive method applies all colors at once, the multiplicative
+      // method updates the residual after each color, going through the
+      // colors in reverse order for the transpose
+      const unsigned int n_sweeps = multiplicative ? n_colors : 1;
+      for (unsigned int sweep = 0; sweep < n_sweeps; ++sweep)
+        {
+          const VectorType *residual = &rhs;
+          if (!residual_is_rhs)
+            {
+              matrices[level].vmult(*r, u);
+              r->sadd(-1., rhs);
+              residual = r.get();
+            }
+
+          if (multiplicative)
+            smoothers[level].vmult_color(T ? n_colors - 1 - sweep : sweep,
+                                         *d,
+                                         *residual);
+          else
+            smoothers[level].vmult(*d, *residual);
+          u.add(relaxation[level], *d);
+          residual_is_rhs = false;
+        }
+
+      if (this->symmetric)
+        T = !T;
+    }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline std::size_t
+MGSmootherSchwarz<dim, Number, VectorizedArrayType>::memory_consumption() const
+{
+  return sizeof(*this) + smoothers.memory_consumption() +
+         this->vector_memory.memory_consumption();
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
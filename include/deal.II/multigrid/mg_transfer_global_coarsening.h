@@ -212,6 +212,42 @@ namespace MGTransferGlobalCoarseningTools
     const RepartitioningPolicyTools::Base<dim, spacedim> &policy,
     const bool repartition_fine_triangulation = false);
 
+  /**
+   * Create a copy of the fully distributed triangulation @p tria that only
+   * lives on the subcommunicator of those processes that own cells of
+   * @p tria, with the same cells owned by each of these processes and the
+   * same order of processes. This function is useful on the coarsest levels
+   * of global-coarsening multigrid: A repartitioning policy like
+   * RepartitioningPolicyTools::MinimalGranularityPolicy given to
+   * create_geometric_coarsening_sequence() agglomerates the coarse cells on
+   * a few processes, but the remaining processes are still part of the
+   * communicator of the coarse triangulation and therefore participate in
+   * all collective operations of the coarse-grid solver. Setting up the
+   * coarse-grid solver on the triangulation returned by this function
+   * instead confines the communication to the processes that actually own
+   * unknowns, see also MGCoarseGridAgglomeration.
+   *
+   * A DoFHandler with the same finite element enumerates the unknowns on the
+   * returned triangulation in the same way as on @p tria, so vectors on both
+   * triangulations share the locally owned index ranges.
+   *
+   * The function needs to be called on all processes of the communicator of
+   * @p tria. On processes that do not own cells, a null pointer is returned.
+   * The subcommunicator is owned by the returned object and freed together
+   * with it. Manifolds attached to @p tria are copied.
+   *
+   * @note The argument @p tria must be of type
+   *   parallel::fullydistributed::Triangulation, which is the type of the
+   *   coarse levels created by create_geometric_coarsening_sequence() with a
+   *   repartitioning policy. Other parallel triangulations may order their
+   *   cells differently, so that the unknowns would not be enumerated in the
+   *   same way. The returned triangulation is of the same type and does not
+   *   contain a multigrid hierarchy.
+   */
+  template <int dim, int spacedim>
+  std::shared_ptr<const Triangulation<dim, spacedim>>
+  create_agglomerated_triangulation(const Triangulation<dim, spacedim> &tria);
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
@@ -290,6 +326,23 @@ public:
   memory_consumption() const = 0;
 
 protected:
+  /**
+   * The subsets of cells the work in prolongate_and_add_internal() and
+   * restrict_and_add_internal() is split into, in order to overlap the
+   * communication of the vectors with computations. The cells of the subsets
+   * @p inner_first and @p inner_second only access locally owned degrees of
+   * freedom on both the coarse and the fine side, so they can be processed
+   * while the ghost values of the source vector are imported or while the
+   * ghost contributions of the destination vector are sent to their owners,
+   * respectively. The remaining cells form the subset @p boundary.
+   */
+  enum class CellSubset
+  {
+    inner_first,
+    boundary,
+    inner_second
+  };
+
   /**
    * Perform prolongation on vectors with correct ghosting.
    */
@@ -302,6 +355,34 @@ protected:
   virtual void
   restrict_and_add_internal(VectorType &dst, const VectorType &src) const = 0;
 
+  /**
+   * Perform prolongation on vectors with correct ghosting for the cells of
+   * the given subset. The ghost values of @p src are only guaranteed to be
+   * available for the subset CellSubset::boundary.
+   *
+   * The default implementation calls the two-argument version of this
+   * function for CellSubset::boundary and does nothing for the other
+   * subsets, i.e., derived classes that do not override this function do all
+   * work once the ghost values are available and do not overlap the
+   * communication with computations.
+   */
+  virtual void
+  prolongate_and_add_internal(VectorType       &dst,
+                              const VectorType &src,
+                              const CellSubset  cells) const;
+
+  /**
+   * Perform restriction on vectors with correct ghosting for the cells of the
+   * given subset. The ghost values of @p src are only guaranteed to be
+   * available for the subset CellSubset::boundary. The default
+   * implementation calls the two-argument version of this function for
+   * CellSubset::boundary, see prolongate_and_add_internal().
+   */
+  virtual void
+  restrict_and_add_internal(VectorType       &dst,
+                            const VectorType &src,
+                            const CellSubset  cells) const;
+
   /**
    * A wrapper around update_ghost_values() optimized in case the
    * present vector has the same parallel layout of one of the external
@@ -310,6 +391,20 @@ protected:
   void
   update_ghost_values(const VectorType &vec) const;
 
+  /**
+   * Start the import of ghost values in a split-phase version of
+   * update_ghost_values().
+   */
+  void
+  update_ghost_values_start(const VectorType &vec) const;
+
+  /**
+   * Finish the import of ghost values in a split-phase version of
+   * update_ghost_values().
+   */
+  void
+  update_ghost_values_finish(const VectorType &vec) const;
+
   /**
    * A wrapper around compress() optimized in case the
    * present vector has the same parallel layout of one of the external
@@ -318,6 +413,20 @@ protected:
   void
   compress(VectorType &vec, const VectorOperation::values op) const;
 
+  /**
+   * Start sending the ghost contributions in a split-phase version of
+   * compress().
+   */
+  void
+  compress_start(VectorType &vec, const VectorOperation::values op) const;
+
+  /**
+   * Finish sending the ghost contributions in a split-phase version of
+   * compress().
+   */
+  void
+  compress_finish(VectorType &vec, const VectorOperation::values op) const;
+
   /**
    * A wrapper around zero_out_ghost_values() optimized in case the
    * present vector has the same parallel layout of one of the external
@@ -404,6 +513,18 @@ protected:
    * are a subset of an external Partitioner object.
    */
   mutable AlignedVector<Number> buffer_fine_embedded;
+
+  /**
+   * MPI requests of the split-phase communication with
+   * partitioner_coarse_embedded.
+   */
+  mutable std::vector<MPI_Request> requests_coarse_embedded;
+
+  /**
+   * MPI requests of the split-phase communication with
+   * partitioner_fine_embedded.
+   */
+  mutable std::vector<MPI_Request> requests_fine_embedded;
 };
 
 
@@ -578,6 +699,20 @@ protected:
   restrict_and_add_internal(VectorType       &dst,
                             const VectorType &src) const override;
 
+  void
+  prolongate_and_add_internal(
+    VectorType       &dst,
+    const VectorType &src,
+    const typename MGTwoLevelTransferBase<VectorType>::CellSubset cells)
+    const override;
+
+  void
+  restrict_and_add_internal(
+    VectorType       &dst,
+    const VectorType &src,
+    const typename MGTwoLevelTransferBase<VectorType>::CellSubset cells)
+    const override;
+
 private:
   /**
    * A multigrid transfer scheme. A multrigrid transfer class can have different
@@ -717,6 +852,14 @@ private:
    */
   std::vector<unsigned char> weights_are_compressed;
 
+  /**
+   * The subset each cell batch belongs to, in the ordering of the
+   * weights_start array. If empty, all cells are treated as boundary cells,
+   * i.e., no communication is overlapped with computations.
+   */
+  std::vector<typename MGTwoLevelTransferBase<VectorType>::CellSubset>
+    cell_subsets;
+
   /**
    * Number of components.
    */
@@ -892,6 +1035,12 @@ protected:
   restrict_and_add_internal(VectorType       &dst,
                             const VectorType &src) const override;
 
+  // The communication pattern of the non-nested transfer does not allow to
+  // identify cells without access to ghost values, so all work is done in
+  // the two-argument versions above.
+  using MGTwoLevelTransferBase<VectorType>::prolongate_and_add_internal;
+  using MGTwoLevelTransferBase<VectorType>::restrict_and_add_internal;
+
 private:
   /**
    * Perform prolongation for correct number of components.
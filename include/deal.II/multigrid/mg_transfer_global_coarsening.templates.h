@@ -1571,6 +1571,89 @@ namespace internal
 
 
 
+    /**
+     * Sort the cell batches into the subsets used for overlapping
+     * communication and computation: batches whose cells only access locally
+     * owned entries on both the coarse and the fine side are split evenly
+     * between the subsets processed before and after the boundary batches.
+     */
+    template <int dim, typename Number, typename MemorySpace>
+    static void
+    setup_cell_subsets(
+      MGTwoLevelTransfer<
+        dim,
+        LinearAlgebra::distributed::Vector<Number, MemorySpace>> &transfer)
+    {
+      using CellSubset = typename MGTwoLevelTransferBase<
+        LinearAlgebra::distributed::Vector<Number, MemorySpace>>::CellSubset;
+
+      const auto indices_are_owned =
+        [](const auto        &constraint_info,
+           const unsigned int locally_owned_size,
+           const unsigned int cell) {
+          for (unsigned int i = constraint_info.row_starts[cell].first;
+               i < constraint_info.row_starts[cell + 1].first;
+               ++i)
+            if (constraint_info.dof_indices[i] >= locally_owned_size)
+              return false;
+
+          if (constraint_info.row_starts_plain_indices.empty() == false)
+            for (unsigned int i =
+                   constraint_info.row_starts_plain_indices[cell];
+                 i < constraint_info.row_starts_plain_indices[cell + 1];
+                 ++i)
+              if (constraint_info.plain_dof_indices[i] >= locally_owned_size)
+                return false;
+
+          return true;
+        };
+
+      const unsigned int n_lanes = VectorizedArray<Number>::size();
+      const unsigned int n_owned_coarse =
+        transfer.partitioner_coarse->locally_owned_size();
+      const unsigned int n_owned_fine =
+        transfer.partitioner_fine->locally_owned_size();
+
+      transfer.cell_subsets.clear();
+
+      unsigned int cell_counter    = 0;
+      unsigned int n_inner_batches = 0;
+      for (const auto &scheme : transfer.schemes)
+        for (unsigned int cell = 0; cell < scheme.n_coarse_cells;
+             cell += n_lanes)
+          {
+            const unsigned int n_lanes_filled =
+              (cell + n_lanes > scheme.n_coarse_cells) ?
+                (scheme.n_coarse_cells - cell) :
+                n_lanes;
+
+            bool is_inner = true;
+            for (unsigned int v = 0; v < n_lanes_filled && is_inner; ++v)
+              is_inner = indices_are_owned(transfer.constraint_info_coarse,
+                                           n_owned_coarse,
+                                           cell_counter + v) &&
+                         indices_are_owned(transfer.constraint_info_fine,
+                                           n_owned_fine,
+                                           cell_counter + v);
+
+            transfer.cell_subsets.push_back(is_inner ?
+                                              CellSubset::inner_first :
+                                              CellSubset::boundary);
+            n_inner_batches += is_inner;
+            cell_counter += n_lanes_filled;
+          }
+
+      // move the second half of the inner batches to the subset processed
+      // after the boundary batches
+      unsigned int n_inner_batches_seen = 0;
+      for (auto &subset : transfer.cell_subsets)
+        if (subset == CellSubset::inner_first &&
+            n_inner_batches_seen++ >= n_inner_batches / 2)
+          subset = CellSubset::inner_second;
+    }
+
+
+
   public:
     template <int dim, typename Number>
     static std::shared_ptr<const Utilities::MPI::Partitioner>
@@ -2162,6 +2245,9 @@ namespace internal
       // ------------------------------- weights -------------------------------
       if (transfer.fine_element_is_continuous)
         setup_weights(constraints_fine, transfer, is_feq);
+
+      // ----------------------------- cell subsets ----------------------------
+      setup_cell_subsets(transfer);
     }
 
 
@@ -2598,6 +2684,9 @@ namespace internal
       // ------------------------------- weights -------------------------------
       if (transfer.fine_element_is_continuous)
         setup_weights(constraints_fine, transfer, is_feq);
+
+      // ----------------------------- cell subsets ----------------------------
+      setup_cell_subsets(transfer);
     }
   };
 
@@ -2608,10 +2697,12 @@ namespace internal
   {
     SimpleVectorDataExchange(
       const std::shared_ptr<const Utilities::MPI::Partitioner>
-                            &embedded_partitioner,
-      AlignedVector<Number> &buffer)
+                               &embedded_partitioner,
+      AlignedVector<Number>    &buffer,
+      std::vector<MPI_Request> &requests)
       : embedded_partitioner(embedded_partitioner)
       , buffer(buffer)
+      , requests(requests)
     {}
 
     template <typename VectorType>
@@ -2748,8 +2839,8 @@ namespace internal
   private:
     const std::shared_ptr<const Utilities::MPI::Partitioner>
                                      embedded_partitioner;
-    dealii::AlignedVector<Number>   &buffer;
-    mutable std::vector<MPI_Request> requests;
+    dealii::AlignedVector<Number>    &buffer;
+    std::vector<MPI_Request>         &requests;
   };
 
 } // namespace internal
@@ -2979,6 +3070,97 @@ namespace MGTransferGlobalCoarseningTools
       repartition_fine_triangulation);
   }
 
+
+
+  template <int dim, int spacedim>
+  std::shared_ptr<const Triangulation<dim, spacedim>>
+  create_agglomerated_triangulation(const Triangulation<dim, spacedim> &tria)
+  {
+#ifndef DEAL_II_WITH_MPI
+    DEAL_II_NOT_IMPLEMENTED();
+    (void)tria;
+    return {};
+#else
+    // only a fully distributed triangulation keeps the order of the cells
+    // given by the description, which the enumeration of the unknowns on
+    // both triangulations relies on
+    const auto parallel_tria = dynamic_cast<
+      const parallel::fullydistributed::Triangulation<dim, spacedim> *>(&tria);
+    AssertThrow(parallel_tria != nullptr,
+                ExcMessage("This function needs a triangulation of type "
+                           "parallel::fullydistributed::Triangulation, as "
+                           "created by create_geometric_coarsening_sequence() "
+                           "with a repartitioning policy."));
+
+    const MPI_Comm comm = tria.get_mpi_communicator();
+
+    const unsigned int has_cells =
+      parallel_tria->n_locally_owned_active_cells() > 0;
+
+    // determine the ranks of the processes with cells within the
+    // subcommunicator, which keeps the order of the processes
+    const std::vector<unsigned int> processes_with_cells =
+      Utilities::MPI::all_gather(comm, has_cells);
+
+    std::vector<types::subdomain_id> new_ranks(
+      processes_with_cells.size(), numbers::artificial_subdomain_id);
+    for (unsigned int p = 0, counter = 0; p < processes_with_cells.size(); ++p)
+      if (processes_with_cells[p] > 0)
+        new_ranks[p] = counter++;
+
+    MPI_Comm  sub_comm;
+    const int ierr =
+      MPI_Comm_split(comm,
+                     has_cells ? 0 : MPI_UNDEFINED,
+                     Utilities::MPI::this_mpi_process(comm),
+                     &sub_comm);
+    AssertThrowMPI(ierr);
+
+    if (has_cells == 0)
+      return {};
+
+    // describe the locally relevant cells and translate the owners of the
+    // cells to the ranks within the subcommunicator
+    auto construction_data = TriangulationDescription::Utilities::
+      create_description_from_triangulation(tria, comm);
+
+    construction_data.comm = sub_comm;
+    for (auto &cell_infos : construction_data.cell_infos)
+      for (auto &cell_info : cell_infos)
+        {
+          if (cell_info.subdomain_id != numbers::artificial_subdomain_id)
+            {
+              AssertIndexRange(cell_info.subdomain_id, new_ranks.size());
+              cell_info.subdomain_id = new_ranks[cell_info.subdomain_id];
+            }
+          if (cell_info.level_subdomain_id != numbers::artificial_subdomain_id)
+            {
+              AssertIndexRange(cell_info.level_subdomain_id, new_ranks.size());
+              cell_info.level_subdomain_id =
+                new_ranks[cell_info.level_subdomain_id];
+            }
+        }
+
+    // the triangulation only stores the communicator, so free the latter
+    // together with the triangulation
+    std::shared_ptr<parallel::fullydistributed::Triangulation<dim, spacedim>>
+      agglomerated_triangulation(
+        new parallel::fullydistributed::Triangulation<dim, spacedim>(sub_comm),
+        [sub_comm](auto *p) {
+          delete p;
+          Utilities::MPI::free_communicator(sub_comm);
+        });
+
+    for (const auto i : tria.get_manifold_ids())
+      if (i != numbers::flat_manifold_id)
+        agglomerated_triangulation->set_manifold(i, tria.get_manifold(i));
+
+    agglomerated_triangulation->create_triangulation(construction_data);
+
+    return agglomerated_triangulation;
+#endif
+  }
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
@@ -3012,16 +3194,39 @@ MGTwoLevelTransferBase<VectorType>::prolongate_and_add(
   if (use_src_inplace == false)
     this->vec_coarse.copy_locally_owned_data_from(src);
 
-  if ((use_src_inplace == false) || (src_ghosts_have_been_set == false))
-    this->update_ghost_values(*vec_coarse_ptr);
+  const bool update_src_ghosts =
+    (use_src_inplace == false) || (src_ghosts_have_been_set == false);
+  if (update_src_ghosts)
+    this->update_ghost_values_start(*vec_coarse_ptr);
 
   if (use_dst_inplace == false)
     *vec_fine_ptr = Number(0.);
 
-  this->prolongate_and_add_internal(*vec_fine_ptr, *vec_coarse_ptr);
+  // overlap the import of the coarse ghost values with the work on cells
+  // that only access locally owned entries, and the export of the fine ghost
+  // contributions with the second half of those cells
+  this->prolongate_and_add_internal(*vec_fine_ptr,
+                                    *vec_coarse_ptr,
+                                    CellSubset::inner_first);
+
+  if (update_src_ghosts)
+    this->update_ghost_values_finish(*vec_coarse_ptr);
+
+  this->prolongate_and_add_internal(*vec_fine_ptr,
+                                    *vec_coarse_ptr,
+                                    CellSubset::boundary);
 
-  if (this->vec_fine_needs_ghost_update || use_dst_inplace == false)
-    this->compress(*vec_fine_ptr, VectorOperation::add);
+  const bool compress_dst =
+    this->vec_fine_needs_ghost_update || use_dst_inplace == false;
+  if (compress_dst)
+    this->compress_start(*vec_fine_ptr, VectorOperation::add);
+
+  this->prolongate_and_add_internal(*vec_fine_ptr,
+                                    *vec_coarse_ptr,
+                                    CellSubset::inner_second);
+
+  if (compress_dst)
+    this->compress_finish(*vec_fine_ptr, VectorOperation::add);
 
   if (use_dst_inplace == false)
     dst += this->vec_fine;
@@ -3032,6 +3237,32 @@ MGTwoLevelTransferBase<VectorType>::prolongate_and_add(
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::prolongate_and_add_internal(
+  VectorType       &dst,
+  const VectorType &src,
+  const CellSubset  cells) const
+{
+  if (cells == CellSubset::boundary)
+    this->prolongate_and_add_internal(dst, src);
+}
+
+
+
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::restrict_and_add_internal(
+  VectorType       &dst,
+  const VectorType &src,
+  const CellSubset  cells) const
+{
+  if (cells == CellSubset::boundary)
+    this->restrict_and_add_internal(dst, src);
+}
+
+
+
 namespace internal
 {
   namespace
@@ -3089,8 +3320,32 @@ MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
   VectorType       &dst,
   const VectorType &src) const
 {
+  using CellSubset = typename MGTwoLevelTransferBase<VectorType>::CellSubset;
+
+  for (const CellSubset cells : {CellSubset::inner_first,
+                                 CellSubset::boundary,
+                                 CellSubset::inner_second})
+    this->prolongate_and_add_internal(dst, src, cells);
+}
+
+
+
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
+  VectorType                                                   &dst,
+  const VectorType                                             &src,
+  const typename MGTwoLevelTransferBase<VectorType>::CellSubset cells) const
+{
+  using CellSubset = typename MGTwoLevelTransferBase<VectorType>::CellSubset;
+
   if (matrix_free_data.get() != nullptr)
     {
+      // the cell loop of the fine MatrixFree object does not distinguish
+      // between the cells, so do all work in one go
+      if (cells != CellSubset::boundary)
+        return;
+
       matrix_free_data->matrix_free_fine->template cell_loop<VectorType, int>(
         [&](const MatrixFree<dim, Number> &data,
             VectorType                    &dst,
@@ -3203,6 +3458,13 @@ MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
                   (scheme.n_coarse_cells - cell) :
                   n_lanes;
 
+              if ((cell_subsets.empty() ? CellSubset::boundary :
+                                          cell_subsets[batch_counter]) != cells)
+                {
+                  cell_counter += n_lanes_filled;
+                  continue;
+                }
+
               // read from src vector (similar to
               // FEEvaluation::read_dof_values())
               internal::VectorReader<Number, VectorizedArrayType> reader;
@@ -3300,9 +3562,11 @@ MGTwoLevelTransferBase<VectorType>::restrict_and_add(
   if (use_src_inplace == false)
     this->vec_fine.copy_locally_owned_data_from(src);
 
-  if ((use_src_inplace == false) ||
-      (vec_fine_needs_ghost_update && (src_ghosts_have_been_set == false)))
-    this->update_ghost_values(*vec_fine_ptr);
+  const bool update_src_ghosts =
+    (use_src_inplace == false) ||
+    (vec_fine_needs_ghost_update && (src_ghosts_have_been_set == false));
+  if (update_src_ghosts)
+    this->update_ghost_values_start(*vec_fine_ptr);
 
   if (use_dst_inplace == false)
     *vec_coarse_ptr = Number(0.0);
@@ -3310,7 +3574,24 @@ MGTwoLevelTransferBase<VectorType>::restrict_and_add(
   // since we might add into the ghost values and call compress
   this->zero_out_ghost_values(*vec_coarse_ptr);
 
-  this->restrict_and_add_internal(*vec_coarse_ptr, *vec_fine_ptr);
+  // overlap communication with the work on cells that only access locally
+  // owned entries, see prolongate_and_add()
+  this->restrict_and_add_internal(*vec_coarse_ptr,
+                                  *vec_fine_ptr,
+                                  CellSubset::inner_first);
+
+  if (update_src_ghosts)
+    this->update_ghost_values_finish(*vec_fine_ptr);
+
+  this->restrict_and_add_internal(*vec_coarse_ptr,
+                                  *vec_fine_ptr,
+                                  CellSubset::boundary);
+
+  this->compress_start(*vec_coarse_ptr, VectorOperation::add);
+
+  this->restrict_and_add_internal(*vec_coarse_ptr,
+                                  *vec_fine_ptr,
+                                  CellSubset::inner_second);
 
   // clean up related to update_ghost_values()
   if (vec_fine_needs_ghost_update == false && use_src_inplace == false)
@@ -3320,7 +3601,7 @@ MGTwoLevelTransferBase<VectorType>::restrict_and_add(
   else if (vec_fine_needs_ghost_update && (src_ghosts_have_been_set == false))
     this->zero_out_ghost_values(*vec_fine_ptr); // external vector
 
-  this->compress(*vec_coarse_ptr, VectorOperation::add);
+  this->compress_finish(*vec_coarse_ptr, VectorOperation::add);
 
   if (use_dst_inplace == false)
     dst += this->vec_coarse;
@@ -3334,8 +3615,32 @@ MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_internal(
   VectorType       &dst,
   const VectorType &src) const
 {
+  using CellSubset = typename MGTwoLevelTransferBase<VectorType>::CellSubset;
+
+  for (const CellSubset cells : {CellSubset::inner_first,
+                                 CellSubset::boundary,
+                                 CellSubset::inner_second})
+    this->restrict_and_add_internal(dst, src, cells);
+}
+
+
+
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_internal(
+  VectorType                                                   &dst,
+  const VectorType                                             &src,
+  const typename MGTwoLevelTransferBase<VectorType>::CellSubset cells) const
+{
+  using CellSubset = typename MGTwoLevelTransferBase<VectorType>::CellSubset;
+
   if (matrix_free_data.get() != nullptr)
     {
+      // the cell loop of the fine MatrixFree object does not distinguish
+      // between the cells, so do all work in one go
+      if (cells != CellSubset::boundary)
+        return;
+
       int dummy = 0;
       matrix_free_data->matrix_free_fine->template cell_loop<int, VectorType>(
         [&](const MatrixFree<dim, Number> &data,
@@ -3450,6 +3755,13 @@ MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_internal(
                   (scheme.n_coarse_cells - cell) :
                   n_lanes;
 
+              if ((cell_subsets.empty() ? CellSubset::boundary :
+                                          cell_subsets[batch_counter]) != cells)
+                {
+                  cell_counter += n_lanes_filled;
+                  continue;
+                }
+
               // read from source vector
               internal::VectorReader<Number, VectorizedArrayType> reader;
               constraint_info_fine.read_write_operation(
@@ -4001,6 +4313,7 @@ MGTwoLevelTransfer<dim, VectorType>::reinit(
   const unsigned int             dof_no_coarse)
 {
   matrix_free_data = std::make_unique<MatrixFreeRelatedData>();
+  cell_subsets.clear();
 
   MatrixFreeRelatedData &data = *matrix_free_data;
   data.matrix_free_fine       = &matrix_free_fine;
@@ -4184,6 +4497,7 @@ MGTwoLevelTransfer<dim, VectorType>::memory_consumption() const
   size += weights.memory_consumption();
   size += MemoryConsumption::memory_consumption(weights_start);
   size += MemoryConsumption::memory_consumption(weights_are_compressed);
+  size += cell_subsets.capacity() * sizeof(cell_subsets[0]);
   size += constraint_info_coarse.memory_consumption();
   size += constraint_info_fine.memory_consumption();
 
@@ -4200,12 +4514,15 @@ MGTwoLevelTransferBase<VectorType>::update_ghost_values(
   if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
       (this->partitioner_coarse_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(
-      this->partitioner_coarse_embedded, this->buffer_coarse_embedded)
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
       .update_ghost_values(vec);
   else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
            (this->partitioner_fine_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
-                                               this->buffer_fine_embedded)
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
       .update_ghost_values(vec);
   else
     vec.update_ghost_values();
@@ -4213,6 +4530,54 @@ MGTwoLevelTransferBase<VectorType>::update_ghost_values(
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::update_ghost_values_start(
+  const VectorType &vec) const
+{
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .update_ghost_values_start(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .update_ghost_values_start(vec);
+  else
+    vec.update_ghost_values_start();
+}
+
+
+
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::update_ghost_values_finish(
+  const VectorType &vec) const
+{
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .update_ghost_values_finish(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .update_ghost_values_finish(vec);
+  else
+    vec.update_ghost_values_finish();
+}
+
+
+
 template <typename VectorType>
 void
 MGTwoLevelTransferBase<VectorType>::compress(
@@ -4224,12 +4589,15 @@ MGTwoLevelTransferBase<VectorType>::compress(
   if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
       (this->partitioner_coarse_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(
-      this->partitioner_coarse_embedded, this->buffer_coarse_embedded)
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
       .compress(vec);
   else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
            (this->partitioner_fine_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
-                                               this->buffer_fine_embedded)
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
       .compress(vec);
   else
     vec.compress(op);
@@ -4237,6 +4605,60 @@ MGTwoLevelTransferBase<VectorType>::compress(
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::compress_start(
+  VectorType                   &vec,
+  const VectorOperation::values op) const
+{
+  Assert(op == VectorOperation::add, ExcNotImplemented());
+
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .compress_start(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .compress_start(vec);
+  else
+    vec.compress_start(0, op);
+}
+
+
+
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::compress_finish(
+  VectorType                   &vec,
+  const VectorOperation::values op) const
+{
+  Assert(op == VectorOperation::add, ExcNotImplemented());
+
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .compress_finish(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .compress_finish(vec);
+  else
+    vec.compress_finish(op);
+}
+
+
+
 template <typename VectorType>
 void
 MGTwoLevelTransferBase<VectorType>::zero_out_ghost_values(
@@ -4245,12 +4667,15 @@ MGTwoLevelTransferBase<VectorType>::zero_out_ghost_values(
   if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
       (this->partitioner_coarse_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(
-      this->partitioner_coarse_embedded, this->buffer_coarse_embedded)
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
       .zero_out_ghost_values(vec);
-  else if ((vec.get_partitioner().get() == (this->partitioner_fine.get()) &&
-            this->partitioner_fine_embedded != nullptr))
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
-                                               this->buffer_fine_embedded)
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
       .zero_out_ghost_values(vec);
   else
     vec.zero_out_ghost_values();
@@ -1777,6 +1777,87 @@ QGaussSimplex<dim>::QGaussSimplex(const unsigned int n_points_1D)
            Utilities::to_string(n_points_1D)));
 }
 
+namespace internal
+{
+  namespace QCollapsedGaussSimplex
+  {
+    /**
+     * Compute the Gauss-Jacobi quadrature formula with @p n points on the unit
+     * interval for the weight function $(1-x)^\alpha$.
+     */
+    Quadrature<1>
+    compute_gauss_jacobi(const unsigned int n, const int alpha)
+    {
+      const std::vector<long double> points =
+        Polynomials::jacobi_polynomial_roots<long double>(n, alpha, 0);
+
+      std::vector<Point<1>> quadrature_points(n);
+      std::vector<double>   weights(n);
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          // derivative of Jacobi polynomial
+          const long double pp =
+            0.5 * (n + alpha + 1) *
+            Polynomials::jacobi_polynomial_value(n - 1,
+                                                 alpha + 1,
+                                                 1,
+                                                 points[i]);
+          const long double x  = -1. + 2. * points[i];
+          quadrature_points[i] = Point<1>(static_cast<double>(points[i]));
+          weights[i]           = 1. / ((1. - x * x) * pp * pp);
+        }
+
+      return Quadrature<1>(quadrature_points, weights);
+    }
+  } // namespace QCollapsedGaussSimplex
+} // namespace internal
+
+
+
+template <int dim>
+QCollapsedGaussSimplex<dim>::QCollapsedGaussSimplex(
+  const unsigned int n_points_1D)
+  : QSimplex<dim>(Quadrature<dim>())
+{
+  Assert(1 <= dim && dim <= 3, ExcNotImplemented());
+  if (dim == 1)
+    {
+      Quadrature<dim>::operator=(QGauss<dim>(n_points_1D));
+      return;
+    }
+
+  // the weight functions of the Gauss-Jacobi formulas in the second and
+  // third coordinate are the factors (1-b) and (1-c)^2 of the Jacobian of
+  // the collapsed transformation
+  const QGauss<1>     quad_a(n_points_1D);
+  const Quadrature<1> quad_b =
+    internal::QCollapsedGaussSimplex::compute_gauss_jacobi(n_points_1D, 1);
+  const Quadrature<1> quad_c =
+    dim == 3 ?
+      internal::QCollapsedGaussSimplex::compute_gauss_jacobi(n_points_1D, 2) :
+      Quadrature<1>(Point<1>());
+
+  for (unsigned int k = 0; k < quad_c.size(); ++k)
+    for (unsigned int j = 0; j < quad_b.size(); ++j)
+      for (unsigned int i = 0; i < quad_a.size(); ++i)
+        {
+          const double a = quad_a.point(i)[0];
+          const double b = quad_b.point(j)[0];
+          const double c = quad_c.point(k)[0];
+
+          const std::array<double, 3> coordinates = {
+            {a * (1. - b) * (1. - c), b * (1. - c), c}};
+          Point<dim> point;
+          for (unsigned int d = 0; d < dim; ++d)
+            point[d] = coordinates[d];
+          this->quadrature_points.push_back(point);
+          this->weights.push_back(quad_a.weight(i) * quad_b.weight(j) *
+                                  quad_c.weight(k));
+        }
+}
+
+
+
 namespace
 {
   template <std::size_t b_dim>
@@ -2485,6 +2566,10 @@ template class QWitherdenVincentSimplex<1>;
 template class QWitherdenVincentSimplex<2>;
 template class QWitherdenVincentSimplex<3>;
 
+template class QCollapsedGaussSimplex<1>;
+template class QCollapsedGaussSimplex<2>;
+template class QCollapsedGaussSimplex<3>;
+
 #ifndef DOXYGEN
 template Quadrature<1>
 QSimplex<1>::compute_affine_transformation(
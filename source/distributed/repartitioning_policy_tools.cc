@@ -18,6 +18,8 @@
 #include <deal.II/distributed/repartitioning_policy_tools.h>
 #include <deal.II/distributed/tria_base.h>
 
+#include <deal.II/fe/fe.h>
+
 #include <deal.II/grid/cell_id_translator.h>
 #include <deal.II/grid/filtered_iterator.h>
 
@@ -42,6 +44,26 @@ namespace RepartitioningPolicyTools
                                                        cell_id_translator,
                                                        is_fine);
     }
+
+
+
+    /**
+     * Estimate the number of degrees of freedom of @p fe per cell in the
+     * interior of a mesh of hypercube cells, where each cell contributes one
+     * vertex, dim lines, dim*(dim-1)/2 quads, and so on.
+     */
+    template <int dim, int spacedim>
+    unsigned int
+    estimate_n_dofs_per_cell(const FiniteElement<dim, spacedim> &fe)
+    {
+      unsigned int n_dofs = fe.n_dofs_per_vertex() + dim * fe.n_dofs_per_line();
+      if (dim == 2)
+        n_dofs += fe.n_dofs_per_quad();
+      else if (dim == 3)
+        n_dofs += 3 * fe.n_dofs_per_quad(0) + fe.n_dofs_per_hex();
+
+      return std::max(n_dofs, 1U);
+    }
   } // namespace
 
 
@@ -175,6 +197,17 @@ namespace RepartitioningPolicyTools
 
 
 
+  template <int dim, int spacedim>
+  MinimalGranularityPolicy<dim, spacedim>::MinimalGranularityPolicy(
+    const FiniteElement<dim, spacedim> &fe,
+    const unsigned int                  n_min_dofs)
+    : n_min_cells(std::max(1U,
+                           (n_min_dofs + estimate_n_dofs_per_cell(fe) - 1) /
+                             estimate_n_dofs_per_cell(fe)))
+  {}
+
+
+
   template <int dim, int spacedim>
   LinearAlgebra::distributed::Vector<double>
   MinimalGranularityPolicy<dim, spacedim>::partition(
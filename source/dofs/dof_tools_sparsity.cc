@@ -16,6 +16,7 @@
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria_base.h>
@@ -40,6 +41,7 @@
 
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/sparsity_pattern_base.h>
+#include <deal.II/lac/sparsity_pattern_builder.h>
 #include <deal.II/lac/vector.h>
 
 #include <algorithm>
@@ -89,35 +91,65 @@ namespace DoFTools
         fe_dof_mask[f] = fe_collection[f].get_local_dof_sparsity_pattern();
       }
 
-    std::vector<types::global_dof_index> dofs_on_this_cell;
-    dofs_on_this_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
+    const auto add_cell_entries =
+      [&](const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell,
+          std::vector<types::global_dof_index> &dofs_on_this_cell) {
+        const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
+        dofs_on_this_cell.resize(dofs_per_cell);
+        cell->get_dof_indices(dofs_on_this_cell);
+
+        // make sparsity pattern for this cell. if no constraints pattern
+        // was given, then the following call acts as if simply no
+        // constraints existed
+        const types::fe_index fe_index = cell->active_fe_index();
+        if (fe_dof_mask[fe_index].empty())
+          constraints.add_entries_local_to_global(dofs_on_this_cell,
+                                                  sparsity,
+                                                  keep_constrained_dofs);
+        else
+          constraints.add_entries_local_to_global(dofs_on_this_cell,
+                                                  sparsity,
+                                                  keep_constrained_dofs,
+                                                  fe_dof_mask[fe_index]);
+      };
 
     // In case we work with a distributed sparsity pattern of Trilinos
     // type, we only have to do the work if the current cell is owned by
     // the calling processor. Otherwise, just continue.
-    for (const auto &cell : dof.active_cell_iterators())
-      if (((subdomain_id == numbers::invalid_subdomain_id) ||
-           (subdomain_id == cell->subdomain_id())) &&
-          cell->is_locally_owned())
-        {
-          const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
-          dofs_on_this_cell.resize(dofs_per_cell);
-          cell->get_dof_indices(dofs_on_this_cell);
+    const auto cell_is_relevant = [&](const auto &cell) {
+      return ((subdomain_id == numbers::invalid_subdomain_id) ||
+              (subdomain_id == cell->subdomain_id())) &&
+             cell->is_locally_owned();
+    };
 
-          // make sparsity pattern for this cell. if no constraints pattern
-          // was given, then the following call acts as if simply no
-          // constraints existed
-          const types::fe_index fe_index = cell->active_fe_index();
-          if (fe_dof_mask[fe_index].empty())
-            constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                    sparsity,
-                                                    keep_constrained_dofs);
-          else
-            constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                    sparsity,
-                                                    keep_constrained_dofs,
-                                                    fe_dof_mask[fe_index]);
-        }
+    std::vector<types::global_dof_index> dofs_on_this_cell;
+    dofs_on_this_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
+
+    // A SparsityPatternBuilder accepts entries from several threads at the
+    // same time, so we can loop over the cells in parallel. There is nothing
+    // to be copied into a global object, so the copier is empty.
+    if (dynamic_cast<SparsityPatternBuilder *>(&sparsity) != nullptr)
+      {
+        struct CopyData
+        {};
+        WorkStream::run(
+          dof.begin_active(),
+          dof.end(),
+          [&](const typename DoFHandler<dim, spacedim>::active_cell_iterator
+                                                     &cell,
+              std::vector<types::global_dof_index> &scratch_dof_indices,
+              CopyData &) {
+            if (cell_is_relevant(cell))
+              add_cell_entries(cell, scratch_dof_indices);
+          },
+          [](const CopyData &) {},
+          dofs_on_this_cell,
+          CopyData());
+      }
+    else
+      for (const auto &cell : dof.active_cell_iterators())
+        if (cell_is_relevant(cell))
+          add_cell_entries(cell, dofs_on_this_cell);
   }
 
 
@@ -1143,6 +1175,41 @@ namespace DoFTools
                                          face_has_flux_coupling);
   }
 
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  suggest_chunk_size(const DoFHandler<dim, spacedim> &dof_handler)
+  {
+    const hp::FECollection<dim, spacedim> &fe_collection =
+      dof_handler.get_fe_collection();
+    Assert(fe_collection.size() > 0, ExcNoFESelected());
+
+    const unsigned int n_components = fe_collection.n_components();
+    for (unsigned int f = 0; f < fe_collection.size(); ++f)
+      {
+        const FiniteElement<dim, spacedim> &fe = fe_collection[f];
+
+        // collect the number of degrees of freedom on each kind of object a
+        // cell is made of
+        std::vector<unsigned int> dofs_per_object = {fe.n_dofs_per_vertex(),
+                                                     fe.n_dofs_per_line()};
+        if (dim > 1)
+          for (unsigned int face_no = 0;
+               face_no < (dim == 3 ? fe.reference_cell().n_faces() : 1);
+               ++face_no)
+            dofs_per_object.push_back(fe.n_dofs_per_quad(face_no));
+        if (dim > 2)
+          dofs_per_object.push_back(fe.n_dofs_per_hex());
+
+        for (const unsigned int n_dofs : dofs_per_object)
+          if (n_dofs % n_components != 0)
+            return 1;
+      }
+
+    return n_components;
+  }
+
 } // end of namespace DoFTools
 
 
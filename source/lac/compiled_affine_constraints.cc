@@ -0,0 +1,425 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/compiled_affine_constraints.h>
+
+#include <algorithm>
+#include <limits>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace CompiledAffineConstraintsImplementation
+  {
+    /**
+     * The number of batches or single constraints below which the
+     * constraints are applied by a single thread.
+     */
+    constexpr unsigned int minimum_parallel_grain_size = 512;
+  } // namespace CompiledAffineConstraintsImplementation
+} // namespace internal
+
+
+
+template <typename Number>
+template <typename number2>
+void
+CompiledAffineConstraints<Number>::reinit(
+  const AffineConstraints<number2>                          &constraints,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+{
+  Assert(constraints.is_closed(),
+         ExcMessage("The constraints must be closed."));
+
+  clear();
+  this->partitioner = partitioner;
+
+  // translate a global index into an index into the local storage of the
+  // vectors, which for serial vectors is the global index itself
+  const auto local_index = [&](const size_type global_index) -> unsigned int {
+    if (partitioner.get() == nullptr)
+      {
+        AssertIndexRange(global_index,
+                         std::numeric_limits<unsigned int>::max());
+        return global_index;
+      }
+    Assert(partitioner->in_local_range(global_index) ||
+             partitioner->is_ghost_entry(global_index),
+           ExcIndexNotAvailable(global_index));
+    return partitioner->global_to_local(global_index);
+  };
+
+  // collect the constraints we need to apply, in the order of increasing
+  // length
+  std::vector<const typename AffineConstraints<number2>::ConstraintLine *>
+    lines;
+  for (const auto &line : constraints.get_lines())
+    if (partitioner.get() == nullptr ||
+        partitioner->in_local_range(line.index))
+      lines.push_back(&line);
+  std::stable_sort(lines.begin(), lines.end(), [](const auto a, const auto b) {
+    return a->entries.size() < b->entries.size();
+  });
+
+  const unsigned int n_lanes = VectorizedArray<Number>::size();
+  batch_entry_starts.push_back(0);
+  row_starts.push_back(0);
+
+  for (std::size_t begin = 0; begin < lines.size();)
+    {
+      // find the constraints with the same number of entries
+      const std::size_t n_entries = lines[begin]->entries.size();
+      std::size_t       end       = begin;
+      while (end < lines.size() && lines[end]->entries.size() == n_entries)
+        ++end;
+
+      // group as many of them as possible into full batches
+      const std::size_t n_batches = (end - begin) / n_lanes;
+      for (std::size_t batch = 0; batch < n_batches; ++batch)
+        {
+          const auto *const batch_lines = &lines[begin + batch * n_lanes];
+
+          VectorizedArray<Number> inhomogeneity;
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            {
+              batch_rows.push_back(local_index(batch_lines[v]->index));
+              inhomogeneity[v] = batch_lines[v]->inhomogeneity;
+            }
+          batch_inhomogeneities.push_back(inhomogeneity);
+
+          for (std::size_t k = 0; k < n_entries; ++k)
+            {
+              VectorizedArray<Number> weight;
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                {
+                  batch_columns.push_back(
+                    local_index(batch_lines[v]->entries[k].first));
+                  weight[v] = batch_lines[v]->entries[k].second;
+                }
+              batch_weights.push_back(weight);
+            }
+          batch_entry_starts.push_back(batch_weights.size());
+        }
+
+      // and store the remaining ones one by one
+      for (std::size_t l = begin + n_batches * n_lanes; l < end; ++l)
+        {
+          rows.push_back(local_index(lines[l]->index));
+          inhomogeneities.push_back(lines[l]->inhomogeneity);
+          for (const auto &entry : lines[l]->entries)
+            {
+              columns.push_back(local_index(entry.first));
+              weights.push_back(entry.second);
+            }
+          row_starts.push_back(columns.size());
+        }
+
+      begin = end;
+    }
+
+  for (const auto *const line : lines)
+    if (line->inhomogeneity != number2())
+      {
+        has_inhomogeneities = true;
+        break;
+      }
+
+  for (const unsigned int i : batch_rows)
+    max_index = std::max<size_type>(max_index, i + 1);
+  for (const unsigned int i : batch_columns)
+    max_index = std::max<size_type>(max_index, i + 1);
+  for (const unsigned int i : rows)
+    max_index = std::max<size_type>(max_index, i + 1);
+  for (const unsigned int i : columns)
+    max_index = std::max<size_type>(max_index, i + 1);
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::clear()
+{
+  partitioner.reset();
+  max_index           = 0;
+  has_inhomogeneities = false;
+
+  batch_rows.clear();
+  batch_inhomogeneities.clear();
+  batch_entry_starts.clear();
+  batch_columns.clear();
+  batch_weights.clear();
+
+  rows.clear();
+  inhomogeneities.clear();
+  row_starts.clear();
+  columns.clear();
+  weights.clear();
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::apply_distribute(Number *values) const
+{
+  const unsigned int n_lanes   = VectorizedArray<Number>::size();
+  const unsigned int n_batches = batch_inhomogeneities.size();
+
+  // Since no constraint depends on another constrained entry, the writes of
+  // one thread never touch the entries read by another one.
+  parallel::apply_to_subranges(
+    0U,
+    n_batches,
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int batch = begin; batch < end; ++batch)
+        {
+          VectorizedArray<Number> result = batch_inhomogeneities[batch];
+          for (unsigned int k = batch_entry_starts[batch];
+               k < batch_entry_starts[batch + 1];
+               ++k)
+            {
+              VectorizedArray<Number> value;
+              value.gather(values, batch_columns.data() + k * n_lanes);
+              result += batch_weights[k] * value;
+            }
+          result.scatter(batch_rows.data() + batch * n_lanes, values);
+        }
+    },
+    internal::CompiledAffineConstraintsImplementation::
+        minimum_parallel_grain_size /
+      n_lanes);
+
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(rows.size()),
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int r = begin; r < end; ++r)
+        {
+          Number result = inhomogeneities[r];
+          for (unsigned int k = row_starts[r]; k < row_starts[r + 1]; ++k)
+            result += weights[k] * values[columns[k]];
+          values[rows[r]] = result;
+        }
+    },
+    internal::CompiledAffineConstraintsImplementation::
+      minimum_parallel_grain_size);
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::apply_set_zero(Number *values) const
+{
+  const unsigned int n_lanes   = VectorizedArray<Number>::size();
+  const unsigned int n_batches = batch_inhomogeneities.size();
+
+  parallel::apply_to_subranges(
+    0U,
+    n_batches,
+    [&](const unsigned int begin, const unsigned int end) {
+      const VectorizedArray<Number> zero = Number();
+      for (unsigned int batch = begin; batch < end; ++batch)
+        zero.scatter(batch_rows.data() + batch * n_lanes, values);
+    },
+    internal::CompiledAffineConstraintsImplementation::
+        minimum_parallel_grain_size /
+      n_lanes);
+
+  for (const unsigned int row : rows)
+    values[row] = Number();
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::apply_condense(Number *values) const
+{
+  Assert(has_inhomogeneities == false,
+         ExcMessage("Inhomogeneous constraint cannot be condensed "
+                    "without any matrix specified."));
+
+  // Several constraints may add to the same entry, so this loop runs on a
+  // single thread. The constrained entries themselves are never added to,
+  // so they can be zeroed right away.
+  const unsigned int n_lanes   = VectorizedArray<Number>::size();
+  const unsigned int n_batches = batch_inhomogeneities.size();
+  for (unsigned int batch = 0; batch < n_batches; ++batch)
+    {
+      VectorizedArray<Number> value;
+      value.gather(values, batch_rows.data() + batch * n_lanes);
+      for (unsigned int k = batch_entry_starts[batch];
+           k < batch_entry_starts[batch + 1];
+           ++k)
+        for (unsigned int v = 0; v < n_lanes; ++v)
+          values[batch_columns[k * n_lanes + v]] +=
+            batch_weights[k][v] * value[v];
+      VectorizedArray<Number>(Number())
+        .scatter(batch_rows.data() + batch * n_lanes, values);
+    }
+
+  for (unsigned int r = 0; r < rows.size(); ++r)
+    {
+      const Number value = values[rows[r]];
+      for (unsigned int k = row_starts[r]; k < row_starts[r + 1]; ++k)
+        values[columns[k]] += weights[k] * value;
+      values[rows[r]] = Number();
+    }
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::distribute(Vector<Number> &vec) const
+{
+  Assert(partitioner.get() == nullptr, ExcPartitionerMismatch());
+  AssertIndexRange(max_index, vec.size() + 1);
+
+  apply_distribute(vec.data());
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::distribute(
+  LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec) const
+{
+  Assert(partitioner.get() != nullptr, ExcPartitionerMismatch());
+  Assert(vec.get_partitioner().get() == partitioner.get() ||
+           vec.get_partitioner()->is_compatible(*partitioner),
+         ExcPartitionerMismatch());
+
+  const bool has_ghost_elements = vec.has_ghost_elements();
+  if (has_ghost_elements == false)
+    vec.update_ghost_values();
+
+  apply_distribute(vec.begin());
+
+  if (has_ghost_elements)
+    vec.update_ghost_values();
+  else
+    vec.zero_out_ghost_values();
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::set_zero(Vector<Number> &vec) const
+{
+  Assert(partitioner.get() == nullptr, ExcPartitionerMismatch());
+  AssertIndexRange(max_index, vec.size() + 1);
+
+  apply_set_zero(vec.data());
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::set_zero(
+  LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec) const
+{
+  Assert(partitioner.get() != nullptr, ExcPartitionerMismatch());
+  Assert(vec.get_partitioner().get() == partitioner.get() ||
+           vec.get_partitioner()->is_compatible(*partitioner),
+         ExcPartitionerMismatch());
+
+  apply_set_zero(vec.begin());
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::condense(Vector<Number> &vec) const
+{
+  Assert(partitioner.get() == nullptr, ExcPartitionerMismatch());
+  AssertIndexRange(max_index, vec.size() + 1);
+
+  apply_condense(vec.data());
+}
+
+
+
+template <typename Number>
+void
+CompiledAffineConstraints<Number>::condense(
+  LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec) const
+{
+  Assert(partitioner.get() != nullptr, ExcPartitionerMismatch());
+  Assert(vec.get_partitioner().get() == partitioner.get() ||
+           vec.get_partitioner()->is_compatible(*partitioner),
+         ExcPartitionerMismatch());
+  Assert(vec.has_ghost_elements() == false,
+         ExcMessage("The vector must not have ghost values set."));
+
+  // the ghost entries of a vector without ghost values are zero, so they
+  // can collect the contributions to entries owned by other processes
+  apply_condense(vec.begin());
+  vec.compress(VectorOperation::add);
+}
+
+
+
+template <typename Number>
+std::size_t
+CompiledAffineConstraints<Number>::memory_consumption() const
+{
+  return sizeof(*this) +
+         MemoryConsumption::memory_consumption(batch_rows) +
+         MemoryConsumption::memory_consumption(batch_inhomogeneities) +
+         MemoryConsumption::memory_consumption(batch_entry_starts) +
+         MemoryConsumption::memory_consumption(batch_columns) +
+         MemoryConsumption::memory_consumption(batch_weights) +
+         MemoryConsumption::memory_consumption(rows) +
+         MemoryConsumption::memory_consumption(inhomogeneities) +
+         MemoryConsumption::memory_consumption(row_starts) +
+         MemoryConsumption::memory_consumption(columns) +
+         MemoryConsumption::memory_consumption(weights);
+}
+
+
+
+// explicit instantiations
+template class CompiledAffineConstraints<double>;
+template class CompiledAffineConstraints<float>;
+
+template void
+CompiledAffineConstraints<double>::reinit(
+  const AffineConstraints<double> &,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &);
+template void
+CompiledAffineConstraints<double>::reinit(
+  const AffineConstraints<float> &,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &);
+template void
+CompiledAffineConstraints<float>::reinit(
+  const AffineConstraints<double> &,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &);
+template void
+CompiledAffineConstraints<float>::reinit(
+  const AffineConstraints<float> &,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &);
+
+DEAL_II_NAMESPACE_CLOSE
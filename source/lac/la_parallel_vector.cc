@@ -15,6 +15,10 @@
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/la_parallel_vector.templates.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 DEAL_II_NAMESPACE_OPEN
 
 #include "lac/la_parallel_vector.inst"
@@ -28,6 +32,137 @@ namespace LinearAlgebra
 {
   namespace distributed
   {
+    namespace
+    {
+      std::atomic<bool> use_shared_memory_ghost_exchange(true);
+    }
+
+
+
+    void
+    set_shared_memory_ghost_exchange(const bool enable)
+    {
+      use_shared_memory_ghost_exchange = enable;
+    }
+
+
+
+    bool
+    get_shared_memory_ghost_exchange()
+    {
+      return use_shared_memory_ghost_exchange;
+    }
+
+
+
+    namespace internal
+    {
+      std::shared_ptr<
+        const ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::Full>
+      get_shared_memory_ghost_exchanger(
+        const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+        const MPI_Comm                                            comm_sm)
+      {
+        using ExchangerType =
+          ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::Full;
+
+#ifdef DEAL_II_WITH_MPI
+        if (use_shared_memory_ghost_exchange == false ||
+            Utilities::MPI::job_supports_mpi() == false ||
+            partitioner->n_mpi_processes() == 1)
+          return nullptr;
+
+        // Setting up the exchanger involves collective communication, so
+        // we keep one object per partitioner and communicator. The entries of
+        // partitioners that have been destroyed in the meantime are removed
+        // upon the next call. Since vectors are set up collectively, all
+        // processes see the same entries in the cache.
+        struct CacheEntry
+        {
+          std::weak_ptr<const Utilities::MPI::Partitioner> partitioner;
+          MPI_Comm                                         comm_sm;
+          std::shared_ptr<const ExchangerType>             exchanger;
+        };
+        static std::mutex              cache_mutex;
+        static std::vector<CacheEntry> cache;
+
+        std::lock_guard<std::mutex> lock(cache_mutex);
+
+        cache.erase(std::remove_if(cache.begin(),
+                                   cache.end(),
+                                   [](const CacheEntry &entry) {
+                                     return entry.partitioner.expired();
+                                   }),
+                    cache.end());
+
+        for (const CacheEntry &entry : cache)
+          if (entry.partitioner.lock() == partitioner &&
+              entry.comm_sm == comm_sm)
+            return entry.exchanger;
+
+        // partitioners that only reserve space for ghost entries without
+        // knowing their global indices do not exchange data
+        const unsigned int ghost_indices_are_known =
+          (partitioner->ghost_indices().n_elements() ==
+           partitioner->n_ghost_indices()) ?
+            1 :
+            0;
+        if (Utilities::MPI::min(ghost_indices_are_known,
+                                partitioner->get_mpi_communicator()) == 0)
+          {
+            cache.push_back({partitioner, comm_sm, nullptr});
+            return nullptr;
+          }
+
+        const bool create_communicator = (comm_sm == MPI_COMM_SELF);
+        MPI_Comm   communicator_sm     = comm_sm;
+        if (create_communicator)
+          {
+            const int ierr =
+              MPI_Comm_split_type(partitioner->get_mpi_communicator(),
+                                  MPI_COMM_TYPE_SHARED,
+                                  partitioner->this_mpi_process(),
+                                  MPI_INFO_NULL,
+                                  &communicator_sm);
+            AssertThrowMPI(ierr);
+          }
+
+        std::shared_ptr<const ExchangerType> exchanger;
+        if (Utilities::MPI::n_mpi_processes(communicator_sm) > 1)
+          exchanger.reset(new ExchangerType(partitioner, communicator_sm),
+                          [communicator_sm, create_communicator](
+                            const ExchangerType *exchanger) mutable {
+                            delete exchanger;
+
+                            // the cache might only be destroyed at the end of
+                            // the program, after MPI has been finalized
+                            int finalized = 0;
+                            MPI_Finalized(&finalized);
+                            if (create_communicator && finalized == 0)
+                              {
+                                const int ierr =
+                                  MPI_Comm_free(&communicator_sm);
+                                AssertNothrow(ierr == MPI_SUCCESS,
+                                              ExcMPI(ierr));
+                              }
+                          });
+        else if (create_communicator)
+          Utilities::MPI::free_communicator(communicator_sm);
+
+        cache.push_back({partitioner, comm_sm, exchanger});
+
+        return exchanger;
+#else
+        (void)partitioner;
+        (void)comm_sm;
+
+        return std::shared_ptr<const ExchangerType>();
+#endif
+      }
+    } // namespace internal
+
+
+
 #define TEMPL_COPY_CONSTRUCTOR(S1, S2)               \
   template Vector<S1, ::dealii::MemorySpace::Host> & \
   Vector<S1, ::dealii::MemorySpace::Host>::operator= \
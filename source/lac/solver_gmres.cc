@@ -477,6 +477,72 @@ namespace internal
           output[j] = temp;
         }
     }
+
+
+
+    template <typename Number>
+    void
+    do_block_Tvmult_add(const unsigned int                 n_vectors,
+                        const unsigned int                 block_size,
+                        const std::size_t                  locally_owned_size,
+                        const std::vector<const Number *> &vectors,
+                        Vector<double>                    &products)
+    {
+      AssertDimension(vectors.size(), n_vectors + block_size);
+
+      static constexpr unsigned int n_lanes = VectorizedArray<double>::size();
+
+      // number of block vectors processed at once in registers
+      constexpr unsigned int n_block_batch = 8;
+
+      // This computes the inner products of all vectors with the block formed
+      // by the last 'block_size' vectors, which is a small dense
+      // matrix-matrix product. To read each of the (many) vectors only once
+      // from main memory, we work on chunks of the vector entries for which
+      // the entries of the block stay in cache.
+      constexpr std::size_t chunk_size = 256 * n_lanes;
+
+      const std::size_t regular_size = locally_owned_size / n_lanes * n_lanes;
+
+      const auto offset = [&](const unsigned int k) {
+        return k * n_vectors + k * (k + 1) / 2;
+      };
+
+      for (std::size_t begin = 0; begin < regular_size; begin += chunk_size)
+        {
+          const std::size_t end = std::min(begin + chunk_size, regular_size);
+          for (unsigned int i = 0; i < n_vectors + block_size; ++i)
+            for (unsigned int k_begin = (i < n_vectors ? 0 : i - n_vectors);
+                 k_begin < block_size;
+                 k_begin += n_block_batch)
+              {
+                const unsigned int k_end =
+                  std::min(k_begin + n_block_batch, block_size);
+                VectorizedArray<double> sums[n_block_batch] = {};
+                for (std::size_t j = begin; j < end; j += n_lanes)
+                  {
+                    VectorizedArray<double> v_ij;
+                    v_ij.load(vectors[i] + j);
+                    for (unsigned int k = k_begin; k < k_end; ++k)
+                      {
+                        VectorizedArray<double> w_kj;
+                        w_kj.load(vectors[n_vectors + k] + j);
+                        sums[k - k_begin] += v_ij * w_kj;
+                      }
+                  }
+                for (unsigned int k = k_begin; k < k_end; ++k)
+                  products(offset(k) + i) += sums[k - k_begin].sum();
+              }
+        }
+
+      for (std::size_t j = regular_size; j < locally_owned_size; ++j)
+        for (unsigned int k = 0; k < block_size; ++k)
+          {
+            const double w_kj = vectors[n_vectors + k][j];
+            for (unsigned int i = 0; i < n_vectors + k + 1; ++i)
+              products(offset(k) + i) += vectors[i][j] * w_kj;
+          }
+    }
   } // namespace SolverGMRESImplementation
 } // namespace internal
 
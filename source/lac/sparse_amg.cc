@@ -0,0 +1,688 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/sparse_amg.h>
+#include <deal.II/lac/sparsity_pattern_builder.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace SparseAMGImplementation
+  {
+    using size_type = types::global_dof_index;
+
+    /**
+     * Compute the strongly coupled neighbors of all unknowns of @p matrix in
+     * compressed row storage, i.e., the neighbors of unknown @p i are
+     * <code>columns[row_starts[i]]</code> to
+     * <code>columns[row_starts[i+1]-1]</code>.
+     */
+    void
+    compute_strong_couplings(const SparseMatrix<double> &matrix,
+                             const double                threshold,
+                             std::vector<size_type>     &row_starts,
+                             std::vector<size_type>     &columns)
+    {
+      const size_type n = matrix.m();
+
+      std::vector<double> diagonal(n);
+      parallel::apply_to_subranges(
+        size_type(0),
+        n,
+        [&](const size_type begin, const size_type end) {
+          for (size_type row = begin; row < end; ++row)
+            {
+              diagonal[row] = std::abs(matrix.diag_element(row));
+              AssertThrow(diagonal[row] > 0.,
+                          SparseAMG::ExcZeroDiagonal(row));
+            }
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+
+      // count the strong couplings of each row in a first pass, then fill
+      // them into the final arrays in a second one
+      const double threshold_square = threshold * threshold;
+      const auto   is_strong =
+        [&](const size_type row, const size_type column, const double value) {
+          return column != row &&
+                 value * value >
+                   threshold_square * diagonal[row] * diagonal[column];
+        };
+
+      row_starts.assign(n + 1, 0);
+      parallel::apply_to_subranges(
+        size_type(0),
+        n,
+        [&](const size_type begin, const size_type end) {
+          for (size_type row = begin; row < end; ++row)
+            for (auto entry = matrix.begin(row); entry != matrix.end(row);
+                 ++entry)
+              if (is_strong(row, entry->column(), entry->value()))
+                ++row_starts[row + 1];
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+      std::partial_sum(row_starts.begin(),
+                       row_starts.end(),
+                       row_starts.begin());
+
+      columns.resize(row_starts[n]);
+      parallel::apply_to_subranges(
+        size_type(0),
+        n,
+        [&](const size_type begin, const size_type end) {
+          for (size_type row = begin; row < end; ++row)
+            {
+              size_type index = row_starts[row];
+              for (auto entry = matrix.begin(row); entry != matrix.end(row);
+                   ++entry)
+                if (is_strong(row, entry->column(), entry->value()))
+                  columns[index++] = entry->column();
+            }
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    }
+
+
+
+    /**
+     * Group the unknowns into aggregates based on the strong couplings given
+     * in compressed row storage. Return the number of aggregates and fill
+     * @p aggregate with the aggregate of each unknown, or with
+     * numbers::invalid_dof_index for unknowns without strong couplings.
+     */
+    size_type
+    compute_aggregates(const std::vector<size_type> &row_starts,
+                       const std::vector<size_type> &columns,
+                       std::vector<size_type>       &aggregate)
+    {
+      const size_type n = row_starts.size() - 1;
+      aggregate.assign(n, numbers::invalid_dof_index);
+      size_type n_aggregates = 0;
+
+      // first pass: unknowns whose neighbors are all free form a new
+      // aggregate together with their neighbors
+      for (size_type i = 0; i < n; ++i)
+        if (row_starts[i + 1] > row_starts[i] &&
+            aggregate[i] == numbers::invalid_dof_index &&
+            std::all_of(columns.begin() + row_starts[i],
+                        columns.begin() + row_starts[i + 1],
+                        [&](const size_type j) {
+                          return aggregate[j] == numbers::invalid_dof_index;
+                        }))
+          {
+            aggregate[i] = n_aggregates;
+            for (size_type k = row_starts[i]; k < row_starts[i + 1]; ++k)
+              aggregate[columns[k]] = n_aggregates;
+            ++n_aggregates;
+          }
+
+      // second pass: the remaining unknowns join an aggregate of the first
+      // pass they are strongly coupled to
+      const std::vector<size_type> first_aggregate = aggregate;
+      for (size_type i = 0; i < n; ++i)
+        if (aggregate[i] == numbers::invalid_dof_index)
+          for (size_type k = row_starts[i]; k < row_starts[i + 1]; ++k)
+            if (first_aggregate[columns[k]] != numbers::invalid_dof_index)
+              {
+                aggregate[i] = first_aggregate[columns[k]];
+                break;
+              }
+
+      // third pass: all other unknowns with strong couplings form new
+      // aggregates with their free neighbors
+      for (size_type i = 0; i < n; ++i)
+        if (row_starts[i + 1] > row_starts[i] &&
+            aggregate[i] == numbers::invalid_dof_index)
+          {
+            aggregate[i] = n_aggregates;
+            for (size_type k = row_starts[i]; k < row_starts[i + 1]; ++k)
+              if (aggregate[columns[k]] == numbers::invalid_dof_index)
+                aggregate[columns[k]] = n_aggregates;
+            ++n_aggregates;
+          }
+
+      return n_aggregates;
+    }
+
+
+
+    /**
+     * Sort the given (column, value) pairs by column, sum up the values of
+     * equal columns, and add the result to row @p row of @p matrix.
+     */
+    void
+    add_row(const size_type                           row,
+            std::vector<std::pair<size_type, double>> &entries,
+            std::vector<size_type>                    &column_indices,
+            std::vector<double>                       &values,
+            SparseMatrix<double>                      &matrix)
+    {
+      std::sort(entries.begin(),
+                entries.end(),
+                [](const auto &a, const auto &b) { return a.first < b.first; });
+      column_indices.clear();
+      values.clear();
+      for (const auto &[column, value] : entries)
+        if (!column_indices.empty() && column_indices.back() == column)
+          values.back() += value;
+        else
+          {
+            column_indices.push_back(column);
+            values.push_back(value);
+          }
+      matrix.add(row,
+                 column_indices.size(),
+                 column_indices.data(),
+                 values.data(),
+                 false,
+                 true);
+    }
+
+
+
+    /**
+     * Compute the product $C = AB$ of two sparse matrices, including the
+     * sparsity pattern of the result. Both the sparsity pattern and the
+     * entries are computed in parallel over the rows of $C$.
+     */
+    void
+    multiply(const SparseMatrix<double> &A,
+             const SparseMatrix<double> &B,
+             SparsityPattern            &sparsity_pattern,
+             SparseMatrix<double>       &C)
+    {
+      AssertDimension(A.n(), B.m());
+
+      SparsityPatternBuilder builder(A.m(), B.n());
+      parallel::apply_to_subranges(
+        size_type(0),
+        A.m(),
+        [&](const size_type begin, const size_type end) {
+          std::vector<size_type> column_indices;
+          for (size_type row = begin; row < end; ++row)
+            {
+              column_indices.clear();
+              for (auto a = A.begin(row); a != A.end(row); ++a)
+                for (auto b = B.begin(a->column()); b != B.end(a->column());
+                     ++b)
+                  column_indices.push_back(b->column());
+              std::sort(column_indices.begin(), column_indices.end());
+              column_indices.erase(std::unique(column_indices.begin(),
+                                               column_indices.end()),
+                                   column_indices.end());
+              if (!column_indices.empty())
+                builder.add_row_entries(row,
+                                        make_array_view(column_indices),
+                                        true);
+            }
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+      builder.compress();
+
+      C.clear();
+      sparsity_pattern.copy_from(builder);
+      C.reinit(sparsity_pattern);
+
+      parallel::apply_to_subranges(
+        size_type(0),
+        A.m(),
+        [&](const size_type begin, const size_type end) {
+          std::vector<std::pair<size_type, double>> entries;
+          std::vector<size_type>                    column_indices;
+          std::vector<double>                       values;
+          for (size_type row = begin; row < end; ++row)
+            {
+              entries.clear();
+              for (auto a = A.begin(row); a != A.end(row); ++a)
+                for (auto b = B.begin(a->column()); b != B.end(a->column());
+                     ++b)
+                  entries.emplace_back(b->column(), a->value() * b->value());
+              add_row(row, entries, column_indices, values, C);
+            }
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    }
+
+
+
+    /**
+     * Compute the smoothed prolongator $P = (I - \omega D^{-1} A) T$ for the
+     * tentative prolongator $T$ that interpolates constants on the given
+     * aggregates, with columns scaled to unit length.
+     */
+    void
+    compute_prolongator(const SparseMatrix<double>   &A,
+                        const std::vector<size_type> &aggregate,
+                        const size_type               n_aggregates,
+                        const double                  omega,
+                        SparsityPattern              &sparsity_pattern,
+                        SparseMatrix<double>         &P)
+    {
+      const size_type n = A.m();
+
+      std::vector<unsigned int> aggregate_sizes(n_aggregates);
+      for (const size_type a : aggregate)
+        if (a != numbers::invalid_dof_index)
+          ++aggregate_sizes[a];
+      std::vector<double> tentative_values(n);
+      for (size_type i = 0; i < n; ++i)
+        if (aggregate[i] != numbers::invalid_dof_index)
+          tentative_values[i] = 1. / std::sqrt(aggregate_sizes[aggregate[i]]);
+
+      // without smoothing, every row has at most the single entry of the
+      // tentative prolongator, otherwise the entries of the rows of A
+      // collapse onto the aggregates of their columns
+      SparsityPatternBuilder builder(n, n_aggregates);
+      parallel::apply_to_subranges(
+        size_type(0),
+        n,
+        [&](const size_type begin, const size_type end) {
+          std::vector<size_type> column_indices;
+          for (size_type row = begin; row < end; ++row)
+            {
+              column_indices.clear();
+              if (aggregate[row] != numbers::invalid_dof_index)
+                column_indices.push_back(aggregate[row]);
+              if (omega != 0.)
+                for (auto a = A.begin(row); a != A.end(row); ++a)
+                  if (aggregate[a->column()] != numbers::invalid_dof_index)
+                    column_indices.push_back(aggregate[a->column()]);
+              std::sort(column_indices.begin(), column_indices.end());
+              column_indices.erase(std::unique(column_indices.begin(),
+                                               column_indices.end()),
+                                   column_indices.end());
+              if (!column_indices.empty())
+                builder.add_row_entries(row,
+                                        make_array_view(column_indices),
+                                        true);
+            }
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+      builder.compress();
+
+      P.clear();
+      sparsity_pattern.copy_from(builder);
+      P.reinit(sparsity_pattern);
+
+      parallel::apply_to_subranges(
+        size_type(0),
+        n,
+        [&](const size_type begin, const size_type end) {
+          std::vector<std::pair<size_type, double>> entries;
+          std::vector<size_type>                    column_indices;
+          std::vector<double>                       values;
+          for (size_type row = begin; row < end; ++row)
+            {
+              entries.clear();
+              if (aggregate[row] != numbers::invalid_dof_index)
+                entries.emplace_back(aggregate[row], tentative_values[row]);
+              if (omega != 0.)
+                {
+                  const double factor = -omega / A.diag_element(row);
+                  for (auto a = A.begin(row); a != A.end(row); ++a)
+                    if (aggregate[a->column()] != numbers::invalid_dof_index)
+                      entries.emplace_back(aggregate[a->column()],
+                                           factor * a->value() *
+                                             tentative_values[a->column()]);
+                }
+              add_row(row, entries, column_indices, values, P);
+            }
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    }
+
+
+
+    /**
+     * Compute the transpose of the matrix @p P, including its sparsity
+     * pattern.
+     */
+    void
+    transpose(const SparseMatrix<double> &P,
+              SparsityPattern            &sparsity_pattern,
+              SparseMatrix<double>       &R)
+    {
+      SparsityPatternBuilder builder(P.n(), P.m());
+      parallel::apply_to_subranges(
+        size_type(0),
+        P.m(),
+        [&](const size_type begin, const size_type end) {
+          for (size_type row = begin; row < end; ++row)
+            for (auto p = P.begin(row); p != P.end(row); ++p)
+              builder.add(p->column(), row);
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+      builder.compress();
+
+      R.clear();
+      sparsity_pattern.copy_from(builder);
+      R.reinit(sparsity_pattern);
+
+      // every entry of R is written by exactly one row of P
+      parallel::apply_to_subranges(
+        size_type(0),
+        P.m(),
+        [&](const size_type begin, const size_type end) {
+          for (size_type row = begin; row < end; ++row)
+            for (auto p = P.begin(row); p != P.end(row); ++p)
+              R.set(p->column(), row, p->value());
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    }
+
+
+
+    /**
+     * Return the inverse of the diagonal of @p matrix, as needed by the
+     * Chebyshev iteration.
+     */
+    std::shared_ptr<dealii::DiagonalMatrix<dealii::Vector<double>>>
+    compute_inverse_diagonal(const SparseMatrix<double> &matrix)
+    {
+      auto inverse_diagonal =
+        std::make_shared<dealii::DiagonalMatrix<dealii::Vector<double>>>();
+      inverse_diagonal->get_vector().reinit(matrix.m());
+      for (size_type i = 0; i < matrix.m(); ++i)
+        {
+          AssertThrow(matrix.diag_element(i) != 0.,
+                      SparseAMG::ExcZeroDiagonal(i));
+          inverse_diagonal->get_vector()(i) = 1. / matrix.diag_element(i);
+        }
+      return inverse_diagonal;
+    }
+  } // namespace SparseAMGImplementation
+} // namespace internal
+
+
+
+SparseAMG::AdditionalData::AdditionalData(
+  const double       aggregation_threshold,
+  const double       prolongator_damping,
+  const unsigned int smoother_degree,
+  const double       smoother_smoothing_range,
+  const unsigned int max_coarse_size,
+  const unsigned int max_levels,
+  const unsigned int n_cycles)
+  : aggregation_threshold(aggregation_threshold)
+  , prolongator_damping(prolongator_damping)
+  , smoother_degree(smoother_degree)
+  , smoother_smoothing_range(smoother_smoothing_range)
+  , max_coarse_size(max_coarse_size)
+  , max_levels(max_levels)
+  , n_cycles(n_cycles)
+{}
+
+
+
+void
+SparseAMG::initialize(const SparseMatrix<double> &matrix,
+                      const AdditionalData       &additional_data)
+{
+  using namespace internal::SparseAMGImplementation;
+
+  AssertDimension(matrix.m(), matrix.n());
+  Assert(additional_data.max_levels > 0,
+         ExcMessage("Need at least one level."));
+  Assert(additional_data.n_cycles > 0, ExcMessage("Need at least one cycle."));
+
+  clear();
+  fine_matrix = &matrix;
+  n_cycles    = additional_data.n_cycles;
+
+  std::vector<size_type> row_starts, columns, aggregate;
+  levels.push_back(std::make_unique<Level>());
+  for (unsigned int level = 0;; ++level)
+    {
+      const SparseMatrix<double> &A = level_matrix(level);
+      if (A.m() <= additional_data.max_coarse_size ||
+          level + 1 >= additional_data.max_levels)
+        break;
+
+      compute_strong_couplings(A,
+                               additional_data.aggregation_threshold,
+                               row_starts,
+                               columns);
+      const size_type n_aggregates =
+        compute_aggregates(row_starts, columns, aggregate);
+      if (n_aggregates == 0 || n_aggregates >= A.m())
+        break;
+
+      // set up the smoother, whose eigenvalue estimate also determines the
+      // damping of the prolongator
+      Level &fine = *levels[level];
+      {
+        SmootherType::AdditionalData smoother_data;
+        smoother_data.degree = additional_data.smoother_degree;
+        smoother_data.smoothing_range =
+          additional_data.smoother_smoothing_range;
+        smoother_data.preconditioner = compute_inverse_diagonal(A);
+        fine.smoother.initialize(A, smoother_data);
+      }
+      fine.residual.reinit(A.m());
+      const double max_eigenvalue =
+        fine.smoother.estimate_eigenvalues(fine.residual)
+          .max_eigenvalue_estimate;
+      const double omega =
+        additional_data.prolongator_damping * 4. / 3. / max_eigenvalue;
+
+      compute_prolongator(A,
+                          aggregate,
+                          n_aggregates,
+                          omega,
+                          fine.prolongation_sparsity,
+                          fine.prolongation);
+      transpose(fine.prolongation,
+                fine.restriction_sparsity,
+                fine.restriction);
+
+      // Galerkin product A_c = R (A P)
+      auto coarse = std::make_unique<Level>();
+      {
+        SparsityPattern      product_sparsity;
+        SparseMatrix<double> product;
+        multiply(A, fine.prolongation, product_sparsity, product);
+        multiply(fine.restriction,
+                 product,
+                 coarse->sparsity_pattern,
+                 coarse->matrix);
+      }
+      fine.coarse_rhs.reinit(n_aggregates);
+      fine.coarse_solution.reinit(n_aggregates);
+      levels.push_back(std::move(coarse));
+    }
+
+#ifdef DEAL_II_WITH_UMFPACK
+  coarse_solver = std::make_unique<SparseDirectUMFPACK>();
+  coarse_solver->initialize(level_matrix(levels.size() - 1));
+#else
+  // without a direct solver, use a Chebyshev iteration with the number of
+  // iterations determined from the eigenvalue estimates such that the error
+  // is reduced by ten orders of magnitude
+  {
+    const SparseMatrix<double> &A = level_matrix(levels.size() - 1);
+
+    SmootherType::AdditionalData coarse_data;
+    coarse_data.degree          = numbers::invalid_unsigned_int;
+    coarse_data.smoothing_range = 1e-10;
+    coarse_data.eig_cg_n_iterations =
+      std::min<unsigned int>(A.m(), 40);
+    coarse_data.preconditioner = compute_inverse_diagonal(A);
+    levels.back()->smoother.initialize(A, coarse_data);
+  }
+#endif
+}
+
+
+
+void
+SparseAMG::clear()
+{
+  coarse_solver.reset();
+  levels.clear();
+  fine_matrix = nullptr;
+  n_cycles    = 1;
+}
+
+
+
+void
+SparseAMG::vmult(Vector<double> &dst, const Vector<double> &src) const
+{
+  Assert(fine_matrix != nullptr, ExcNotInitialized());
+
+  v_cycle(0, dst, src);
+  if (n_cycles > 1)
+    {
+      Vector<double> residual(src.size()), correction(src.size());
+      for (unsigned int cycle = 1; cycle < n_cycles; ++cycle)
+        {
+          fine_matrix->residual(residual, dst, src);
+          v_cycle(0, correction, residual);
+          dst += correction;
+        }
+    }
+}
+
+
+
+void
+SparseAMG::Tvmult(Vector<double> &dst, const Vector<double> &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+void
+SparseAMG::v_cycle(const unsigned int    level,
+                   Vector<double>       &dst,
+                   const Vector<double> &src) const
+{
+  if (level + 1 == levels.size())
+    {
+#ifdef DEAL_II_WITH_UMFPACK
+      coarse_solver->vmult(dst, src);
+#else
+      levels[level]->smoother.vmult(dst, src);
+#endif
+      return;
+    }
+
+  const Level &fine = *levels[level];
+
+  fine.smoother.vmult(dst, src);
+  level_matrix(level).residual(fine.residual, dst, src);
+  fine.restriction.vmult(fine.coarse_rhs, fine.residual);
+  v_cycle(level + 1, fine.coarse_solution, fine.coarse_rhs);
+  fine.prolongation.vmult_add(dst, fine.coarse_solution);
+  fine.smoother.step(dst, src);
+}
+
+
+
+unsigned int
+SparseAMG::n_levels() const
+{
+  return levels.size();
+}
+
+
+
+const SparseMatrix<double> &
+SparseAMG::get_matrix(const unsigned int level) const
+{
+  AssertIndexRange(level, levels.size());
+  return level_matrix(level);
+}
+
+
+
+const SparseMatrix<double> &
+SparseAMG::get_prolongator(const unsigned int level) const
+{
+  Assert(level > 0, ExcMessage("There is no prolongator to level zero."));
+  AssertIndexRange(level, levels.size());
+  return levels[level - 1]->prolongation;
+}
+
+
+
+double
+SparseAMG::operator_complexity() const
+{
+  Assert(fine_matrix != nullptr, ExcNotInitialized());
+
+  std::size_t n_nonzero_elements = 0;
+  for (unsigned int level = 0; level < levels.size(); ++level)
+    n_nonzero_elements += level_matrix(level).n_nonzero_elements();
+  return static_cast<double>(n_nonzero_elements) /
+         fine_matrix->n_nonzero_elements();
+}
+
+
+
+SparseAMG::size_type
+SparseAMG::m() const
+{
+  Assert(fine_matrix != nullptr, ExcNotInitialized());
+  return fine_matrix->m();
+}
+
+
+
+SparseAMG::size_type
+SparseAMG::n() const
+{
+  Assert(fine_matrix != nullptr, ExcNotInitialized());
+  return fine_matrix->n();
+}
+
+
+
+std::size_t
+SparseAMG::memory_consumption() const
+{
+  std::size_t memory = sizeof(*this);
+  for (const auto &level : levels)
+    memory += level->sparsity_pattern.memory_consumption() +
+              level->matrix.memory_consumption() +
+              level->prolongation_sparsity.memory_consumption() +
+              level->prolongation.memory_consumption() +
+              level->restriction_sparsity.memory_consumption() +
+              level->restriction.memory_consumption() +
+              level->residual.memory_consumption() +
+              level->coarse_rhs.memory_consumption() +
+              level->coarse_solution.memory_consumption();
+  return memory;
+}
+
+
+
+const SparseMatrix<double> &
+SparseAMG::level_matrix(const unsigned int level) const
+{
+  return level == 0 ? *fine_matrix : levels[level]->matrix;
+}
+
+DEAL_II_NAMESPACE_CLOSE
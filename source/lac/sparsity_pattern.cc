@@ -13,11 +13,13 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern_builder.h>
 #include <deal.II/lac/sparsity_tools.h>
 
 #include <algorithm>
@@ -539,6 +541,121 @@ SparsityPattern::copy_from(const DynamicSparsityPattern &dsp)
 
 
 
+void
+SparsityPattern::copy_from(const SparsityPatternBuilder &builder)
+{
+  Assert(builder.is_compressed(), SparsityPatternBuilder::ExcNotCompressed());
+
+  const bool do_diag_optimize = (builder.n_rows() == builder.n_cols());
+
+  // As in the function above, rows that are not stored in the builder still
+  // get one entry for the "diagonal optimization".
+  std::vector<unsigned int> row_lengths(builder.n_rows());
+  parallel::apply_to_subranges(
+    size_type(0),
+    builder.n_rows(),
+    [&](const size_type begin, const size_type end) {
+      for (size_type row = begin; row < end; ++row)
+        {
+          row_lengths[row] = builder.row_length(row);
+          if (do_diag_optimize && !builder.exists(row, row))
+            ++row_lengths[row];
+        }
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+
+  reinit(builder.n_rows(), builder.n_cols(), row_lengths);
+
+  if (n_rows() != 0 && n_cols() != 0)
+    parallel::apply_to_subranges(
+      size_type(0),
+      builder.n_rows(),
+      [&](const size_type begin, const size_type end) {
+        for (size_type row = begin; row < end; ++row)
+          {
+            size_type *cols =
+              &colnums[rowstart[row]] + (do_diag_optimize ? 1 : 0);
+            for (const size_type col : builder.column_indices(row))
+              if ((col != row) || !do_diag_optimize)
+                *cols++ = col;
+          }
+      },
+      internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+
+  compressed = true;
+}
+
+
+
+void
+SparsityPattern::build_in_row_chunks(
+  const size_type                                   n_rows,
+  const size_type                                   n_cols,
+  const std::function<void(SparsityPatternBase &)> &generator,
+  const unsigned int                                n_row_chunks)
+{
+  Assert(n_row_chunks > 0, ExcMessage("At least one chunk of rows is needed."));
+
+  const bool      do_diag_optimize = (n_rows == n_cols);
+  const size_type chunk_size = (n_rows + n_row_chunks - 1) / n_row_chunks;
+
+  // Create a DynamicSparsityPattern that only stores the rows of the given
+  // chunk and let the generator fill it.
+  const auto generate_chunk = [&](const unsigned int chunk) {
+    const size_type begin = std::min<size_type>(chunk * chunk_size, n_rows);
+    const size_type end   = std::min<size_type>(begin + chunk_size, n_rows);
+    IndexSet        rowset(n_rows);
+    rowset.add_range(begin, end);
+    auto dsp = std::make_unique<DynamicSparsityPattern>(n_rows, n_cols, rowset);
+    generator(*dsp);
+    return std::make_tuple(begin, end, std::move(dsp));
+  };
+
+  // First pass: determine the number of entries in each row, including the
+  // diagonal entry that is always stored for square matrices.
+  std::vector<unsigned int> row_lengths(n_rows, do_diag_optimize ? 1 : 0);
+  for (unsigned int chunk = 0; chunk < n_row_chunks; ++chunk)
+    {
+      const auto [begin, end, dsp] = generate_chunk(chunk);
+      for (size_type row = begin; row < end; ++row)
+        row_lengths[row] = dsp->row_length(row) +
+                           ((do_diag_optimize && !dsp->exists(row, row)) ? 1 :
+                                                                           0);
+    }
+
+  reinit(n_rows, n_cols, row_lengths);
+
+  // Second pass: generate the entries again and copy them into their final
+  // place.
+  if (n_rows != 0 && n_cols != 0)
+    for (unsigned int chunk = 0; chunk < n_row_chunks; ++chunk)
+      {
+        const auto [begin, end, dsp] = generate_chunk(chunk);
+        for (size_type row = begin; row < end; ++row)
+          {
+            Assert(row_lengths[row] ==
+                     dsp->row_length(row) +
+                       ((do_diag_optimize && !dsp->exists(row, row)) ? 1 : 0),
+                   ExcMessage("The generator function did not add the same "
+                              "entries in both passes."));
+
+            size_type *cols =
+              &colnums[rowstart[row]] + (do_diag_optimize ? 1 : 0);
+            const unsigned int row_length = dsp->row_length(row);
+            for (unsigned int index = 0; index < row_length; ++index)
+              {
+                const size_type col = dsp->column_number(row, index);
+                if ((col != row) || !do_diag_optimize)
+                  *cols++ = col;
+              }
+          }
+      }
+
+  compressed = true;
+}
+
+
+
 template <typename number>
 void
 SparsityPattern::copy_from(const FullMatrix<number> &matrix)
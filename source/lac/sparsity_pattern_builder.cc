@@ -0,0 +1,295 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/sparsity_pattern_builder.h>
+
+#include <algorithm>
+#include <numeric>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+
+SparsityPatternBuilder::SparsityPatternBuilder()
+  : compressed(false)
+{}
+
+
+
+SparsityPatternBuilder::SparsityPatternBuilder(const size_type m,
+                                               const size_type n,
+                                               const IndexSet &rowset)
+  : compressed(false)
+{
+  reinit(m, n, rowset);
+}
+
+
+
+void
+SparsityPatternBuilder::reinit(const size_type m,
+                               const size_type n,
+                               const IndexSet &rowset)
+{
+  AssertIndexRange(rowset.size(), m + 1);
+
+  resize(m, n);
+  this->rowset = rowset;
+
+  thread_buffer.clear();
+  all_buffers.clear();
+
+  compressed = false;
+  rowstart.clear();
+  colnums.clear();
+}
+
+
+
+void
+SparsityPatternBuilder::add_row_entries(
+  const size_type                  &row,
+  const ArrayView<const size_type> &columns,
+  const bool /*indices_are_sorted*/)
+{
+  AssertIndexRange(row, rows);
+  Assert(compressed == false, ExcCompressed());
+
+  if (rowset.size() > 0 && !rowset.is_element(row))
+    return;
+
+  ThreadBuffer &buffer = get_thread_buffer();
+  for (const size_type column : columns)
+    {
+      AssertIndexRange(column, cols);
+      buffer.entries.emplace_back(row, column);
+    }
+  compact_if_necessary(buffer);
+}
+
+
+
+void
+SparsityPatternBuilder::add_entries(
+  const ArrayView<const std::pair<size_type, size_type>> &entries)
+{
+  Assert(compressed == false, ExcCompressed());
+
+  ThreadBuffer &buffer = get_thread_buffer();
+  for (const auto &entry : entries)
+    {
+      AssertIndexRange(entry.first, rows);
+      AssertIndexRange(entry.second, cols);
+      if (rowset.size() == 0 || rowset.is_element(entry.first))
+        buffer.entries.push_back(entry);
+    }
+  compact_if_necessary(buffer);
+}
+
+
+
+void
+SparsityPatternBuilder::compact_if_necessary(ThreadBuffer &buffer)
+{
+  // Finite element discretizations add every entry once for each cell that
+  // shares the two degrees of freedom, so the raw buffer would be many times
+  // larger than the final pattern. Removing the duplicates whenever the size
+  // has doubled keeps the memory proportional to the number of distinct
+  // entries, while the cost of sorting stays proportional to the number of
+  // added entries times a logarithmic factor. The minimal size avoids
+  // sorting tiny buffers over and over again.
+  const std::size_t minimal_size = 4096;
+  if (buffer.entries.size() <
+      std::max(2 * buffer.n_unique_entries, minimal_size))
+    return;
+
+  std::sort(buffer.entries.begin(), buffer.entries.end());
+  buffer.entries.erase(std::unique(buffer.entries.begin(),
+                                   buffer.entries.end()),
+                       buffer.entries.end());
+  buffer.n_unique_entries = buffer.entries.size();
+}
+
+
+
+void
+SparsityPatternBuilder::compress()
+{
+  if (compressed)
+    return;
+
+  // Step 1: sort the buffer of each thread and remove duplicates. Each
+  // buffer is processed by one task.
+  parallel::apply_to_subranges(
+    std::size_t(0),
+    all_buffers.size(),
+    [this](const std::size_t begin, const std::size_t end) {
+      for (std::size_t b = begin; b < end; ++b)
+        {
+          auto &entries = all_buffers[b]->entries;
+          std::sort(entries.begin(), entries.end());
+          entries.erase(std::unique(entries.begin(), entries.end()),
+                        entries.end());
+        }
+    },
+    1);
+
+  // Step 2: split the stored rows into chunks and merge the entries of all
+  // buffers in each chunk into a chunk-local list of column indices. Since
+  // the buffers are sorted, the entries of a chunk form a contiguous range
+  // in each buffer that we find by binary search.
+  const size_type n_local_rows =
+    (rowset.size() == 0 ? rows : rowset.n_elements());
+  const auto global_row = [this](const size_type local_index) {
+    return (rowset.size() == 0 ? local_index :
+                                 rowset.nth_index_in_set(local_index));
+  };
+
+  const unsigned int n_chunks = std::max<size_type>(
+    1,
+    std::min<size_type>(n_local_rows / 256, 8 * MultithreadInfo::n_threads()));
+  const size_type chunk_size = (n_local_rows + n_chunks - 1) / n_chunks;
+
+  std::vector<unsigned int>           row_lengths(n_local_rows);
+  std::vector<std::vector<size_type>> chunk_colnums(n_chunks);
+
+  parallel::apply_to_subranges(
+    0U,
+    n_chunks,
+    [&](const unsigned int chunk_begin, const unsigned int chunk_end) {
+      using Iterator =
+        std::vector<std::pair<size_type, size_type>>::const_iterator;
+      std::vector<std::pair<Iterator, Iterator>> ranges(all_buffers.size());
+      std::vector<size_type>                     row_entries;
+
+      for (unsigned int chunk = chunk_begin; chunk < chunk_end; ++chunk)
+        {
+          const size_type begin = std::min(chunk * chunk_size, n_local_rows);
+          const size_type end = std::min(begin + chunk_size, n_local_rows);
+          if (begin == end)
+            continue;
+
+          const size_type first_row = global_row(begin);
+          for (unsigned int b = 0; b < all_buffers.size(); ++b)
+            {
+              const auto &entries = all_buffers[b]->entries;
+              ranges[b].first     = std::lower_bound(
+                entries.begin(),
+                entries.end(),
+                std::make_pair(first_row, size_type(0)));
+              ranges[b].second =
+                (end == n_local_rows ?
+                   entries.end() :
+                   std::lower_bound(ranges[b].first,
+                                    entries.end(),
+                                    std::make_pair(global_row(end),
+                                                   size_type(0))));
+            }
+
+          std::vector<size_type> &columns = chunk_colnums[chunk];
+          for (size_type local_index = begin; local_index < end; ++local_index)
+            {
+              const size_type row = global_row(local_index);
+              row_entries.clear();
+              for (auto &range : ranges)
+                for (; range.first != range.second && range.first->first == row;
+                     ++range.first)
+                  row_entries.push_back(range.first->second);
+
+              // The entries of each buffer are already sorted and unique, so
+              // only rows that got entries from more than one thread need to
+              // be sorted again.
+              std::sort(row_entries.begin(), row_entries.end());
+              row_entries.erase(std::unique(row_entries.begin(),
+                                            row_entries.end()),
+                                row_entries.end());
+
+              row_lengths[local_index] = row_entries.size();
+              columns.insert(columns.end(),
+                             row_entries.begin(),
+                             row_entries.end());
+            }
+        }
+    },
+    1);
+
+  // The entries have been merged, so we can release the memory of the
+  // buffers before allocating the final arrays.
+  thread_buffer.clear();
+  all_buffers.clear();
+
+  // Step 3: compute the row starts and copy the chunks into their final
+  // position.
+  rowstart.resize(n_local_rows + 1);
+  rowstart[0] = 0;
+  for (size_type i = 0; i < n_local_rows; ++i)
+    rowstart[i + 1] = rowstart[i] + row_lengths[i];
+  colnums.resize(rowstart.back());
+
+  parallel::apply_to_subranges(
+    0U,
+    n_chunks,
+    [&](const unsigned int chunk_begin, const unsigned int chunk_end) {
+      for (unsigned int chunk = chunk_begin; chunk < chunk_end; ++chunk)
+        {
+          const size_type begin = std::min(chunk * chunk_size, n_local_rows);
+          std::copy(chunk_colnums[chunk].begin(),
+                    chunk_colnums[chunk].end(),
+                    colnums.begin() + rowstart[begin]);
+          std::vector<size_type>().swap(chunk_colnums[chunk]);
+        }
+    },
+    1);
+
+  compressed = true;
+}
+
+
+
+bool
+SparsityPatternBuilder::exists(const size_type i, const size_type j) const
+{
+  const ArrayView<const size_type> columns = column_indices(i);
+  return std::binary_search(columns.begin(), columns.end(), j);
+}
+
+
+
+std::size_t
+SparsityPatternBuilder::n_nonzero_elements() const
+{
+  Assert(compressed, ExcNotCompressed());
+  return colnums.size();
+}
+
+
+
+std::size_t
+SparsityPatternBuilder::memory_consumption() const
+{
+  std::size_t memory = sizeof(*this) + rowset.memory_consumption() +
+                       MemoryConsumption::memory_consumption(rowstart) +
+                       MemoryConsumption::memory_consumption(colnums);
+  for (const auto &buffer : all_buffers)
+    memory += sizeof(ThreadBuffer) +
+              buffer->entries.capacity() *
+                sizeof(std::pair<size_type, size_type>);
+  return memory;
+}
+
+DEAL_II_NAMESPACE_CLOSE
@@ -0,0 +1,167 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/matrix_free/auto_tuning.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace MatrixFreeTools
+{
+  namespace
+  {
+    /**
+     * Return the model name of the processor as listed in /proc/cpuinfo, with
+     * white space replaced by underscores, or "unknown" if that file is not
+     * available.
+     */
+    std::string
+    get_cpu_model_name()
+    {
+      std::string   model_name = "unknown";
+      std::ifstream cpuinfo("/proc/cpuinfo");
+      std::string   line;
+      while (std::getline(cpuinfo, line))
+        if (line.rfind("model name", 0) == 0)
+          {
+            const std::size_t colon = line.find(':');
+            if (colon != std::string::npos)
+              model_name = Utilities::trim(line.substr(colon + 1));
+            break;
+          }
+
+      std::replace_if(
+        model_name.begin(),
+        model_name.end(),
+        [](const char c) { return std::isspace(c) != 0; },
+        '_');
+      return model_name;
+    }
+  } // namespace
+
+
+
+  AutoTuningCache::AutoTuningCache(const std::string &filename)
+  {
+    load(filename);
+  }
+
+
+
+  void
+  AutoTuningCache::load(const std::string &filename)
+  {
+    std::ifstream file(filename);
+    std::string   line;
+    while (std::getline(file, line))
+      {
+        if (Utilities::trim(line).empty())
+          continue;
+
+        std::istringstream stream(line);
+        std::string        key;
+        Settings           settings;
+        stream >> key >> settings.tasks_parallel_scheme >>
+          settings.tasks_block_size >>
+          settings.overlap_communication_computation >>
+          settings.fuse_cell_and_face_loops >>
+          settings.compute_jacobians_on_the_fly >> settings.time;
+        AssertThrow(!stream.fail(), ExcInvalidCacheEntry(filename, line));
+
+        entries[key] = settings;
+      }
+  }
+
+
+
+  void
+  AutoTuningCache::save(const std::string &filename) const
+  {
+    std::ofstream file(filename);
+    AssertThrow(file.good(), ExcIO());
+
+    file.precision(6);
+    for (const auto &[key, settings] : entries)
+      file << key << ' ' << settings.tasks_parallel_scheme << ' '
+           << settings.tasks_block_size << ' '
+           << settings.overlap_communication_computation << ' '
+           << settings.fuse_cell_and_face_loops << ' '
+           << settings.compute_jacobians_on_the_fly << ' ' << settings.time
+           << '\n';
+  }
+
+
+
+  std::optional<AutoTuningCache::Settings>
+  AutoTuningCache::find(const std::string &key) const
+  {
+    const auto entry = entries.find(key);
+    if (entry == entries.end())
+      return {};
+    else
+      return entry->second;
+  }
+
+
+
+  void
+  AutoTuningCache::insert(const std::string &key, const Settings &settings)
+  {
+    entries[key] = settings;
+  }
+
+
+
+  std::size_t
+  AutoTuningCache::size() const
+  {
+    return entries.size();
+  }
+
+
+
+  std::string
+  AutoTuningCache::create_key(const unsigned int            dim,
+                              const unsigned int            degree,
+                              const types::global_dof_index n_dofs,
+                              const unsigned int            n_lanes,
+                              const unsigned int            bytes_per_number,
+                              const unsigned int            n_mpi_processes)
+  {
+    // problems of similar size behave similarly, so only store the position
+    // of the highest bit of the number of unknowns
+    unsigned int log2_n_dofs = 0;
+    for (types::global_dof_index n = n_dofs; n > 1; n /= 2)
+      ++log2_n_dofs;
+
+    static const std::string cpu_model_name = get_cpu_model_name();
+
+    std::ostringstream key;
+    key << cpu_model_name << "/threads" << MultithreadInfo::n_threads()
+        << "/ranks" << n_mpi_processes << "/dim" << dim << "/degree" << degree
+        << "/dofs2^" << log2_n_dofs << "/lanes" << n_lanes << "/bytes"
+        << bytes_per_number;
+    return key.str();
+  }
+} // namespace MatrixFreeTools
+
+DEAL_II_NAMESPACE_CLOSE
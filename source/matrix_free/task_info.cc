@@ -35,6 +35,8 @@
 #  endif
 #endif
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <set>
 
@@ -618,18 +620,48 @@ namespace internal
                   funct.cell_loop_pre_range(i);
                   funct.zero_dst_vector_range(i);
                   AssertIndexRange(i + 1, cell_partition_data.size());
-                  if (cell_partition_data[i + 1] > cell_partition_data[i])
+                  if (fused_partition_data_ptr.empty() == false &&
+                      funct.has_face_work())
                     {
-                      funct.cell(i);
+                      // Run the face integrals in small steps right after
+                      // the cells they are attached to, in order to find the
+                      // vector entries of these cells still in caches
+                      AssertIndexRange(i + 1, fused_partition_data_ptr.size());
+                      std::array<unsigned int, 3> begin = {
+                        {cell_partition_data[i],
+                         face_partition_data[i],
+                         boundary_partition_data[i]}};
+                      for (unsigned int step = fused_partition_data_ptr[i];
+                           step < fused_partition_data_ptr[i + 1];
+                           ++step)
+                        {
+                          const unsigned int *end =
+                            fused_partition_data.data() + 3 * step;
+                          if (end[0] > begin[0])
+                            funct.cell(std::make_pair(begin[0], end[0]));
+                          if (end[1] > begin[1])
+                            funct.face(std::make_pair(begin[1], end[1]));
+                          if (end[2] > begin[2])
+                            funct.boundary(std::make_pair(begin[2], end[2]));
+                          std::copy(end, end + 3, begin.begin());
+                        }
                     }
-
-                  if (face_partition_data.empty() == false)
+                  else
                     {
-                      if (face_partition_data[i + 1] > face_partition_data[i])
-                        funct.face(i);
-                      if (boundary_partition_data[i + 1] >
-                          boundary_partition_data[i])
-                        funct.boundary(i);
+                      if (cell_partition_data[i + 1] > cell_partition_data[i])
+                        {
+                          funct.cell(i);
+                        }
+
+                      if (face_partition_data.empty() == false)
+                        {
+                          if (face_partition_data[i + 1] >
+                              face_partition_data[i])
+                            funct.face(i);
+                          if (boundary_partition_data[i + 1] >
+                              boundary_partition_data[i])
+                            funct.boundary(i);
+                        }
                     }
                   funct.cell_loop_post_range(i);
                 }
@@ -670,6 +702,8 @@ namespace internal
       cell_partition_data.clear();
       face_partition_data.clear();
       boundary_partition_data.clear();
+      fused_partition_data_ptr.clear();
+      fused_partition_data.clear();
       evens             = 0;
       odds              = 0;
       n_blocked_workers = 0;
@@ -710,6 +744,8 @@ namespace internal
         MemoryConsumption::memory_consumption(cell_partition_data) +
         MemoryConsumption::memory_consumption(face_partition_data) +
         MemoryConsumption::memory_consumption(boundary_partition_data) +
+        MemoryConsumption::memory_consumption(fused_partition_data_ptr) +
+        MemoryConsumption::memory_consumption(fused_partition_data) +
         MemoryConsumption::memory_consumption(partition_evens) +
         MemoryConsumption::memory_consumption(partition_odds) +
         MemoryConsumption::memory_consumption(partition_n_blocked_workers) +
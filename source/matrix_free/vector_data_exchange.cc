@@ -1360,6 +1360,65 @@ namespace internal
 
 
 
+      void
+      Full::finish_shared_memory_access(
+        const VectorOperation::values vector_operation,
+        const unsigned int            communication_channel) const
+      {
+#ifndef DEAL_II_WITH_MPI
+        Assert(false, ExcNeedsMPI());
+
+        (void)vector_operation;
+        (void)communication_channel;
+#else
+        // in export_to_ghosted_array_finish(), a process reads from the
+        // owners of its ghost entries, and in
+        // import_from_ghosted_array_finish(), it reads from the processes
+        // that hold its locally owned entries as ghosts
+        const bool export_direction =
+          (vector_operation == VectorOperation::insert);
+        const std::vector<unsigned int> &accessed_ranks =
+          export_direction ? sm_ghost_ranks : sm_import_ranks;
+        const std::vector<unsigned int> &accessing_ranks =
+          export_direction ? sm_import_ranks : sm_ghost_ranks;
+
+        std::vector<MPI_Request> requests(accessing_ranks.size() +
+                                          accessed_ranks.size());
+
+        int dummy;
+        for (unsigned int i = 0; i < accessing_ranks.size(); ++i)
+          {
+            const int ierr = MPI_Irecv(&dummy,
+                                       0,
+                                       MPI_INT,
+                                       accessing_ranks[i],
+                                       communication_channel,
+                                       comm_sm,
+                                       requests.data() + i);
+            AssertThrowMPI(ierr);
+          }
+
+        for (unsigned int i = 0; i < accessed_ranks.size(); ++i)
+          {
+            const int ierr =
+              MPI_Isend(&dummy,
+                        0,
+                        MPI_INT,
+                        accessed_ranks[i],
+                        communication_channel,
+                        comm_sm,
+                        requests.data() + accessing_ranks.size() + i);
+            AssertThrowMPI(ierr);
+          }
+
+        const int ierr =
+          MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        AssertThrowMPI(ierr);
+#endif
+      }
+
+
+
       void
       Full::reset_ghost_values(const ArrayView<double> &ghost_array) const
       {
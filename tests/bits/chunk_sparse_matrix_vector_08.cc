@@ -0,0 +1,97 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check ChunkSparseMatrix::vmult, Tvmult and residual for the chunk sizes
+// that use specialized kernels, both for matrix sizes that are a multiple
+// of the chunk size and ones that are not
+
+#include <deal.II/lac/chunk_sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+void
+test(const unsigned int chunk_size, const unsigned int size)
+{
+  // set up a tridiagonal sparsity pattern plus one entry in the last column
+  // of each row to also exercise the padded chunk column
+  ChunkSparsityPattern sp(size, size, 4, chunk_size);
+  for (unsigned int i = 0; i < size; ++i)
+    {
+      for (unsigned int j = (i > 0 ? i - 1 : 0); j < std::min(size, i + 2);
+           ++j)
+        sp.add(i, j);
+      sp.add(i, size - 1);
+    }
+  sp.compress();
+
+  ChunkSparseMatrix<double> m(sp);
+  for (unsigned int i = 0; i < size; ++i)
+    {
+      for (unsigned int j = (i > 0 ? i - 1 : 0); j < std::min(size, i + 2);
+           ++j)
+        m.set(i, j, i + 2 * j + 1);
+      m.set(i, size - 1, i + 2 * (size - 1) + 1);
+    }
+
+  Vector<double> v(size), w(size), b(size);
+  for (unsigned int i = 0; i < size; ++i)
+    {
+      v(i) = i + 1;
+      b(i) = 2 * i;
+    }
+
+  // compute the reference result entry by entry with exact integer
+  // arithmetic
+  const auto check = [&](const bool transpose, const Vector<double> &result) {
+    for (unsigned int i = 0; i < size; ++i)
+      {
+        double reference = 0;
+        for (unsigned int j = 0; j < size; ++j)
+          reference += (transpose ? m.el(j, i) : m.el(i, j)) * v(j);
+        AssertThrow(result(i) == reference, ExcInternalError());
+      }
+  };
+
+  m.vmult(w, v);
+  check(false, w);
+
+  m.Tvmult(w, v);
+  check(true, w);
+
+  // residual() computes b - Mv, so transform back to Mv before the check
+  const double norm = m.residual(w, v, b);
+  AssertThrow(norm == w.l2_norm(), ExcInternalError());
+  w -= b;
+  w *= -1.;
+  check(false, w);
+
+  deallog << "chunk_size=" << chunk_size << " size=" << size << " OK"
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (const unsigned int chunk_size : {2, 3, 4, 6, 8})
+    for (const unsigned int size : {48, 50, 101})
+      test(chunk_size, size);
+}
@@ -0,0 +1,84 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test DoFTools::suggest_chunk_size() and check that a ChunkSparsityPattern
+// built with the suggested chunk size does not contain padding entries
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/chunk_sparsity_pattern.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+check(const Triangulation<dim> &tria, const FiniteElement<dim> &fe)
+{
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const unsigned int chunk_size = DoFTools::suggest_chunk_size(dof_handler);
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+
+  ChunkSparsityPattern csp;
+  csp.copy_from(dsp, chunk_size);
+
+  deallog << fe.get_name() << ": n_dofs=" << dof_handler.n_dofs()
+          << " chunk_size=" << chunk_size << " no padding: "
+          << (csp.n_nonzero_elements() == dsp.n_nonzero_elements())
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+
+  check(tria, FE_Q<dim>(1));
+  check(tria, FESystem<dim>(FE_Q<dim>(2), dim));
+  check(tria, FESystem<dim>(FE_Q<dim>(3), dim));
+  check(tria, FESystem<dim>(FE_Q<dim>(2), dim, FE_Q<dim>(1), 1));
+  check(tria, FESystem<dim>(FE_DGQ<dim>(1), 3));
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
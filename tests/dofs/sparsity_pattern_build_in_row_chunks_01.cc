@@ -0,0 +1,102 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that SparsityPattern::build_in_row_chunks() creates the same pattern
+// as going through a DynamicSparsityPattern, for the regular and the flux
+// sparsity pattern with hanging node constraints and different numbers of
+// chunks.
+
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+check()
+{
+  Triangulation<dim> tr;
+  GridGenerator::hyper_cube(tr, -1, 1);
+  tr.refine_global(2);
+  tr.begin_active()->set_refine_flag();
+  tr.execute_coarsening_and_refinement();
+
+  FESystem<dim>   element(FE_Q<dim>(2), 1, FE_DGQ<dim>(1), 1);
+  DoFHandler<dim> dof(tr);
+  dof.distribute_dofs(element);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof, constraints);
+  constraints.close();
+
+  const std::function<void(SparsityPatternBase &)> generators[2] = {
+    [&](SparsityPatternBase &dsp) {
+      DoFTools::make_sparsity_pattern(dof, dsp, constraints, false);
+    },
+    [&](SparsityPatternBase &dsp) {
+      DoFTools::make_flux_sparsity_pattern(dof, dsp, constraints, true);
+    }};
+
+  for (unsigned int g = 0; g < 2; ++g)
+    {
+      DynamicSparsityPattern dsp(dof.n_dofs());
+      generators[g](dsp);
+      SparsityPattern sparsity_1;
+      sparsity_1.copy_from(dsp);
+
+      for (const unsigned int n_row_chunks : {1U, 3U, 7U})
+        {
+          SparsityPattern sparsity_2;
+          sparsity_2.build_in_row_chunks(dof.n_dofs(),
+                                         dof.n_dofs(),
+                                         generators[g],
+                                         n_row_chunks);
+
+          deallog << (g == 0 ? "Cell" : "Flux")
+                  << " pattern with n_row_chunks=" << n_row_chunks << " -- "
+                  << (sparsity_1 == sparsity_2 ? "ok" : "failed")
+                  << std::endl;
+        }
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  check<2>();
+  deallog.pop();
+  deallog.push("3d");
+  check<3>();
+  deallog.pop();
+}
@@ -0,0 +1,119 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that DoFTools::make_sparsity_pattern() creates the same pattern when
+// filling a SparsityPatternBuilder in parallel as when filling a
+// DynamicSparsityPattern, with and without keeping constrained entries and
+// when only a subset of the rows is stored.
+
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern_builder.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+check()
+{
+  Triangulation<dim> tr;
+  GridGenerator::hyper_cube(tr, -1, 1);
+  tr.refine_global(2);
+  tr.begin_active()->set_refine_flag();
+  tr.execute_coarsening_and_refinement();
+
+  FESystem<dim>   element(FE_Q<dim>(1), 1, FE_Q<dim>(2), 1);
+  DoFHandler<dim> dof(tr);
+  dof.distribute_dofs(element);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof, constraints);
+  constraints.close();
+
+  for (const bool keep_constrained_dofs : {true, false})
+    {
+      SparsityPattern        sparsity_1;
+      DynamicSparsityPattern dsp(dof.n_dofs());
+      DoFTools::make_sparsity_pattern(dof,
+                                      dsp,
+                                      constraints,
+                                      keep_constrained_dofs);
+      sparsity_1.copy_from(dsp);
+
+      SparsityPattern        sparsity_2;
+      SparsityPatternBuilder builder(dof.n_dofs(), dof.n_dofs());
+      DoFTools::make_sparsity_pattern(dof,
+                                      builder,
+                                      constraints,
+                                      keep_constrained_dofs);
+      builder.compress();
+      sparsity_2.copy_from(builder);
+
+      deallog << "keep_constrained_dofs=" << keep_constrained_dofs << " -- "
+              << (sparsity_1 == sparsity_2 &&
+                      builder.n_nonzero_elements() ==
+                        sparsity_1.n_nonzero_elements() ?
+                    "ok" :
+                    "failed")
+              << std::endl;
+    }
+
+  // store only the second half of the rows
+  IndexSet rows(dof.n_dofs());
+  rows.add_range(dof.n_dofs() / 2, dof.n_dofs());
+
+  DynamicSparsityPattern dsp(dof.n_dofs(), dof.n_dofs(), rows);
+  DoFTools::make_sparsity_pattern(dof, dsp, constraints);
+  SparsityPattern sparsity_1;
+  sparsity_1.copy_from(dsp);
+
+  SparsityPatternBuilder builder(dof.n_dofs(), dof.n_dofs(), rows);
+  DoFTools::make_sparsity_pattern(dof, builder, constraints);
+  builder.compress();
+  SparsityPattern sparsity_2;
+  sparsity_2.copy_from(builder);
+
+  deallog << "Subset of rows"
+          << " -- " << (sparsity_1 == sparsity_2 ? "ok" : "failed")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  check<2>();
+  deallog.pop();
+  deallog.push("3d");
+  check<3>();
+  deallog.pop();
+}
@@ -0,0 +1,162 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that CompiledAffineConstraints::distribute(), set_zero() and
+// condense() give the same results as the respective functions of
+// AffineConstraints for hanging node and inhomogeneous boundary constraints,
+// both for vectors of the same precision and for float vectors.
+
+
+#include <deal.II/base/function_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/compiled_affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <typename Number>
+void
+fill(Vector<Number> &vec)
+{
+  for (unsigned int i = 0; i < vec.size(); ++i)
+    vec(i) = std::sin(1. + i);
+}
+
+
+
+template <typename Number>
+double
+difference(const Vector<double> &reference, const Vector<Number> &vec)
+{
+  double max_difference = 0;
+  for (unsigned int i = 0; i < vec.size(); ++i)
+    max_difference =
+      std::max(max_difference, std::abs(reference(i) - double(vec(i))));
+  return max_difference;
+}
+
+
+
+template <int dim, typename Number>
+void
+check(const DoFHandler<dim>          &dof,
+      const AffineConstraints<double> &constraints,
+      const AffineConstraints<double> &homogeneous_constraints,
+      const double                     tolerance)
+{
+  const CompiledAffineConstraints<Number> compiled(constraints);
+  const CompiledAffineConstraints<Number> compiled_homogeneous(
+    homogeneous_constraints);
+  deallog << "n_constraints: "
+          << (compiled.n_constraints() == constraints.n_constraints())
+          << std::endl;
+
+  Vector<double> reference(dof.n_dofs());
+  Vector<Number> vec(dof.n_dofs());
+
+  fill(reference);
+  fill(vec);
+  constraints.distribute(reference);
+  compiled.distribute(vec);
+  deallog << "distribute: " << (difference(reference, vec) < tolerance)
+          << std::endl;
+
+  fill(reference);
+  fill(vec);
+  constraints.set_zero(reference);
+  compiled.set_zero(vec);
+  deallog << "set_zero: " << (difference(reference, vec) < tolerance)
+          << std::endl;
+
+  fill(reference);
+  fill(vec);
+  homogeneous_constraints.condense(reference);
+  compiled_homogeneous.condense(vec);
+  deallog << "condense: " << (difference(reference, vec) < tolerance)
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  for (unsigned int step = 0; step < 2; ++step)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->center().norm() < 0.5)
+          cell->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof, constraints);
+  VectorTools::interpolate_boundary_values(dof,
+                                           0,
+                                           Functions::SquareFunction<dim>(),
+                                           constraints);
+  constraints.close();
+
+  AffineConstraints<double> homogeneous_constraints;
+  DoFTools::make_hanging_node_constraints(dof, homogeneous_constraints);
+  VectorTools::interpolate_boundary_values(dof,
+                                           0,
+                                           Functions::ZeroFunction<dim>(),
+                                           homogeneous_constraints);
+  homogeneous_constraints.close();
+
+  deallog.push("double");
+  check<dim, double>(dof, constraints, homogeneous_constraints, 1e-12);
+  deallog.pop();
+  deallog.push("float");
+  check<dim, float>(dof, constraints, homogeneous_constraints, 1e-5);
+  deallog.pop();
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
@@ -0,0 +1,135 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check LinearAlgebra::distributed::fused_vector_operation against the
+// separate vector operations and check that the result does not depend on
+// the number of threads
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/la_parallel_vector_fused_operations.h>
+
+#include "../tests.h"
+
+
+
+template <typename number>
+std::array<number, 2>
+fused_update(const number                                      alpha,
+             const LinearAlgebra::distributed::Vector<number> &p,
+             const LinearAlgebra::distributed::Vector<number> &v,
+             LinearAlgebra::distributed::Vector<number>       &x,
+             LinearAlgebra::distributed::Vector<number>       &r)
+{
+  return LinearAlgebra::distributed::fused_vector_operation<2>(
+    [&](const types::global_dof_index          begin,
+        const types::global_dof_index          end,
+        std::array<VectorizedArray<number>, 2> &sums) {
+      constexpr unsigned int n_lanes = VectorizedArray<number>::size();
+      const auto end_regular = begin + (end - begin) / n_lanes * n_lanes;
+      for (auto i = begin; i < end_regular; i += n_lanes)
+        {
+          VectorizedArray<number> xi, pi, ri, vi;
+          xi.load(x.begin() + i);
+          pi.load(p.begin() + i);
+          xi += alpha * pi;
+          xi.store(x.begin() + i);
+          ri.load(r.begin() + i);
+          vi.load(v.begin() + i);
+          ri -= alpha * vi;
+          ri.store(r.begin() + i);
+          sums[0] += ri * ri;
+          sums[1] += ri * pi;
+        }
+      for (auto i = end_regular; i < end; ++i)
+        {
+          x.local_element(i) += alpha * p.local_element(i);
+          r.local_element(i) -= alpha * v.local_element(i);
+          sums[0][0] += r.local_element(i) * r.local_element(i);
+          sums[1][0] += r.local_element(i) * p.local_element(i);
+        }
+    },
+    r);
+}
+
+
+
+template <typename number>
+void
+check()
+{
+  for (const unsigned int size : {17U, 5 * 4096U + 13})
+    {
+      const IndexSet complete_set = complete_index_set(size);
+      LinearAlgebra::distributed::Vector<number> p(complete_set, MPI_COMM_SELF),
+        v(complete_set, MPI_COMM_SELF), x(complete_set, MPI_COMM_SELF),
+        r(complete_set, MPI_COMM_SELF);
+      for (unsigned int i = 0; i < size; ++i)
+        {
+          p(i) = random_value<number>();
+          v(i) = random_value<number>();
+          x(i) = random_value<number>();
+          r(i) = random_value<number>();
+        }
+      const number alpha = 0.37;
+
+      LinearAlgebra::distributed::Vector<number> x_ref(x), r_ref(r),
+        x_serial(x), r_serial(r);
+
+      x_ref.add(alpha, p);
+      r_ref.add(-alpha, v);
+      const number r_norm_sqr = r_ref.norm_sqr();
+      const number r_dot_p    = r_ref * p;
+
+      const std::array<number, 2> sums = fused_update(alpha, p, v, x, r);
+
+      const unsigned int n_threads = MultithreadInfo::n_threads();
+      MultithreadInfo::set_thread_limit(1);
+      const std::array<number, 2> sums_serial =
+        fused_update(alpha, p, v, x_serial, r_serial);
+      MultithreadInfo::set_thread_limit(n_threads);
+
+      const number eps = std::numeric_limits<number>::epsilon();
+
+      x -= x_ref;
+      r -= r_ref;
+      const bool updates_correct =
+        x.linfty_norm() < 4. * eps && r.linfty_norm() < 4. * eps;
+      const bool sums_correct =
+        std::abs(sums[0] - r_norm_sqr) < 10. * eps * size * r_norm_sqr &&
+        std::abs(sums[1] - r_dot_p) <
+          10. * eps * size * std::sqrt(r_norm_sqr * p.norm_sqr());
+
+      deallog << "size " << size << ": updates "
+              << (updates_correct ? "correct" : "wrong") << ", sums "
+              << (sums_correct ? "correct" : "wrong")
+              << ", independent of threads "
+              << (sums == sums_serial ? "yes" : "no") << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+  initlog();
+
+  check<float>();
+  check<double>();
+}
@@ -0,0 +1,143 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check SparseMatrix::multivector_vmult and solve a system with several right
+// hand sides with SolverBlockCG, including linearly dependent right hand
+// sides, and compare against SolverCG applied to each right hand side
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_block_cg.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/sparse_matrix.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+// solve with SolverBlockCG and the given preconditioner for multivectors,
+// and with SolverCG and the respective preconditioner for single vectors
+template <typename PreconditionerType, typename SinglePreconditionerType>
+void
+test(const SparseMatrix<double>                            &matrix,
+     const LinearAlgebra::distributed::BlockVector<double> &rhs,
+     const PreconditionerType                              &preconditioner,
+     const SinglePreconditionerType &single_preconditioner)
+{
+  const unsigned int n_columns = rhs.n_blocks();
+
+  LinearAlgebra::distributed::BlockVector<double> solution(rhs);
+  solution = 0.;
+
+  SolverControl control(1000, 1e-10);
+  deallog.depth_file(0);
+  SolverBlockCG<LinearAlgebra::distributed::BlockVector<double>> solver(
+    control);
+  solver.solve(matrix, solution, rhs, preconditioner);
+
+  // solve the systems one by one
+  unsigned int   max_cg_iterations = 0;
+  bool           solutions_agree   = true;
+  Vector<double> rhs_column(rhs.block(0).size()),
+    solution_column(rhs.block(0).size());
+  for (unsigned int c = 0; c < n_columns; ++c)
+    {
+      for (unsigned int i = 0; i < rhs_column.size(); ++i)
+        rhs_column(i) = rhs.block(c)(i);
+      solution_column = 0.;
+
+      SolverControl cg_control(1000, 1e-10);
+      SolverCG<>    cg(cg_control);
+      cg.solve(matrix, solution_column, rhs_column, single_preconditioner);
+      max_cg_iterations = std::max(max_cg_iterations, cg_control.last_step());
+
+      for (unsigned int i = 0; i < rhs_column.size(); ++i)
+        solution_column(i) -= solution.block(c)(i);
+      if (solution_column.l2_norm() > 1e-7 * rhs_column.l2_norm())
+        solutions_agree = false;
+    }
+  deallog.depth_file(3);
+
+  deallog << "Solutions agree with SolverCG: " << solutions_agree
+          << std::endl;
+  deallog << "Fewer iterations than SolverCG: "
+          << (control.last_step() < max_cg_iterations) << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, size);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> matrix(sparsity);
+  testproblem.five_point(matrix);
+
+  // the right hand sides with indices 1 and 4 coincide
+  const unsigned int                              n_columns = 5;
+  LinearAlgebra::distributed::BlockVector<double> rhs(n_columns, dim);
+  for (unsigned int c = 0; c < n_columns; ++c)
+    for (unsigned int i = 0; i < dim; ++i)
+      rhs.block(c)(i) = random_value<double>();
+  rhs.block(4) = rhs.block(1);
+
+  {
+    LinearAlgebra::distributed::BlockVector<double> result(n_columns, dim);
+    LinearAlgebra::distributed::Vector<double>      reference(dim);
+    matrix.multivector_vmult(result, rhs);
+    bool results_agree = true;
+    for (unsigned int c = 0; c < n_columns; ++c)
+      {
+        matrix.vmult(reference, rhs.block(c));
+        reference -= result.block(c);
+        if (reference.linfty_norm() > 1e-14)
+          results_agree = false;
+      }
+    deallog << "multivector_vmult agrees with vmult: " << results_agree
+            << std::endl;
+  }
+
+  deallog.push("Identity");
+  test(matrix, rhs, PreconditionIdentity(), PreconditionIdentity());
+  deallog.pop();
+
+  // Jacobi preconditioner as a diagonal matrix acting on all blocks
+  LinearAlgebra::distributed::BlockVector<double> diagonal(n_columns, dim);
+  for (unsigned int c = 0; c < n_columns; ++c)
+    for (unsigned int i = 0; i < dim; ++i)
+      diagonal.block(c)(i) = 1. / matrix.diag_element(i);
+  DiagonalMatrix<LinearAlgebra::distributed::BlockVector<double>> jacobi(
+    diagonal);
+
+  PreconditionJacobi<SparseMatrix<double>> single_jacobi;
+  single_jacobi.initialize(matrix);
+
+  deallog.push("Jacobi");
+  test(matrix, rhs, jacobi, single_jacobi);
+  deallog.pop();
+}
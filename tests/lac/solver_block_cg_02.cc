@@ -0,0 +1,180 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Solve a system with several right hand sides with SolverBlockCG and a
+// matrix-free operator that processes all right hand sides in one cell loop
+// with a multi-component FEEvaluation object, and compare against SolverCG
+// applied to each right hand side with the scalar operator
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_block_cg.h>
+#include <deal.II/lac/solver_cg.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+// mass plus Laplace operator applied to n_components vectors at once
+template <int dim, int fe_degree, int n_components, typename VectorType>
+class MassLaplaceOperator
+{
+public:
+  MassLaplaceOperator(const MatrixFree<dim, double> &matrix_free)
+    : matrix_free(matrix_free)
+  {}
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    matrix_free.cell_loop(&MassLaplaceOperator::local_apply,
+                          this,
+                          dst,
+                          src,
+                          true);
+  }
+
+private:
+  void
+  local_apply(const MatrixFree<dim, double>               &data,
+              VectorType                                  &dst,
+              const VectorType                            &src,
+              const std::pair<unsigned int, unsigned int> &cell_range) const
+  {
+    FEEvaluation<dim, fe_degree, fe_degree + 1, n_components, double> phi(
+      data);
+    for (unsigned int cell = cell_range.first; cell < cell_range.second;
+         ++cell)
+      {
+        phi.reinit(cell);
+        phi.read_dof_values(src);
+        phi.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+        for (const unsigned int q : phi.quadrature_point_indices())
+          {
+            phi.submit_value(phi.get_value(q), q);
+            phi.submit_gradient(phi.get_gradient(q), q);
+          }
+        phi.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+        phi.distribute_local_to_global(dst);
+      }
+  }
+
+  const MatrixFree<dim, double> &matrix_free;
+};
+
+
+
+template <int dim, int fe_degree, int n_columns>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(5 - dim);
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     AffineConstraints<double>(),
+                     QGauss<1>(fe_degree + 1),
+                     additional_data);
+
+  using BlockVectorType = LinearAlgebra::distributed::BlockVector<double>;
+  using VectorType      = LinearAlgebra::distributed::Vector<double>;
+
+  BlockVectorType rhs(n_columns), solution(n_columns);
+  for (unsigned int c = 0; c < n_columns; ++c)
+    {
+      matrix_free.initialize_dof_vector(rhs.block(c));
+      matrix_free.initialize_dof_vector(solution.block(c));
+      for (double &entry : rhs.block(c))
+        entry = random_value<double>();
+    }
+  rhs.collect_sizes();
+  solution.collect_sizes();
+
+  const MassLaplaceOperator<dim, fe_degree, n_columns, BlockVectorType>
+    block_operator(matrix_free);
+  const MassLaplaceOperator<dim, fe_degree, 1, VectorType> single_operator(
+    matrix_free);
+
+  deallog.depth_file(0);
+  SolverControl                  control(1000, 1e-10);
+  SolverBlockCG<BlockVectorType> solver(control);
+  solver.solve(block_operator, solution, rhs, PreconditionIdentity());
+
+  // solve the systems one by one
+  unsigned int max_cg_iterations = 0;
+  bool         solutions_agree   = true;
+  VectorType   solution_column;
+  matrix_free.initialize_dof_vector(solution_column);
+  for (unsigned int c = 0; c < n_columns; ++c)
+    {
+      solution_column = 0.;
+
+      SolverControl        cg_control(1000, 1e-10);
+      SolverCG<VectorType> cg(cg_control);
+      cg.solve(single_operator,
+               solution_column,
+               rhs.block(c),
+               PreconditionIdentity());
+      max_cg_iterations = std::max(max_cg_iterations, cg_control.last_step());
+
+      solution_column -= solution.block(c);
+      if (solution_column.l2_norm() > 1e-7 * rhs.block(c).l2_norm())
+        solutions_agree = false;
+    }
+  deallog.depth_file(3);
+
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " n_columns=" << n_columns << std::endl;
+  deallog << "Solutions agree with SolverCG: " << solutions_agree
+          << std::endl;
+  deallog << "Fewer iterations than SolverCG: "
+          << (control.last_step() < max_cg_iterations) << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  test<2, 2, 3>();
+  test<3, 1, 4>();
+}
@@ -0,0 +1,136 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check SolverGMRES with
+// LinearAlgebra::OrthogonalizationStrategy::s_step_cholesky_qr2 against the
+// default orthogonalization strategy for a nonsymmetric matrix, with left and
+// right preconditioning, restarts, several block sizes, and for deal.II's own
+// vectors as well as for a vector type using the generic code path
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+// apply the matrix to the single block of a BlockVector, which SolverGMRES
+// treats with the generic code path
+struct BlockMatrixWrapper
+{
+  void
+  vmult(BlockVector<double> &dst, const BlockVector<double> &src) const
+  {
+    matrix.vmult(dst.block(0), src.block(0));
+  }
+
+  const SparseMatrix<double> &matrix;
+};
+
+
+
+template <typename VectorType, typename MatrixType>
+void
+test(const MatrixType &matrix, const VectorType &rhs)
+{
+  for (const bool right_preconditioning : {false, true})
+    for (const unsigned int s_step_size : {1, 3, 5})
+      {
+        deallog << "right_preconditioning=" << right_preconditioning
+                << " s_step_size=" << s_step_size << std::endl;
+
+        typename SolverGMRES<VectorType>::AdditionalData data;
+        data.max_basis_size        = 25;
+        data.right_preconditioning = right_preconditioning;
+
+        VectorType reference(rhs), solution(rhs);
+        reference = 0.;
+        solution  = 0.;
+
+        SolverControl reference_control(500, 1e-10 * rhs.l2_norm());
+        deallog.depth_file(0);
+        {
+          SolverGMRES<VectorType> solver(reference_control, data);
+          solver.solve(matrix, reference, rhs, PreconditionIdentity());
+        }
+
+        data.orthogonalization_strategy =
+          LinearAlgebra::OrthogonalizationStrategy::s_step_cholesky_qr2;
+        data.s_step_size = s_step_size;
+        SolverControl control(500, 1e-10 * rhs.l2_norm());
+        {
+          SolverGMRES<VectorType> solver(control, data);
+          solver.solve(matrix, solution, rhs, PreconditionIdentity());
+        }
+        deallog.depth_file(3);
+
+        const unsigned int difference =
+          std::max(control.last_step(), reference_control.last_step()) -
+          std::min(control.last_step(), reference_control.last_step());
+        deallog << "Iteration numbers agree: " << (difference <= 1)
+                << std::endl;
+
+        solution -= reference;
+        deallog << "Difference to default strategy below tolerance: "
+                << (solution.l2_norm() < 1e-7 * reference.l2_norm())
+                << std::endl;
+      }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  const unsigned int size = 17;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, size);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> matrix(sparsity);
+  testproblem.five_point(matrix, true);
+
+  Vector<double> rhs(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    rhs(i) = random_value<double>();
+
+  deallog.push("Vector");
+  test(matrix, rhs);
+  deallog.pop();
+
+  deallog.push("LA::distributed::Vector");
+  LinearAlgebra::distributed::Vector<double> rhs_distributed(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    rhs_distributed(i) = rhs(i);
+  test(matrix, rhs_distributed);
+  deallog.pop();
+
+  deallog.push("BlockVector");
+  BlockVector<double> rhs_block(1, dim);
+  rhs_block.block(0) = rhs;
+  test(BlockMatrixWrapper{matrix}, rhs_block);
+  deallog.pop();
+}
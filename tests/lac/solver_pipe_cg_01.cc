@@ -0,0 +1,90 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that SolverPipeCG needs the same number of iterations as SolverCG
+// and computes the same solution, both for the generic implementation with
+// dealii::Vector and the fused and pipelined implementation with
+// LinearAlgebra::distributed::Vector
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_pipe_cg.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename VectorType>
+void
+test(const SparseMatrix<double> &A)
+{
+  VectorType b, x_cg, x_pipecg;
+  b.reinit(A.m());
+  x_cg.reinit(A.m());
+  x_pipecg.reinit(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    b(i) = random_value<double>();
+
+  PreconditionJacobi<SparseMatrix<double>> preconditioner;
+  preconditioner.initialize(A);
+
+  SolverControl            control_cg(1000, 1e-10 * b.l2_norm());
+  SolverCG<VectorType>     cg(control_cg);
+  SolverControl            control_pipecg(1000, 1e-10 * b.l2_norm());
+  SolverPipeCG<VectorType> pipecg(control_pipecg);
+
+  const unsigned int previous_depth = deallog.depth_file(0);
+  cg.solve(A, x_cg, b, preconditioner);
+  pipecg.solve(A, x_pipecg, b, preconditioner);
+  deallog.depth_file(previous_depth);
+
+  deallog << "Iteration numbers agree: "
+          << (std::abs(static_cast<int>(control_cg.last_step()) -
+                       static_cast<int>(control_pipecg.last_step())) <= 1)
+          << std::endl;
+
+  x_pipecg -= x_cg;
+  deallog << "Difference to SolverCG below tolerance: "
+          << (x_pipecg.l2_norm() < 1e-8 * x_cg.l2_norm()) << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, 5);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+
+  SparseMatrix<double> A(sparsity);
+  testproblem.five_point(A);
+
+  test<Vector<double>>(A);
+  test<LinearAlgebra::distributed::Vector<double>>(A);
+}
@@ -0,0 +1,106 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check SparseAMG for the five-point discretization of the Laplacian: the
+// coarse matrices must be the Galerkin products of the level matrices, and
+// the conjugate gradient method preconditioned by the AMG V-cycle must
+// converge in a number of iterations that does not grow with the problem
+// size
+
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_amg.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+
+void
+test(const unsigned int size)
+{
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure((size - 1) * (size - 1),
+                            (size - 1) * (size - 1),
+                            5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+
+  SparseAMG::AdditionalData data;
+  data.max_coarse_size = 50;
+  SparseAMG amg;
+  amg.initialize(A, data);
+
+  deallog << "Size " << A.m() << ": more than two levels: "
+          << (amg.n_levels() > 2 ? "yes" : "no")
+          << ", operator complexity below 2: "
+          << (amg.operator_complexity() < 2. ? "yes" : "no") << std::endl;
+
+  // check (A_c x, y) = (A P x, P y) on all levels
+  bool galerkin_ok = true;
+  for (unsigned int level = 1; level < amg.n_levels(); ++level)
+    {
+      const SparseMatrix<double> &fine_matrix   = amg.get_matrix(level - 1);
+      const SparseMatrix<double> &coarse_matrix = amg.get_matrix(level);
+      const SparseMatrix<double> &prolongator   = amg.get_prolongator(level);
+
+      Vector<double> x(coarse_matrix.m()), y(coarse_matrix.m());
+      for (unsigned int i = 0; i < x.size(); ++i)
+        {
+          x(i) = random_value<double>();
+          y(i) = random_value<double>();
+        }
+      Vector<double> px(fine_matrix.m()), py(fine_matrix.m());
+      prolongator.vmult(px, x);
+      prolongator.vmult(py, y);
+
+      const double coarse_product = coarse_matrix.matrix_scalar_product(y, x);
+      const double fine_product   = fine_matrix.matrix_scalar_product(py, px);
+      if (std::abs(coarse_product - fine_product) >
+          1e-12 * std::abs(fine_product))
+        galerkin_ok = false;
+    }
+  deallog << "Galerkin products: " << (galerkin_ok ? "ok" : "failed")
+          << std::endl;
+
+  Vector<double> solution(A.m()), rhs(A.m());
+  rhs = 1.;
+
+  SolverControl            control(100, 1e-8 * rhs.l2_norm());
+  SolverCG<Vector<double>> solver(control);
+  solver.solve(A, solution, rhs, amg);
+
+  deallog << "Converged in fewer than 20 iterations: "
+          << (control.last_step() < 20 ? "yes" : "no") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog.depth_file(1);
+
+  test(32);
+  test(64);
+  test(128);
+}
@@ -0,0 +1,89 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that SparseILU and SparseMIC give exactly the same results with and
+// without AdditionalData::use_level_scheduling. the matrix is large enough
+// for some levels to be processed in parallel
+
+#include <deal.II/lac/sparse_ilu.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_mic.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename Preconditioner>
+void
+test(const SparseMatrix<double> &A, const unsigned int extra_off_diagonals)
+{
+  typename Preconditioner::AdditionalData data(0., extra_off_diagonals);
+
+  Preconditioner sequential;
+  sequential.initialize(A, data);
+
+  data.use_level_scheduling = true;
+  Preconditioner level_scheduled;
+  level_scheduled.initialize(A, data);
+
+  Vector<double> src(A.m()), dst1(A.m()), dst2(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    src(i) = random_value<double>();
+
+  sequential.vmult(dst1, src);
+  level_scheduled.vmult(dst2, src);
+
+  bool identical = true;
+  for (unsigned int i = 0; i < A.m(); ++i)
+    if (dst1(i) != dst2(i))
+      identical = false;
+
+  deallog << "extra_off_diagonals=" << extra_off_diagonals
+          << " identical: " << identical << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int size = 401;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A, true);
+
+  deallog.push("ILU");
+  for (const unsigned int extra_off_diagonals : {0, 2})
+    test<SparseILU<double>>(A, extra_off_diagonals);
+  deallog.pop();
+
+  testproblem.five_point(A);
+
+  deallog.push("MIC");
+  for (const unsigned int extra_off_diagonals : {0, 2})
+    test<SparseMIC<double>>(A, extra_off_diagonals);
+  deallog.pop();
+}
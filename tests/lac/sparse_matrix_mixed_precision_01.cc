@@ -0,0 +1,90 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that a SparseMatrix<float> can be applied to vectors of type
+// LinearAlgebra::distributed::Vector<double> and be used as a Jacobi
+// preconditioner for a CG solver running in double precision
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, size);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+
+  SparseMatrix<double> matrix(sparsity);
+  testproblem.five_point(matrix);
+
+  SparseMatrix<float> matrix_float(sparsity);
+  matrix_float.copy_from(matrix);
+
+  LinearAlgebra::distributed::Vector<double> src(dim), dst(dim), ref(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    src(i) = random_value<double>();
+
+  matrix.vmult(ref, src);
+  matrix_float.vmult(dst, src);
+  dst -= ref;
+  deallog << "vmult relative error below 1e-6: "
+          << (dst.l2_norm() < 1e-6 * ref.l2_norm()) << std::endl;
+
+  matrix.Tvmult(ref, src);
+  matrix_float.Tvmult(dst, src);
+  dst -= ref;
+  deallog << "Tvmult relative error below 1e-6: "
+          << (dst.l2_norm() < 1e-6 * ref.l2_norm()) << std::endl;
+
+  matrix.precondition_Jacobi(ref, src, 0.8);
+  matrix_float.precondition_Jacobi(dst, src, 0.8f);
+  dst -= ref;
+  deallog << "precondition_Jacobi relative error below 1e-6: "
+          << (dst.l2_norm() < 1e-6 * ref.l2_norm()) << std::endl;
+
+  PreconditionJacobi<SparseMatrix<float>> preconditioner;
+  preconditioner.initialize(matrix_float);
+
+  SolverControl solver_control(1000, 1e-10 * src.l2_norm());
+  SolverCG<LinearAlgebra::distributed::Vector<double>> solver(solver_control);
+
+  dst = 0.;
+  check_solver_within_range(solver.solve(matrix, dst, src, preconditioner),
+                            solver_control.last_step(),
+                            60,
+                            120);
+
+  matrix.vmult(ref, dst);
+  ref -= src;
+  deallog << "Residual below tolerance: "
+          << (ref.l2_norm() < 1e-9 * src.l2_norm()) << std::endl;
+}
@@ -0,0 +1,115 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check SparseMatrixSELL::vmult, vmult_add, Tvmult, Tvmult_add and
+// precondition_Jacobi against the results of SparseMatrix for a
+// nonsymmetric matrix with rows of different lengths and different sorting
+// windows
+
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix_sell.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename number, typename number2>
+void
+test(const unsigned int sigma)
+{
+  const unsigned int size = 13;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, size);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+
+  SparseMatrix<number> matrix(sparsity);
+  testproblem.five_point(matrix, true);
+
+  SparseMatrixSELL<number> sell(sparsity, sigma);
+  sell.copy_from(matrix);
+
+  deallog << "sigma=" << sigma << " n_nonzero_elements "
+          << sell.n_nonzero_elements() << " m=" << sell.m() << " n=" << sell.n()
+          << std::endl;
+
+  Vector<number2> src(dim), dst(dim), ref(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    src(i) = random_value<number2>();
+
+  const number2 tolerance = 100 * std::numeric_limits<number>::epsilon();
+
+  matrix.vmult(ref, src);
+  sell.vmult(dst, src);
+  dst -= ref;
+  deallog << "vmult " << (dst.linfty_norm() < tolerance ? "OK" : "FAILED")
+          << std::endl;
+
+  dst = 1.;
+  ref = 1.;
+  matrix.vmult_add(ref, src);
+  sell.vmult_add(dst, src);
+  dst -= ref;
+  deallog << "vmult_add " << (dst.linfty_norm() < tolerance ? "OK" : "FAILED")
+          << std::endl;
+
+  matrix.Tvmult(ref, src);
+  sell.Tvmult(dst, src);
+  dst -= ref;
+  deallog << "Tvmult " << (dst.linfty_norm() < tolerance ? "OK" : "FAILED")
+          << std::endl;
+
+  dst = 1.;
+  ref = 1.;
+  matrix.Tvmult_add(ref, src);
+  sell.Tvmult_add(dst, src);
+  dst -= ref;
+  deallog << "Tvmult_add " << (dst.linfty_norm() < tolerance ? "OK" : "FAILED")
+          << std::endl;
+
+  for (unsigned int i = 0; i < dim; ++i)
+    ref(i) = number2(0.8) * src(i) / number2(matrix.diag_element(i));
+  sell.precondition_Jacobi(dst, src, 0.8);
+  dst -= ref;
+  deallog << "precondition_Jacobi "
+          << (dst.linfty_norm() < tolerance ? "OK" : "FAILED") << std::endl;
+
+  bool entries_match = true;
+  for (unsigned int i = 0; i < dim; ++i)
+    for (unsigned int j = 0; j < dim; ++j)
+      if (sell.el(i, j) != matrix.el(i, j))
+        entries_match = false;
+  deallog << "el " << (entries_match ? "OK" : "FAILED") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (const unsigned int sigma : {1, 16, 1000})
+    {
+      test<double, double>(sigma);
+      test<float, float>(sigma);
+      test<float, double>(sigma);
+    }
+}
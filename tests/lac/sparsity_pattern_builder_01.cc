@@ -0,0 +1,91 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Add random entries to a SparsityPatternBuilder from several threads at the
+// same time and compare the result with a DynamicSparsityPattern that got
+// the same entries.
+
+
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern_builder.h>
+
+#include "../tests.h"
+
+
+
+int
+main()
+{
+  initlog();
+
+  using size_type           = types::global_dof_index;
+  const size_type n_rows    = 1000;
+  const size_type n_cols    = 800;
+  const size_type n_entries = 50000;
+
+  // use each entry several times to get duplicates
+  std::vector<std::pair<size_type, size_type>> entries(n_entries);
+  for (auto &entry : entries)
+    entry = {Testing::rand() % n_rows, Testing::rand() % n_cols};
+
+  DynamicSparsityPattern dsp(n_rows, n_cols);
+  for (const auto &entry : entries)
+    dsp.add(entry.first, entry.second);
+
+  SparsityPatternBuilder builder(n_rows, n_cols);
+  parallel::apply_to_subranges(
+    size_type(0),
+    3 * n_entries,
+    [&](const size_type begin, const size_type end) {
+      for (size_type i = begin; i < end; ++i)
+        {
+          const auto &entry = entries[i % n_entries];
+          if (i % 2 == 0)
+            builder.add(entry.first, entry.second);
+          else
+            builder.add_row_entries(entry.first,
+                                    make_array_view(&entry.second,
+                                                    &entry.second + 1));
+        }
+    },
+    1000);
+  builder.compress();
+
+  deallog << "n_nonzero_elements: "
+          << (builder.n_nonzero_elements() == dsp.n_nonzero_elements() ?
+                "ok" :
+                "failed")
+          << std::endl;
+
+  bool rows_agree = true;
+  for (size_type row = 0; row < n_rows; ++row)
+    {
+      const ArrayView<const size_type> columns = builder.column_indices(row);
+      rows_agree &= (columns.size() == dsp.row_length(row));
+      for (unsigned int i = 0; i < columns.size(); ++i)
+        rows_agree &= (columns[i] == dsp.column_number(row, i));
+    }
+  deallog << "Column indices: " << (rows_agree ? "ok" : "failed")
+          << std::endl;
+
+  SparsityPattern sparsity_1, sparsity_2;
+  sparsity_1.copy_from(dsp);
+  sparsity_2.copy_from(builder);
+  deallog << "SparsityPattern: "
+          << (sparsity_1 == sparsity_2 ? "ok" : "failed") << std::endl;
+}
@@ -0,0 +1,148 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check MatrixFreeTools::auto_tune() and MatrixFreeTools::AutoTuningCache:
+// the tuned operator must give the same result as the one set up with the
+// default settings, the result must be added to the cache, and a second call
+// must take the settings from the cache without measuring again, also after
+// writing the cache to a file and reading it back.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/auto_tuning.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree>
+void
+test()
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+
+  MappingQ<dim>   mapping(2);
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+  MatrixFreeOperators::LaplaceOperator<dim, fe_degree, fe_degree + 1, 1>
+    laplace;
+
+  unsigned int n_reinit = 0;
+  const std::function<void(
+    const typename MatrixFree<dim, double>::AdditionalData &)>
+    reinit = [&](const typename MatrixFree<dim, double>::AdditionalData &data) {
+      ++n_reinit;
+      matrix_free->reinit(
+        mapping, dof_handler, constraints, QGauss<1>(fe_degree + 1), data);
+      laplace.initialize(matrix_free);
+    };
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+
+  // reference result with the default settings
+  reinit(additional_data);
+  VectorType src, dst_reference, dst;
+  laplace.initialize_dof_vector(src);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = random_value<double>();
+  laplace.initialize_dof_vector(dst_reference);
+  laplace.vmult(dst_reference, src);
+
+  MatrixFreeTools::AutoTuningCache cache;
+  n_reinit = 0;
+  MatrixFreeTools::auto_tune(
+    *matrix_free, laplace, reinit, additional_data, &cache, 2, 1);
+  deallog << "Tuning: number of setups > 2: " << (n_reinit > 2 ? "yes" : "no")
+          << ", cache entries: " << cache.size() << std::endl;
+
+  laplace.initialize_dof_vector(dst);
+  laplace.vmult(dst, src);
+  dst -= dst_reference;
+  deallog << "Difference to default settings "
+          << (dst.linfty_norm() < 1e-12 * dst_reference.linfty_norm() ?
+                "ok" :
+                "failed")
+          << std::endl;
+
+  const std::string filename = "auto_tuning_cache_" + std::to_string(dim);
+  cache.save(filename);
+  MatrixFreeTools::AutoTuningCache cache_from_file(filename);
+  std::remove(filename.c_str());
+
+  n_reinit = 0;
+  const typename MatrixFree<dim, double>::AdditionalData tuned_data =
+    MatrixFreeTools::auto_tune(
+      *matrix_free, laplace, reinit, additional_data, &cache_from_file);
+  deallog << "From cache: number of setups: " << n_reinit
+          << ", cache entries: " << cache_from_file.size() << std::endl;
+
+  laplace.initialize_dof_vector(dst);
+  laplace.vmult(dst, src);
+  dst -= dst_reference;
+  deallog << "Difference to default settings "
+          << (dst.linfty_norm() < 1e-12 * dst_reference.linfty_norm() ?
+                "ok" :
+                "failed")
+          << std::endl;
+
+  const std::optional<MatrixFreeTools::AutoTuningCache::Settings> settings =
+    cache.find(MatrixFreeTools::AutoTuningCache::create_key(
+      dim, fe_degree, dof_handler.n_dofs(), VectorizedArray<double>::size(),
+      sizeof(double), 1));
+  deallog << "Settings from cache match: "
+          << (settings &&
+                  settings->compute_jacobians_on_the_fly ==
+                    tuned_data.compute_jacobians_on_the_fly &&
+                  settings->tasks_block_size == tuned_data.tasks_block_size ?
+                "yes" :
+                "no")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2, 3>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3, 2>();
+  deallog.pop();
+}
@@ -0,0 +1,150 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check MatrixFreeTools::auto_tune() with caches that differ between the MPI
+// processes: if only the first process has an entry, all processes must use
+// it without measuring, and if only another process has an entry, all
+// processes must run the tuning and select the same settings.
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/auto_tuning.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree>
+void
+test()
+{
+  const MPI_Comm     comm  = MPI_COMM_WORLD;
+  const unsigned int my_id = Utilities::MPI::this_mpi_process(comm);
+
+  parallel::shared::Triangulation<dim> tria(comm);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+  MatrixFreeOperators::LaplaceOperator<dim, fe_degree, fe_degree + 1, 1>
+    laplace;
+
+  unsigned int n_reinit = 0;
+  const std::function<void(
+    const typename MatrixFree<dim, double>::AdditionalData &)>
+    reinit = [&](const typename MatrixFree<dim, double>::AdditionalData &data) {
+      ++n_reinit;
+      matrix_free->reinit(MappingQ1<dim>(),
+                          dof_handler,
+                          constraints,
+                          QGauss<1>(fe_degree + 1),
+                          data);
+      laplace.initialize(matrix_free);
+    };
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+  reinit(additional_data);
+
+  const std::string key = MatrixFreeTools::AutoTuningCache::create_key(
+    dim,
+    fe_degree,
+    dof_handler.n_dofs(),
+    VectorizedArray<double>::size(),
+    sizeof(double),
+    Utilities::MPI::n_mpi_processes(comm));
+
+  // settings that the tuning would not select, to identify the entry
+  MatrixFreeTools::AutoTuningCache::Settings settings;
+  settings.tasks_parallel_scheme =
+    MatrixFree<dim, double>::AdditionalData::none;
+  settings.tasks_block_size                  = 7;
+  settings.overlap_communication_computation = false;
+
+  {
+    MatrixFreeTools::AutoTuningCache cache;
+    if (my_id == 0)
+      cache.insert(key, settings);
+
+    n_reinit = 0;
+    const typename MatrixFree<dim, double>::AdditionalData data =
+      MatrixFreeTools::auto_tune(
+        *matrix_free, laplace, reinit, additional_data, &cache, 2, 1);
+    deallog << "Entry on first process: number of setups: " << n_reinit
+            << ", cache entries: " << cache.size() << ", entry used: "
+            << (data.tasks_block_size == 7 &&
+                data.overlap_communication_computation == false)
+            << std::endl;
+  }
+
+  {
+    MatrixFreeTools::AutoTuningCache cache;
+    if (my_id == 1)
+      cache.insert(key, settings);
+
+    n_reinit = 0;
+    const typename MatrixFree<dim, double>::AdditionalData data =
+      MatrixFreeTools::auto_tune(
+        *matrix_free, laplace, reinit, additional_data, &cache, 2, 1);
+    const std::optional<MatrixFreeTools::AutoTuningCache::Settings> entry =
+      cache.find(key);
+    const unsigned int block_size = data.tasks_block_size;
+    const unsigned int scheme     = data.tasks_parallel_scheme;
+    deallog << "Entry on second process: number of setups > 2: "
+            << (n_reinit > 2) << ", cache entries: " << cache.size()
+            << ", same settings on all processes: "
+            << (Utilities::MPI::min(block_size, comm) ==
+                  Utilities::MPI::max(block_size, comm) &&
+                Utilities::MPI::min(scheme, comm) ==
+                  Utilities::MPI::max(scheme, comm) &&
+                entry && entry->tasks_block_size == block_size)
+            << std::endl;
+  }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  deallog.push("2d");
+  test<2, 3>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3, 2>();
+  deallog.pop();
+}
@@ -0,0 +1,178 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check that MatrixFreeTools::compute_matrix gives the same result when the
+// cell batches are processed by several threads, which happens for a
+// task-parallel scheme in MatrixFree, both for a SparseMatrix
+// (written to concurrently) and for a FullMatrix (written to under a lock),
+// by comparing against the matrix-free operator evaluation.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  const int fe_degree       = 2;
+  const int n_points        = fe_degree + 1;
+  const int n_components    = 1;
+  using Number              = double;
+  using VectorizedArrayType = VectorizedArray<Number>;
+  using VectorType          = Vector<Number>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(4 - dim);
+
+  const FE_Q<dim> fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<Number> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+    additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values;
+  additional_data.tasks_parallel_scheme =
+    MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData::
+      partition_partition;
+
+  MatrixFree<dim, Number, VectorizedArrayType> matrix_free;
+  matrix_free.reinit(MappingQ<dim>(2),
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(n_points),
+                     additional_data);
+
+  const auto cell_operation = [](auto &phi) {
+    phi.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+    for (const unsigned int q : phi.quadrature_point_indices())
+      {
+        phi.submit_value(phi.get_value(q), q);
+        phi.submit_gradient(phi.get_gradient(q), q);
+      }
+    phi.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+  };
+
+  // reference result from the matrix-free operator
+  VectorType src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src[i] = random_value<Number>();
+
+  matrix_free.template cell_loop<VectorType, VectorType>(
+    [&](const auto &matrix_free, auto &dst, const auto &src, const auto range) {
+      FEEvaluation<dim,
+                   fe_degree,
+                   n_points,
+                   n_components,
+                   Number,
+                   VectorizedArrayType>
+        phi(matrix_free);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          cell_operation(phi);
+          phi.distribute_local_to_global(dst);
+        }
+    },
+    dst,
+    src);
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints);
+  SparsityPattern sparsity_pattern;
+  sparsity_pattern.copy_from(dsp);
+
+  for (const unsigned int n_threads : {1U, 4U})
+    {
+      MultithreadInfo::set_thread_limit(n_threads);
+
+      SparseMatrix<Number> sparse_matrix(sparsity_pattern);
+      MatrixFreeTools::compute_matrix<dim,
+                                      fe_degree,
+                                      n_points,
+                                      n_components,
+                                      Number,
+                                      VectorizedArrayType>(matrix_free,
+                                                           constraints,
+                                                           sparse_matrix,
+                                                           cell_operation);
+
+      FullMatrix<Number> full_matrix(dof_handler.n_dofs(),
+                                     dof_handler.n_dofs());
+      MatrixFreeTools::compute_matrix<dim,
+                                      fe_degree,
+                                      n_points,
+                                      n_components,
+                                      Number,
+                                      VectorizedArrayType>(matrix_free,
+                                                           constraints,
+                                                           full_matrix,
+                                                           cell_operation);
+
+      VectorType result(dof_handler.n_dofs());
+      sparse_matrix.vmult(result, src);
+      result -= dst;
+      deallog << "Threads " << n_threads << ", SparseMatrix: "
+              << (result.linfty_norm() < 1e-12 * dst.linfty_norm() ? "ok" :
+                                                                      "failed")
+              << std::endl;
+
+      full_matrix.vmult(result, src);
+      result -= dst;
+      deallog << "Threads " << n_threads << ", FullMatrix: "
+              << (result.linfty_norm() < 1e-12 * dst.linfty_norm() ? "ok" :
+                                                                      "failed")
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
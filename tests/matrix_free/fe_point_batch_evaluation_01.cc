@@ -0,0 +1,151 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check FEPointBatchEvaluation for scalar and vector-valued FE_Q with a
+// MappingQ and a few points per cell by comparing evaluate() and
+// test_and_sum() to FEPointEvaluation applied cell by cell, using both
+// Vector and LinearAlgebra::distributed::Vector
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_point_batch_evaluation.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+#include "../tests.h"
+
+
+
+template <int n_components, int dim, typename VectorType>
+void
+test(const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1., 6);
+  tria.refine_global(1);
+
+  MappingQ<dim>   mapping(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  VectorType solution(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < solution.size(); ++i)
+    solution(i) = random_value<double>();
+
+  // between one and three points per cell
+  std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+  std::vector<std::vector<Point<dim>>>                        unit_points;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cells.push_back(cell);
+      unit_points.emplace_back();
+      for (unsigned int i = 0; i < 1 + cell->active_cell_index() % 3; ++i)
+        {
+          Point<dim> p;
+          for (unsigned int d = 0; d < dim; ++d)
+            p[d] = random_value<double>();
+          unit_points.back().push_back(p);
+        }
+    }
+
+  const UpdateFlags flags = update_values | update_gradients;
+  FEPointBatchEvaluation<n_components, dim> batch_evaluator(mapping, fe, flags);
+  FEPointEvaluation<n_components, dim>      evaluator(mapping, fe, flags);
+
+  batch_evaluator.reinit(cells, unit_points);
+  batch_evaluator.evaluate(solution,
+                           EvaluationFlags::values |
+                             EvaluationFlags::gradients);
+  for (const unsigned int q : batch_evaluator.quadrature_point_indices())
+    {
+      batch_evaluator.submit_value(batch_evaluator.get_value(q), q);
+      batch_evaluator.submit_gradient(batch_evaluator.get_gradient(q), q);
+    }
+  VectorType result(dof_handler.n_dofs());
+  batch_evaluator.test_and_sum(result,
+                               EvaluationFlags::values |
+                                 EvaluationFlags::gradients);
+
+  double         max_error = 0.;
+  VectorType     reference(dof_handler.n_dofs());
+  Vector<double> cell_values(fe.n_dofs_per_cell());
+  for (unsigned int c = 0, point = 0; c < cells.size(); ++c)
+    {
+      cells[c]->get_dof_values(solution, cell_values);
+      evaluator.reinit(cells[c], unit_points[c]);
+      evaluator.evaluate(cell_values,
+                         EvaluationFlags::values | EvaluationFlags::gradients);
+      for (const unsigned int q : evaluator.quadrature_point_indices())
+        {
+          max_error =
+            std::max(max_error,
+                     (batch_evaluator.quadrature_point(point + q) -
+                      evaluator.quadrature_point(q))
+                       .norm());
+          const auto value_difference =
+            batch_evaluator.get_value(point + q) - evaluator.get_value(q);
+          const auto gradient_difference =
+            batch_evaluator.get_gradient(point + q) - evaluator.get_gradient(q);
+          if constexpr (n_components == 1)
+            max_error = std::max(max_error, std::abs(value_difference));
+          else
+            max_error = std::max(max_error, value_difference.norm());
+          max_error = std::max(max_error, gradient_difference.norm());
+
+          evaluator.submit_value(evaluator.get_value(q), q);
+          evaluator.submit_gradient(evaluator.get_gradient(q), q);
+        }
+      point += unit_points[c].size();
+
+      evaluator.test_and_sum(cell_values,
+                             EvaluationFlags::values |
+                               EvaluationFlags::gradients);
+      cells[c]->distribute_local_to_global(cell_values, reference);
+    }
+
+  result -= reference;
+
+  deallog << fe.get_name() << " with " << batch_evaluator.n_points()
+          << " points: evaluate "
+          << (max_error < 1e-12 * solution.linfty_norm() ? "ok" : "failed")
+          << ", test_and_sum "
+          << (result.linfty_norm() < 1e-12 * reference.linfty_norm() ?
+                "ok" :
+                "failed")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1, 2, LinearAlgebra::distributed::Vector<double>>(FE_Q<2>(2));
+  test<2, 2, Vector<double>>(FESystem<2>(FE_Q<2>(3), 2));
+  test<1, 3, Vector<double>>(FE_Q<3>(2));
+  test<3, 3, LinearAlgebra::distributed::Vector<double>>(
+    FESystem<3>(FE_Q<3>(2), 3));
+}
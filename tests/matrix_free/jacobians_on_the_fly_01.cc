@@ -0,0 +1,143 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check MatrixFree::AdditionalData::compute_jacobians_on_the_fly: a
+// Laplacian plus mass operator evaluated on a mesh with curved and straight
+// cells and a high-order MappingQ must give the same result as with the
+// stored Jacobians, with fewer and with more quadrature points than mapping
+// support points per direction, while the geometry data takes less memory.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+do_test(const unsigned int mapping_degree,
+        const unsigned int fe_degree,
+        const unsigned int n_q_points_1d)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+
+  MappingQ<dim>   mapping(mapping_degree);
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  VectorType  src, dst_stored, dst_on_the_fly;
+  std::size_t memory_stored = 0, memory_on_the_fly = 0;
+
+  for (const bool on_the_fly : {false, true})
+    {
+      MatrixFree<dim>                          matrix_free;
+      typename MatrixFree<dim>::AdditionalData additional_data;
+      additional_data.mapping_update_flags =
+        update_values | update_gradients | update_JxW_values;
+      additional_data.compute_jacobians_on_the_fly = on_the_fly;
+      matrix_free.reinit(mapping,
+                         dof_handler,
+                         constraints,
+                         QGauss<1>(n_q_points_1d),
+                         additional_data);
+
+      if (src.size() == 0)
+        {
+          matrix_free.initialize_dof_vector(src);
+          for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+            src.local_element(i) = random_value<double>();
+        }
+
+      VectorType &dst = on_the_fly ? dst_on_the_fly : dst_stored;
+      matrix_free.initialize_dof_vector(dst);
+      const std::function<void(const MatrixFree<dim> &,
+                               VectorType &,
+                               const VectorType &,
+                               const std::pair<unsigned int, unsigned int> &)>
+        cell_operation =
+          [](const MatrixFree<dim>                       &data,
+             VectorType                                  &dst,
+             const VectorType                            &src,
+             const std::pair<unsigned int, unsigned int> &range) {
+            FEEvaluation<dim, -1> phi(data);
+            for (unsigned int cell = range.first; cell < range.second; ++cell)
+              {
+                phi.reinit(cell);
+                phi.gather_evaluate(src,
+                                    EvaluationFlags::values |
+                                      EvaluationFlags::gradients);
+                for (const unsigned int q : phi.quadrature_point_indices())
+                  {
+                    phi.submit_value(phi.get_value(q), q);
+                    phi.submit_gradient(phi.get_gradient(q), q);
+                  }
+                phi.integrate_scatter(EvaluationFlags::values |
+                                        EvaluationFlags::gradients,
+                                      dst);
+              }
+          };
+      matrix_free.cell_loop(cell_operation, dst, src);
+
+      (on_the_fly ? memory_on_the_fly : memory_stored) =
+        matrix_free.get_mapping_info().cell_data[0].memory_consumption();
+    }
+
+  deallog << "MappingQ(" << mapping_degree << "), FE_Q(" << fe_degree << "), "
+          << n_q_points_1d << " points: ";
+  dst_on_the_fly -= dst_stored;
+  deallog << "relative difference "
+          << (dst_on_the_fly.linfty_norm() < 1e-12 * dst_stored.linfty_norm() ?
+                "ok" :
+                "failed")
+          << ", memory reduced: "
+          << (memory_on_the_fly < memory_stored ? "yes" : "no") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  do_test<2>(3, 2, 3);
+  do_test<2>(4, 4, 6);
+  deallog.pop();
+  deallog.push("3d");
+  do_test<3>(3, 2, 3);
+  do_test<3>(4, 3, 5);
+  deallog.pop();
+}
@@ -0,0 +1,233 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check MatrixFree::loop with AdditionalData::fuse_cell_and_face_loops on a
+// DG operator with interior and boundary face integrals: The result must be
+// the same as for the default loop, every face batch must be visited exactly
+// once, and only after all the cell batches it is attached to. Furthermore,
+// the fused loop must alternate between ranges of cells and ranges of faces
+// more often than the default loop.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree>
+void
+do_test()
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(6 - dim);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  FE_DGQ<dim>     fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  VectorType src, dst_default, dst_fused;
+
+  // number of cell ranges and of cell ranges that follow a face range in the
+  // default loop
+  std::size_t n_cell_ranges_default = 0, n_alternations_default = 0;
+
+  for (const bool fuse : {false, true})
+    {
+      MatrixFree<dim>                          matrix_free;
+      typename MatrixFree<dim>::AdditionalData additional_data;
+      additional_data.tasks_parallel_scheme =
+        MatrixFree<dim>::AdditionalData::none;
+      additional_data.mapping_update_flags = update_values | update_JxW_values;
+      additional_data.mapping_update_flags_inner_faces =
+        update_values | update_JxW_values;
+      additional_data.mapping_update_flags_boundary_faces =
+        update_values | update_JxW_values;
+      additional_data.fuse_cell_and_face_loops = fuse;
+      matrix_free.reinit(MappingQ1<dim>(),
+                         dof_handler,
+                         constraints,
+                         QGauss<1>(fe_degree + 1),
+                         additional_data);
+
+      if (src.size() == 0)
+        {
+          matrix_free.initialize_dof_vector(src);
+          for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+            src.local_element(i) = random_value<double>();
+        }
+
+      const unsigned int n_lanes = VectorizedArray<double>::size();
+      std::vector<bool>  cell_done(matrix_free.n_cell_batches(), false);
+      std::vector<unsigned int> face_visits(
+        matrix_free.n_inner_face_batches() +
+          matrix_free.n_boundary_face_batches(),
+        0);
+      bool faces_after_cells = true;
+
+      // the order in which the loop calls the operations on cell ranges
+      // ('c') and on face ranges ('f')
+      std::vector<char> range_order;
+
+      const auto check_face_range =
+        [&](const MatrixFree<dim>                       &data,
+            const std::pair<unsigned int, unsigned int> &range) {
+          range_order.push_back('f');
+          for (unsigned int face = range.first; face < range.second; ++face)
+            {
+              ++face_visits[face];
+              const auto &info = data.get_face_info(face);
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                for (const unsigned int cell :
+                     {info.cells_interior[v], info.cells_exterior[v]})
+                  if (cell != numbers::invalid_unsigned_int &&
+                      cell_done[cell / n_lanes] == false)
+                    faces_after_cells = false;
+            }
+        };
+
+      VectorType &dst = fuse ? dst_fused : dst_default;
+      matrix_free.initialize_dof_vector(dst);
+
+      matrix_free.template loop<VectorType, VectorType>(
+        [&](const MatrixFree<dim>                       &data,
+            VectorType                                  &dst,
+            const VectorType                            &src,
+            const std::pair<unsigned int, unsigned int> &range) {
+          range_order.push_back('c');
+          FEEvaluation<dim, fe_degree> phi(data);
+          for (unsigned int cell = range.first; cell < range.second; ++cell)
+            {
+              cell_done[cell] = true;
+              phi.reinit(cell);
+              phi.gather_evaluate(src, EvaluationFlags::values);
+              for (const unsigned int q : phi.quadrature_point_indices())
+                phi.submit_value(phi.get_value(q), q);
+              phi.integrate_scatter(EvaluationFlags::values, dst);
+            }
+        },
+        [&](const MatrixFree<dim>                       &data,
+            VectorType                                  &dst,
+            const VectorType                            &src,
+            const std::pair<unsigned int, unsigned int> &range) {
+          check_face_range(data, range);
+          FEFaceEvaluation<dim, fe_degree> phi_m(data, true);
+          FEFaceEvaluation<dim, fe_degree> phi_p(data, false);
+          for (unsigned int face = range.first; face < range.second; ++face)
+            {
+              phi_m.reinit(face);
+              phi_p.reinit(face);
+              phi_m.gather_evaluate(src, EvaluationFlags::values);
+              phi_p.gather_evaluate(src, EvaluationFlags::values);
+              for (const unsigned int q : phi_m.quadrature_point_indices())
+                {
+                  const auto jump = phi_m.get_value(q) - phi_p.get_value(q);
+                  phi_m.submit_value(jump, q);
+                  phi_p.submit_value(-jump, q);
+                }
+              phi_m.integrate_scatter(EvaluationFlags::values, dst);
+              phi_p.integrate_scatter(EvaluationFlags::values, dst);
+            }
+        },
+        [&](const MatrixFree<dim>                       &data,
+            VectorType                                  &dst,
+            const VectorType                            &src,
+            const std::pair<unsigned int, unsigned int> &range) {
+          check_face_range(data, range);
+          FEFaceEvaluation<dim, fe_degree> phi(data, true);
+          for (unsigned int face = range.first; face < range.second; ++face)
+            {
+              phi.reinit(face);
+              phi.gather_evaluate(src, EvaluationFlags::values);
+              for (const unsigned int q : phi.quadrature_point_indices())
+                phi.submit_value(2. * phi.get_value(q), q);
+              phi.integrate_scatter(EvaluationFlags::values, dst);
+            }
+        },
+        dst,
+        src,
+        true);
+
+      deallog << (fuse ? "Fused loop" : "Default loop")
+              << ": faces visited once: "
+              << (std::count(face_visits.begin(), face_visits.end(), 1U) ==
+                      static_cast<std::ptrdiff_t>(face_visits.size()) ?
+                    "ok" :
+                    "failed")
+              << ", faces after their cells: "
+              << (faces_after_cells ? "ok" : "failed") << std::endl;
+
+      const std::size_t n_cell_ranges =
+        std::count(range_order.begin(), range_order.end(), 'c');
+      std::size_t n_alternations = 0;
+      for (unsigned int i = 1; i < range_order.size(); ++i)
+        if (range_order[i] == 'c' && range_order[i - 1] == 'f')
+          ++n_alternations;
+
+      if (fuse == false)
+        {
+          n_cell_ranges_default  = n_cell_ranges;
+          n_alternations_default = n_alternations;
+        }
+      else
+        deallog << "Fused loop: cell and face ranges interleave: "
+                << (n_cell_ranges > n_cell_ranges_default &&
+                        n_alternations > n_alternations_default ?
+                      "ok" :
+                      "failed")
+                << std::endl;
+    }
+
+  dst_fused -= dst_default;
+  deallog << "Difference between default and fused loop: "
+          << (dst_fused.linfty_norm() < 1e-12 * dst_default.linfty_norm() ?
+                "ok" :
+                "failed")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  do_test<2, 1>();
+  do_test<2, 3>();
+  deallog.pop();
+  deallog.push("3d");
+  do_test<3, 2>();
+  deallog.pop();
+}
@@ -0,0 +1,177 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check CompiledAffineConstraints for distributed vectors against
+// AffineConstraints::distribute(), set_zero() and condense(), for vectors
+// with and without ghost values on entry.
+
+
+#include <deal.II/base/function_lib.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/compiled_affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+void
+fill(VectorType &vec)
+{
+  for (const auto i : vec.locally_owned_elements())
+    vec(i) = std::sin(1. + i);
+}
+
+
+
+// check that the locally owned entries of the two vectors agree on all
+// processes, and the ghost entries as well if the vectors have ghost values
+bool
+agrees(const VectorType &reference, const VectorType &vec)
+{
+  double max_difference = 0;
+  const unsigned int n_entries =
+    reference.locally_owned_size() +
+    (vec.has_ghost_elements() ? reference.get_partitioner()->n_ghost_indices() :
+                                0);
+  for (unsigned int i = 0; i < n_entries; ++i)
+    max_difference = std::max(max_difference,
+                              std::abs(reference.local_element(i) -
+                                       vec.local_element(i)));
+  return Utilities::MPI::max(max_difference, MPI_COMM_WORLD) < 1e-12;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  for (unsigned int step = 0; step < 2; ++step)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->is_locally_owned() && cell->center().norm() < 0.5)
+          cell->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+
+  const IndexSet &locally_owned_dofs = dof.locally_owned_dofs();
+  const IndexSet  locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dof);
+
+  AffineConstraints<double> constraints(locally_owned_dofs,
+                                        locally_relevant_dofs);
+  DoFTools::make_hanging_node_constraints(dof, constraints);
+  VectorTools::interpolate_boundary_values(dof,
+                                           0,
+                                           Functions::SquareFunction<dim>(),
+                                           constraints);
+  constraints.close();
+
+  AffineConstraints<double> homogeneous_constraints(locally_owned_dofs,
+                                                    locally_relevant_dofs);
+  DoFTools::make_hanging_node_constraints(dof, homogeneous_constraints);
+  VectorTools::interpolate_boundary_values(dof,
+                                           0,
+                                           Functions::ZeroFunction<dim>(),
+                                           homogeneous_constraints);
+  homogeneous_constraints.close();
+
+  VectorType reference(locally_owned_dofs,
+                       locally_relevant_dofs,
+                       MPI_COMM_WORLD);
+  VectorType vec(reference);
+
+  const CompiledAffineConstraints<double> compiled(constraints,
+                                                   vec.get_partitioner());
+  const CompiledAffineConstraints<double> compiled_homogeneous(
+    homogeneous_constraints, vec.get_partitioner());
+
+  // distribute into vectors without ghost values
+  fill(reference);
+  fill(vec);
+  constraints.distribute(reference);
+  compiled.distribute(vec);
+  deallog << "distribute: " << agrees(reference, vec) << ' '
+          << vec.has_ghost_elements() << std::endl;
+
+  // distribute into vectors with ghost values, which must be up to date
+  // afterwards
+  fill(reference);
+  fill(vec);
+  vec.update_ghost_values();
+  constraints.distribute(reference);
+  reference.update_ghost_values();
+  compiled.distribute(vec);
+  deallog << "distribute ghosted: " << agrees(reference, vec) << ' '
+          << vec.has_ghost_elements() << std::endl;
+  reference.zero_out_ghost_values();
+  vec.zero_out_ghost_values();
+
+  fill(reference);
+  fill(vec);
+  constraints.set_zero(reference);
+  compiled.set_zero(vec);
+  deallog << "set_zero: " << agrees(reference, vec) << std::endl;
+
+  // AffineConstraints::condense() collects the contributions on the owner of
+  // each entry and thus needs the ghost values of the constrained entries,
+  // whereas CompiledAffineConstraints sends them to the owner
+  fill(reference);
+  fill(vec);
+  VectorType reference_ghosted(reference);
+  reference_ghosted.update_ghost_values();
+  homogeneous_constraints.condense(reference_ghosted, reference);
+  compiled_homogeneous.condense(vec);
+  deallog << "condense: " << agrees(reference, vec) << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
@@ -0,0 +1,129 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that the persistent MPI requests of a vector give correct ghost
+// values and compress results when reused over several calls, when the
+// communication channel changes between calls, and after the vector has been
+// moved
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <iostream>
+#include <vector>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const unsigned int myid    = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int numproc = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  // exchange through point-to-point messages only
+  const bool shared_memory_ghost_exchange =
+    LinearAlgebra::distributed::get_shared_memory_ghost_exchange();
+  LinearAlgebra::distributed::set_shared_memory_ghost_exchange(false);
+
+  // each processor owns 4 indices and ghosts the first two indices of the
+  // next processor and the last index of the previous one
+  const unsigned int n_local = 4;
+  IndexSet           locally_owned(numproc * n_local);
+  locally_owned.add_range(myid * n_local, (myid + 1) * n_local);
+  IndexSet ghost_indices(numproc * n_local);
+  ghost_indices.add_range(((myid + 1) % numproc) * n_local,
+                          ((myid + 1) % numproc) * n_local + 2);
+  ghost_indices.add_index(((myid + numproc - 1) % numproc) * n_local +
+                          n_local - 1);
+  ghost_indices.subtract_set(locally_owned);
+
+  LinearAlgebra::distributed::Vector<double> v(locally_owned,
+                                               ghost_indices,
+                                               MPI_COMM_WORLD);
+
+  for (unsigned int round = 0; round < 3; ++round)
+    {
+      const unsigned int channel = round % 2;
+      for (const auto i : locally_owned)
+        v(i) = i + 1 + 100 * round;
+
+      v.update_ghost_values_start(channel);
+      v.update_ghost_values_finish();
+      if (myid == 0)
+        {
+          deallog << "Round " << round << ", ghost values:";
+          for (const auto i : ghost_indices)
+            deallog << ' ' << v(i);
+          deallog << std::endl;
+        }
+
+      v.zero_out_ghost_values();
+      for (const auto i : ghost_indices)
+        v(i) = 10 * myid + 1 + round;
+      v.compress_start(channel, VectorOperation::add);
+      v.compress_finish(VectorOperation::add);
+      for (unsigned int i = 0; i < v.get_partitioner()->n_ghost_indices(); ++i)
+        AssertThrow(v.local_element(n_local + i) == 0., ExcInternalError());
+      if (myid == 0)
+        {
+          deallog << "Round " << round << ", owned values after compress:";
+          for (const auto i : locally_owned)
+            deallog << ' ' << v(i);
+          deallog << std::endl;
+        }
+
+      // inserting the values of the owners must leave the vector unchanged
+      const LinearAlgebra::distributed::Vector<double> copy(v);
+      v.update_ghost_values_start(1 - channel);
+      v.update_ghost_values_finish();
+      v.compress_start(1 - channel, VectorOperation::insert);
+      v.compress_finish(VectorOperation::insert);
+      for (const auto i : locally_owned)
+        AssertThrow(v(i) == copy(i), ExcInternalError());
+    }
+
+  LinearAlgebra::distributed::Vector<double> w(std::move(v));
+  w.update_ghost_values();
+  if (myid == 0)
+    {
+      deallog << "Ghost values after move:";
+      for (const auto i : ghost_indices)
+        deallog << ' ' << w(i);
+      deallog << std::endl;
+    }
+
+  LinearAlgebra::distributed::set_shared_memory_ghost_exchange(
+    shared_memory_ghost_exchange);
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(
+    argc, argv, testing_max_num_threads());
+
+  unsigned int myid = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  deallog.push(Utilities::int_to_string(myid));
+
+  if (myid == 0)
+    initlog();
+
+  test();
+}
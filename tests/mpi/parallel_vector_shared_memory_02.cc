@@ -0,0 +1,120 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check the ghost exchange through MPI-3 shared memory when the processes
+// are spread over several shared-memory domains: the processes are split
+// into pairs that act as separate nodes, such that ghost values of the
+// other pair are exchanged by point-to-point messages, and the result must
+// agree with the point-to-point exchange among all processes
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <vector>
+
+#include "../tests.h"
+
+
+template <typename Number>
+void
+test()
+{
+  const unsigned int myid    = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int numproc = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  // each processor owns 4 indices and ghosts the first two indices of the
+  // next processor and the last index of the previous one, so every process
+  // has ghosts both within its pair and on the other pair
+  const unsigned int n_local = 4;
+  IndexSet           locally_owned(numproc * n_local);
+  locally_owned.add_range(myid * n_local, (myid + 1) * n_local);
+  IndexSet ghost_indices(numproc * n_local);
+  ghost_indices.add_range(((myid + 1) % numproc) * n_local,
+                          ((myid + 1) % numproc) * n_local + 2);
+  ghost_indices.add_index(((myid + numproc - 1) % numproc) * n_local +
+                          n_local - 1);
+  ghost_indices.subtract_set(locally_owned);
+
+  const auto partitioner =
+    std::make_shared<const Utilities::MPI::Partitioner>(locally_owned,
+                                                        ghost_indices,
+                                                        MPI_COMM_WORLD);
+
+  MPI_Comm comm_sm;
+  int      ierr = MPI_Comm_split(MPI_COMM_WORLD, myid / 2, myid, &comm_sm);
+  AssertThrowMPI(ierr);
+
+  std::vector<Number> ghost_values[2], compressed_values[2];
+  for (const bool shared_memory : {true, false})
+    {
+      LinearAlgebra::distributed::set_shared_memory_ghost_exchange(
+        shared_memory);
+
+      LinearAlgebra::distributed::Vector<Number> v;
+      v.reinit(partitioner, comm_sm);
+      for (const auto i : locally_owned)
+        v(i) = i + 1;
+
+      v.update_ghost_values();
+      for (const auto i : ghost_indices)
+        ghost_values[shared_memory].push_back(v(i));
+
+      v.zero_out_ghost_values();
+      for (const auto i : ghost_indices)
+        v(i) = 10 * myid + 1;
+      v.compress(VectorOperation::add);
+      for (const auto i : locally_owned)
+        compressed_values[shared_memory].push_back(v(i));
+
+      // all ghost entries must be zero after compress
+      for (unsigned int i = 0; i < v.get_partitioner()->n_ghost_indices(); ++i)
+        AssertThrow(v.local_element(n_local + i) == Number(),
+                    ExcInternalError());
+    }
+
+  // restore the default
+  LinearAlgebra::distributed::set_shared_memory_ghost_exchange(true);
+
+  ierr = MPI_Comm_free(&comm_sm);
+  AssertThrowMPI(ierr);
+
+  deallog << "Ghost values agree: " << (ghost_values[0] == ghost_values[1])
+          << std::endl;
+  deallog << "Owned values after compress agree: "
+          << (compressed_values[0] == compressed_values[1]) << std::endl;
+  deallog << "Ghost values:";
+  for (const Number value : ghost_values[1])
+    deallog << ' ' << value;
+  deallog << std::endl << "Owned values after compress:";
+  for (const Number value : compressed_values[1])
+    deallog << ' ' << value;
+  deallog << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test<double>();
+  test<float>();
+}
@@ -0,0 +1,140 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that SolverPipeCG needs the same number of iterations as SolverCG
+// and computes the same solution for LinearAlgebra::distributed::Vector
+// distributed among several processes, where the global reduction of the
+// pipelined variant is overlapped with the matrix-vector product and the
+// preconditioner
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_pipe_cg.h>
+
+#include "../tests.h"
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+// one-dimensional finite difference Laplacian plus a variable reaction
+// term, with the rows distributed contiguously among the processes
+class DistributedOperator
+{
+public:
+  DistributedOperator(
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+    : partitioner(partitioner)
+  {}
+
+  double
+  diagonal(const types::global_dof_index i) const
+  {
+    return 2. + 0.1 * (i % 5);
+  }
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    src.update_ghost_values();
+    const types::global_dof_index n = partitioner->size();
+    for (const types::global_dof_index i : partitioner->locally_owned_range())
+      {
+        double sum = diagonal(i) * src(i);
+        if (i > 0)
+          sum -= src(i - 1);
+        if (i + 1 < n)
+          sum -= src(i + 1);
+        dst(i) = sum;
+      }
+    src.zero_out_ghost_values();
+  }
+
+private:
+  const std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
+};
+
+
+
+void
+test()
+{
+  const unsigned int my_id   = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  const types::global_dof_index n_local = 200;
+  const types::global_dof_index n       = n_local * n_procs;
+
+  IndexSet owned(n), ghosts(n);
+  owned.add_range(my_id * n_local, (my_id + 1) * n_local);
+  if (my_id > 0)
+    ghosts.add_index(my_id * n_local - 1);
+  if (my_id + 1 < n_procs)
+    ghosts.add_index((my_id + 1) * n_local);
+
+  const auto partitioner =
+    std::make_shared<const Utilities::MPI::Partitioner>(owned,
+                                                        ghosts,
+                                                        MPI_COMM_WORLD);
+  const DistributedOperator A(partitioner);
+
+  VectorType b(partitioner), x_cg(partitioner), x_pipecg(partitioner);
+  VectorType inverse_diagonal(partitioner);
+  for (const types::global_dof_index i : owned)
+    {
+      b(i)                = std::sin(0.1 * i) + 0.5;
+      inverse_diagonal(i) = 1. / A.diagonal(i);
+    }
+
+  DiagonalMatrix<VectorType> preconditioner;
+  preconditioner.reinit(inverse_diagonal);
+
+  SolverControl            control_cg(1000, 1e-10 * b.l2_norm());
+  SolverCG<VectorType>     cg(control_cg);
+  SolverControl            control_pipecg(1000, 1e-10 * b.l2_norm());
+  SolverPipeCG<VectorType> pipecg(control_pipecg);
+
+  const unsigned int previous_depth = deallog.depth_file(0);
+  cg.solve(A, x_cg, b, preconditioner);
+  pipecg.solve(A, x_pipecg, b, preconditioner);
+  deallog.depth_file(previous_depth);
+
+  deallog << "Iteration numbers agree: "
+          << (std::abs(static_cast<int>(control_cg.last_step()) -
+                       static_cast<int>(control_pipecg.last_step())) <= 1)
+          << std::endl;
+
+  x_pipecg -= x_cg;
+  deallog << "Difference to SolverCG below tolerance: "
+          << (x_pipecg.l2_norm() < 1e-8 * x_cg.l2_norm()) << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test();
+}
@@ -0,0 +1,160 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+/**
+ * Test agglomeration of a coarse level: Repartition a triangulation with
+ * RepartitioningPolicyTools::MinimalGranularityPolicy based on the number of
+ * unknowns, create a copy of it on the subcommunicator of the processes with
+ * cells, and check that MGCoarseGridAgglomeration runs a coarse-grid solver
+ * on that subcommunicator with matching vectors.
+ */
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/distributed/repartitioning_policy_tools.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria_description.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include "../tests.h"
+
+using namespace dealii;
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+// a coarse-grid solver that scales the vector by two and reports the size of
+// the communicator it runs on
+class ScalingSolver : public MGCoarseGridBase<VectorType>
+{
+public:
+  void
+  operator()(const unsigned int,
+             VectorType       &dst,
+             const VectorType &src) const override
+  {
+    deallog << "solve on "
+            << Utilities::MPI::n_mpi_processes(src.get_mpi_communicator())
+            << " processes" << std::endl;
+
+    dst = src;
+    dst *= 2.;
+  }
+};
+
+template <int dim>
+void
+test(const MPI_Comm comm)
+{
+  // distribute a mesh evenly among all processes
+  Triangulation<dim> tria_serial;
+  GridGenerator::hyper_cube(tria_serial);
+  tria_serial.refine_global(5 - dim);
+  GridTools::partition_triangulation_zorder(
+    Utilities::MPI::n_mpi_processes(comm), tria_serial);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(
+    TriangulationDescription::Utilities::create_description_from_triangulation(
+      tria_serial, comm));
+
+  // agglomerate the cells such that each process has at least the given
+  // number of unknowns, which leaves two processes with cells
+  const FE_Q<dim> fe(2);
+
+  const RepartitioningPolicyTools::MinimalGranularityPolicy<dim> policy(
+    fe, 100 * (dim - 1));
+
+  parallel::fullydistributed::Triangulation<dim> tria_coarse(comm);
+  tria_coarse.create_triangulation(
+    TriangulationDescription::Utilities::create_description_from_triangulation(
+      tria, policy.partition(tria)));
+
+  deallog << "locally owned cells: "
+          << tria_coarse.n_locally_owned_active_cells() << std::endl;
+
+  DoFHandler<dim> dof_handler(tria_coarse);
+  dof_handler.distribute_dofs(fe);
+
+  // create the triangulation on the subcommunicator and set up the
+  // coarse-grid solver there
+  const auto tria_agglomerated =
+    MGTransferGlobalCoarseningTools::create_agglomerated_triangulation(
+      tria_coarse);
+
+  deallog << "part of subcommunicator: " << (tria_agglomerated != nullptr)
+          << std::endl;
+
+  DoFHandler<dim>                       dof_handler_agglomerated;
+  ScalingSolver                         solver;
+  MGCoarseGridAgglomeration<VectorType> mg_coarse;
+
+  if (tria_agglomerated != nullptr)
+    {
+      dof_handler_agglomerated.reinit(*tria_agglomerated);
+      dof_handler_agglomerated.distribute_dofs(fe);
+
+      deallog << "n_dofs: " << dof_handler_agglomerated.n_dofs() << ' '
+              << dof_handler.n_dofs() << std::endl;
+      deallog << "locally owned DoFs match: "
+              << (dof_handler_agglomerated.locally_owned_dofs() ==
+                  dof_handler.locally_owned_dofs())
+              << std::endl;
+
+      mg_coarse.initialize(
+        solver,
+        std::make_shared<Utilities::MPI::Partitioner>(
+          dof_handler_agglomerated.locally_owned_dofs(),
+          DoFTools::extract_locally_relevant_dofs(dof_handler_agglomerated),
+          tria_agglomerated->get_mpi_communicator()));
+    }
+
+  // apply the coarse-grid solver on the coarse level
+  VectorType src(dof_handler.locally_owned_dofs(),
+                 DoFTools::extract_locally_relevant_dofs(dof_handler),
+                 comm);
+  VectorType dst(src);
+  for (const auto i : src.locally_owned_elements())
+    src[i] = i;
+
+  mg_coarse(0, dst, src);
+
+  dst.add(-2., src);
+  deallog << "error: " << dst.linfty_norm() << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  deallog.push("2d");
+  test<2>(MPI_COMM_WORLD);
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>(MPI_COMM_WORLD);
+  deallog.pop();
+}
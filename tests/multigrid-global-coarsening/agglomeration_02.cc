@@ -0,0 +1,145 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+/**
+ * Test that MGTransferGlobalCoarseningTools::create_agglomerated_triangulation()
+ * enumerates the unknowns in the same way as the original triangulation: The
+ * support points of all locally relevant unknowns of a DoFHandler on the
+ * agglomerated triangulation must agree with the ones of the same unknowns
+ * of a DoFHandler on the original triangulation, for a deformed mesh and a
+ * multi-component element.
+ */
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/distributed/repartitioning_policy_tools.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria_description.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include "../tests.h"
+
+using namespace dealii;
+
+template <int dim>
+void
+test(const MPI_Comm comm)
+{
+  // distribute a deformed mesh evenly among all processes
+  Triangulation<dim> tria_serial;
+  GridGenerator::hyper_cube(tria_serial);
+  tria_serial.refine_global(5 - dim);
+  GridTools::transform(
+    [](const Point<dim> &p) {
+      Point<dim> q = p;
+      q[0] += 0.1 * std::sin(numbers::PI * p[dim - 1]);
+      q[1] += 0.05 * p[0] * p[0];
+      return q;
+    },
+    tria_serial);
+  GridTools::partition_triangulation_zorder(
+    Utilities::MPI::n_mpi_processes(comm), tria_serial);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(
+    TriangulationDescription::Utilities::create_description_from_triangulation(
+      tria_serial, comm));
+
+  // agglomerate the cells such that each process has at least the given
+  // number of unknowns of a scalar element, which leaves two processes with
+  // cells
+  const RepartitioningPolicyTools::MinimalGranularityPolicy<dim> policy(
+    FE_Q<dim>(2), 100 * (dim - 1));
+
+  parallel::fullydistributed::Triangulation<dim> tria_coarse(comm);
+  tria_coarse.create_triangulation(
+    TriangulationDescription::Utilities::create_description_from_triangulation(
+      tria, policy.partition(tria)));
+
+  const FESystem<dim> fe(FE_Q<dim>(2), 2);
+
+  DoFHandler<dim> dof_handler(tria_coarse);
+  dof_handler.distribute_dofs(fe);
+
+  const auto tria_agglomerated =
+    MGTransferGlobalCoarseningTools::create_agglomerated_triangulation(
+      tria_coarse);
+
+  deallog << "part of subcommunicator: " << (tria_agglomerated != nullptr)
+          << std::endl;
+
+  if (tria_agglomerated == nullptr)
+    return;
+
+  DoFHandler<dim> dof_handler_agglomerated(*tria_agglomerated);
+  dof_handler_agglomerated.distribute_dofs(fe);
+
+  deallog << "n_processes: "
+          << Utilities::MPI::n_mpi_processes(
+               tria_agglomerated->get_mpi_communicator())
+          << std::endl;
+
+  const MappingQ1<dim> mapping;
+
+  const std::map<types::global_dof_index, Point<dim>> support_points =
+    DoFTools::map_dofs_to_support_points(mapping, dof_handler);
+  const std::map<types::global_dof_index, Point<dim>>
+    support_points_agglomerated =
+      DoFTools::map_dofs_to_support_points(mapping, dof_handler_agglomerated);
+
+  // the agglomerated triangulation has the same locally owned and ghost
+  // cells, so the same unknowns are locally relevant
+  AssertThrow(support_points.size() == support_points_agglomerated.size(),
+              ExcInternalError());
+
+  unsigned int n_mismatches = 0;
+  for (const auto &[index, point] : support_points_agglomerated)
+    {
+      const auto entry = support_points.find(index);
+      if (entry == support_points.end() ||
+          entry->second.distance(point) > 1e-12)
+        ++n_mismatches;
+    }
+
+  deallog << "locally owned DoFs match: "
+          << (dof_handler_agglomerated.locally_owned_dofs() ==
+              dof_handler.locally_owned_dofs())
+          << std::endl;
+  deallog << "mismatching support points: " << n_mismatches << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  deallog.push("2d");
+  test<2>(MPI_COMM_WORLD);
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>(MPI_COMM_WORLD);
+  deallog.pop();
+}
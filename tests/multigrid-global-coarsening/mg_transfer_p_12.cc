@@ -0,0 +1,177 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+/**
+ * Test transfer operator for polynomial coarsening on a mesh with enough
+ * cells per process to have cells with and without access to ghost values,
+ * which are processed in different phases of the communication. Check that
+ * prolongation reproduces linear functions and that restriction is the
+ * transpose of prolongation, both with and without ghost values set in the
+ * source vector.
+ */
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "mg_transfer_util.h"
+
+using namespace dealii;
+
+template <int dim, typename Number>
+void
+do_test(const FiniteElement<dim> &fe_fine, const FiniteElement<dim> &fe_coarse)
+{
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+
+  // create grid with hanging nodes
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  for (auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned() && cell->center()[0] < 0.5)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  // setup dof-handlers
+  DoFHandler<dim> dof_handler_fine(tria);
+  dof_handler_fine.distribute_dofs(fe_fine);
+
+  DoFHandler<dim> dof_handler_coarse(tria);
+  dof_handler_coarse.distribute_dofs(fe_coarse);
+
+  AffineConstraints<Number> constraint_coarse(
+    dof_handler_coarse.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler_coarse));
+  DoFTools::make_hanging_node_constraints(dof_handler_coarse,
+                                          constraint_coarse);
+  constraint_coarse.close();
+
+  AffineConstraints<Number> constraint_fine(
+    dof_handler_fine.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler_fine));
+  DoFTools::make_hanging_node_constraints(dof_handler_fine, constraint_fine);
+  constraint_fine.close();
+
+  // setup transfer operator
+  MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>> transfer;
+  transfer.reinit(dof_handler_fine,
+                  dof_handler_coarse,
+                  constraint_fine,
+                  constraint_coarse);
+
+  LinearAlgebra::distributed::Vector<Number> vec_coarse, vec_fine, ref_fine,
+    tmp_coarse, tmp_fine;
+  initialize_dof_vector(vec_coarse,
+                        dof_handler_coarse,
+                        numbers::invalid_unsigned_int);
+  initialize_dof_vector(tmp_coarse,
+                        dof_handler_coarse,
+                        numbers::invalid_unsigned_int);
+  initialize_dof_vector(vec_fine,
+                        dof_handler_fine,
+                        numbers::invalid_unsigned_int);
+  initialize_dof_vector(ref_fine,
+                        dof_handler_fine,
+                        numbers::invalid_unsigned_int);
+  initialize_dof_vector(tmp_fine,
+                        dof_handler_fine,
+                        numbers::invalid_unsigned_int);
+
+  for (const bool set_ghosts : {false, true})
+    {
+      deallog << "ghosts set in source: " << set_ghosts << std::endl;
+
+      // prolongation of a linear function is exact
+      const ScalarFunctionFromFunctionObject<dim> linear(
+        [](const Point<dim> &p) { return p[0] + 2. * p[dim - 1]; });
+      VectorTools::interpolate(dof_handler_coarse, linear, vec_coarse);
+      VectorTools::interpolate(dof_handler_fine, linear, ref_fine);
+      if (set_ghosts)
+        vec_coarse.update_ghost_values();
+
+      vec_fine = 0.;
+      transfer.prolongate_and_add(vec_fine, vec_coarse);
+      constraint_fine.distribute(vec_fine);
+      vec_fine -= ref_fine;
+      deallog << "prolongation of linear function: "
+              << (vec_fine.linfty_norm() < 1e-12 ? "OK" : "FAILED")
+              << std::endl;
+      vec_coarse.zero_out_ghost_values();
+
+      // restriction is the transpose of prolongation
+      for (const auto i : vec_coarse.locally_owned_elements())
+        vec_coarse[i] = std::sin(static_cast<double>(i));
+      for (const auto i : tmp_fine.locally_owned_elements())
+        tmp_fine[i] = std::cos(static_cast<double>(i));
+      if (set_ghosts)
+        {
+          vec_coarse.update_ghost_values();
+          tmp_fine.update_ghost_values();
+        }
+
+      vec_fine = 0.;
+      transfer.prolongate_and_add(vec_fine, vec_coarse);
+      tmp_coarse = 0.;
+      transfer.restrict_and_add(tmp_coarse, tmp_fine);
+
+      vec_coarse.zero_out_ghost_values();
+      tmp_fine.zero_out_ghost_values();
+
+      const Number product_fine   = vec_fine * tmp_fine;
+      const Number product_coarse = tmp_coarse * vec_coarse;
+      deallog << "restriction is transpose of prolongation: "
+              << (std::abs(product_fine - product_coarse) <
+                      1e-12 * std::abs(product_fine) ?
+                    "OK" :
+                    "FAILED")
+              << std::endl;
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  deallog.push("CG<2>(2)<->CG<2>(1)");
+  do_test<2, double>(FE_Q<2>(2), FE_Q<2>(1));
+  deallog.pop();
+
+  deallog.push("CG<2>(4)<->CG<2>(2)");
+  do_test<2, double>(FE_Q<2>(4), FE_Q<2>(2));
+  deallog.pop();
+
+  deallog.push("DG<2>(2)<->CG<2>(1)");
+  do_test<2, double>(FE_DGQ<2>(2), FE_Q<2>(1));
+  deallog.pop();
+
+  deallog.push("CG<3>(2)<->CG<3>(1)");
+  do_test<3, double>(FE_Q<3>(2), FE_Q<3>(1));
+  deallog.pop();
+}
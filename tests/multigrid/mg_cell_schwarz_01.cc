@@ -0,0 +1,173 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test PreconditionCellSchwarz on anisotropic Cartesian meshes: applying the
+// tensor-product cell matrices of the interior penalty method, assembled
+// independently from FE_DGQ<1>, to the result of vmult() must give back the
+// input vector.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/multigrid/mg_cell_schwarz.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test(const unsigned int fe_degree)
+{
+  const unsigned int n_refinements = 5 - dim;
+
+  Point<dim> p1, p2;
+  for (unsigned int d = 0; d < dim; ++d)
+    p2[d] = 2. / (d + 1);
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_rectangle(tria, p1, p2);
+  tria.refine_global(n_refinements);
+
+  FE_DGQ<dim>     fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     AffineConstraints<double>(),
+                     QGauss<1>(fe_degree + 1),
+                     additional_data);
+
+  PreconditionCellSchwarz<dim, double> preconditioner;
+  preconditioner.initialize(matrix_free);
+
+  LinearAlgebra::distributed::Vector<double> src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  for (double &entry : src)
+    entry = random_value<double>();
+
+  preconditioner.vmult(dst, src);
+
+  // assemble the 1d matrices of the interior penalty method on the unit
+  // interval
+  const FE_DGQ<1>    fe_1d(fe_degree);
+  const QGauss<1>    quadrature(fe_degree + 1);
+  const unsigned int n       = fe_degree + 1;
+  const double       penalty = fe_degree * (fe_degree + 1);
+  Table<2, double>   mass_unit(n, n), laplace_unit(n, n);
+  for (unsigned int i = 0; i < n; ++i)
+    for (unsigned int j = 0; j < n; ++j)
+      {
+        for (unsigned int q = 0; q < quadrature.size(); ++q)
+          {
+            mass_unit(i, j) += fe_1d.shape_value(i, quadrature.point(q)) *
+                               fe_1d.shape_value(j, quadrature.point(q)) *
+                               quadrature.weight(q);
+            laplace_unit(i, j) +=
+              fe_1d.shape_grad(i, quadrature.point(q))[0] *
+              fe_1d.shape_grad(j, quadrature.point(q))[0] *
+              quadrature.weight(q);
+          }
+        for (unsigned int f = 0; f < 2; ++f)
+          {
+            const Point<1> p(f);
+            const double   normal = f == 0 ? -1. : 1.;
+            laplace_unit(i, j) +=
+              penalty * fe_1d.shape_value(i, p) * fe_1d.shape_value(j, p) -
+              0.5 * normal * fe_1d.shape_grad(i, p)[0] *
+                fe_1d.shape_value(j, p) -
+              0.5 * normal * fe_1d.shape_grad(j, p)[0] *
+                fe_1d.shape_value(i, p);
+          }
+      }
+
+  std::array<Table<2, double>, dim> mass_matrices, laplace_matrices;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      const double h = p2[d] / (1U << n_refinements);
+      mass_matrices[d].reinit(n, n);
+      laplace_matrices[d].reinit(n, n);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j < n; ++j)
+          {
+            mass_matrices[d](i, j)    = h * mass_unit(i, j);
+            laplace_matrices[d](i, j) = laplace_unit(i, j) / h;
+          }
+    }
+  TensorProductMatrixSymmetricSum<dim, double> cell_matrix;
+  cell_matrix.reinit(mass_matrices, laplace_matrices);
+
+  FEEvaluation<dim, -1> phi_dst(matrix_free), phi_src(matrix_free);
+  std::vector<double>   product(fe.n_dofs_per_cell()),
+    dst_values(fe.n_dofs_per_cell());
+  double error = 0.;
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      phi_dst.reinit(cell);
+      phi_src.reinit(cell);
+      phi_dst.read_dof_values(dst);
+      phi_src.read_dof_values(src);
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(cell);
+           ++v)
+        {
+          for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+            dst_values[i] = phi_dst.begin_dof_values()[i][v];
+          cell_matrix.vmult(make_array_view(product),
+                            make_array_view(std::as_const(dst_values)));
+          for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+            error = std::max(error,
+                             std::abs(product[i] -
+                                      phi_src.begin_dof_values()[i][v]));
+        }
+    }
+
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " n_dofs=" << dof_handler.n_dofs()
+          << " error small: " << (error < 1e-8) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(1);
+  test<2>(3);
+  test<3>(2);
+  test<3>(4);
+}
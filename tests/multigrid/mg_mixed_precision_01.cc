@@ -0,0 +1,206 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test PreconditionMGMixedPrecision: solve the Laplace equation with a
+// conjugate gradient solver in double precision, preconditioned by a
+// multigrid cycle whose level operators, smoothers, and transfer work in
+// single precision, and compare against the same multigrid cycle in double
+// precision.
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_cg.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/multigrid/mg_constrained_dofs.h>
+#include <deal.II/multigrid/mg_mixed_precision.h>
+#include <deal.II/multigrid/mg_transfer_matrix_free.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree, typename Number>
+using LaplaceOperatorType = MatrixFreeOperators::
+  LaplaceOperator<dim,
+                  fe_degree,
+                  fe_degree + 1,
+                  1,
+                  LinearAlgebra::distributed::Vector<Number>>;
+
+
+
+template <int dim, int fe_degree, typename Number>
+void
+setup_level_operators(
+  const DoFHandler<dim>                                      &dof_handler,
+  const MGConstrainedDoFs                                    &mg_constrained,
+  MGLevelObject<LaplaceOperatorType<dim, fe_degree, Number>> &mg_matrices)
+{
+  const unsigned int n_levels =
+    dof_handler.get_triangulation().n_global_levels();
+  mg_matrices.resize(0, n_levels - 1);
+  for (unsigned int level = 0; level < n_levels; ++level)
+    {
+      AffineConstraints<double> level_constraints(
+        dof_handler.locally_owned_mg_dofs(level),
+        DoFTools::extract_locally_relevant_level_dofs(dof_handler, level));
+      level_constraints.add_lines(mg_constrained.get_boundary_indices(level));
+      level_constraints.close();
+
+      typename MatrixFree<dim, Number>::AdditionalData additional_data;
+      additional_data.mapping_update_flags =
+        update_gradients | update_JxW_values;
+      additional_data.mg_level = level;
+      const auto matrix_free = std::make_shared<MatrixFree<dim, Number>>();
+      matrix_free->reinit(MappingQ1<dim>(),
+                          dof_handler,
+                          level_constraints,
+                          QGauss<1>(fe_degree + 1),
+                          additional_data);
+
+      mg_matrices[level].initialize(matrix_free, mg_constrained, level);
+      mg_matrices[level].compute_diagonal();
+    }
+}
+
+
+
+template <int dim, int fe_degree, typename Number>
+unsigned int
+solve(const DoFHandler<dim>                             &dof_handler,
+      const MGConstrainedDoFs                           &mg_constrained_dofs,
+      const LaplaceOperatorType<dim, fe_degree, double> &system_matrix,
+      LinearAlgebra::distributed::Vector<double>        &solution,
+      const LinearAlgebra::distributed::Vector<double>  &rhs)
+{
+  using LevelMatrixType = LaplaceOperatorType<dim, fe_degree, Number>;
+
+  MGLevelObject<LevelMatrixType> mg_matrices;
+  setup_level_operators<dim, fe_degree, Number>(dof_handler,
+                                                mg_constrained_dofs,
+                                                mg_matrices);
+
+  MGTransferMatrixFree<dim, Number> mg_transfer(mg_constrained_dofs);
+  mg_transfer.build(dof_handler);
+
+  PreconditionMGMixedPrecision<dim,
+                               LinearAlgebra::distributed::Vector<Number>,
+                               LevelMatrixType,
+                               MGTransferMatrixFree<dim, Number>>
+    preconditioner;
+  preconditioner.initialize(dof_handler, mg_matrices, mg_transfer);
+
+  SolverControl control(100, 1e-10 * rhs.l2_norm(), false, false);
+  SolverCG<LinearAlgebra::distributed::Vector<double>> solver(control);
+  solution = 0;
+  solver.solve(system_matrix, solution, rhs, preconditioner);
+
+  return control.last_step();
+}
+
+
+
+template <int dim, int fe_degree>
+void
+test()
+{
+  Triangulation<dim> tria(
+    Triangulation<dim>::limit_level_difference_at_vertices);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(5 - dim);
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  dof_handler.distribute_mg_dofs();
+
+  AffineConstraints<double> constraints;
+  VectorTools::interpolate_boundary_values(dof_handler,
+                                           0,
+                                           Functions::ZeroFunction<dim>(),
+                                           constraints);
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+  const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+  matrix_free->reinit(MappingQ1<dim>(),
+                      dof_handler,
+                      constraints,
+                      QGauss<1>(fe_degree + 1),
+                      additional_data);
+
+  LaplaceOperatorType<dim, fe_degree, double> system_matrix;
+  system_matrix.initialize(matrix_free);
+
+  MGConstrainedDoFs mg_constrained_dofs;
+  mg_constrained_dofs.initialize(dof_handler);
+  mg_constrained_dofs.make_zero_boundary_constraints(dof_handler, {0});
+
+  LinearAlgebra::distributed::Vector<double> rhs, solution_float,
+    solution_double;
+  system_matrix.initialize_dof_vector(rhs);
+  system_matrix.initialize_dof_vector(solution_float);
+  system_matrix.initialize_dof_vector(solution_double);
+  for (unsigned int i = 0; i < rhs.locally_owned_size(); ++i)
+    if (!constraints.is_constrained(rhs.get_partitioner()->local_to_global(i)))
+      rhs.local_element(i) = random_value<double>();
+
+  const unsigned int n_iterations_float = solve<dim, fe_degree, float>(
+    dof_handler, mg_constrained_dofs, system_matrix, solution_float, rhs);
+  const unsigned int n_iterations_double = solve<dim, fe_degree, double>(
+    dof_handler, mg_constrained_dofs, system_matrix, solution_double, rhs);
+
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " n_dofs=" << dof_handler.n_dofs() << std::endl;
+  deallog << "Iterations within limit: " << (n_iterations_float <= 10)
+          << std::endl;
+  deallog << "Iterations close to double precision: "
+          << (n_iterations_float <= n_iterations_double + 1) << std::endl;
+
+  solution_float -= solution_double;
+  deallog << "Solutions agree: "
+          << (solution_float.linfty_norm() <
+              1e-6 * solution_double.linfty_norm())
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  initlog();
+
+  test<2, 2>();
+  test<3, 2>();
+}
@@ -0,0 +1,321 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test PreconditionVertexPatchSchwarz on anisotropic Cartesian meshes: the
+// vertex patches and their matrices are set up independently from FE_Q<1>
+// and FE_DGQ<1>. Applying the patch matrix to the result of vmult_color()
+// on a patch must give back the input vector on that patch if the patch
+// has the given color. Each patch must have exactly one color, and vmult()
+// must be the sum over the colors.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_tools.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/multigrid/mg_patch_schwarz.h>
+
+#include "../tests.h"
+
+
+
+// assemble the mass and Laplace matrices of the 1d patch of two intervals of
+// lengths h[0] and h[1], with the interior penalty method for discontinuous
+// elements and with the unknowns at the ends of the patch left out for
+// continuous elements
+void
+assemble_1d(const FiniteElement<1>      &fe_1d,
+            const std::array<double, 2> &h,
+            Table<2, double>            &mass,
+            Table<2, double>            &laplace)
+{
+  const bool         is_dg  = fe_1d.n_dofs_per_vertex() == 0;
+  const unsigned int degree = fe_1d.degree;
+  const unsigned int n      = degree + 1;
+  const QGauss<1>    quadrature(n);
+  const std::vector<unsigned int> lexicographic =
+    is_dg ? std::vector<unsigned int>() :
+            FETools::lexicographic_to_hierarchic_numbering<1>(degree);
+  const auto value = [&](const unsigned int i, const Point<1> &p) {
+    return fe_1d.shape_value(is_dg ? i : lexicographic[i], p);
+  };
+  const auto grad = [&](const unsigned int i, const Point<1> &p) {
+    return fe_1d.shape_grad(is_dg ? i : lexicographic[i], p)[0];
+  };
+
+  const unsigned int n_all = is_dg ? 2 * n : 2 * degree + 1;
+  Table<2, double>   mass_all(n_all, n_all), laplace_all(n_all, n_all);
+  for (unsigned int c = 0; c < 2; ++c)
+    for (unsigned int i = 0; i < n; ++i)
+      for (unsigned int j = 0; j < n; ++j)
+        {
+          const unsigned int offset = is_dg ? c * n : c * degree;
+          for (unsigned int q = 0; q < quadrature.size(); ++q)
+            {
+              const Point<1> &p = quadrature.point(q);
+              mass_all(offset + i, offset + j) +=
+                value(i, p) * value(j, p) * quadrature.weight(q) * h[c];
+              laplace_all(offset + i, offset + j) +=
+                grad(i, p) * grad(j, p) * quadrature.weight(q) / h[c];
+            }
+        }
+
+  if (is_dg)
+    {
+      const double penalty = degree * (degree + 1);
+
+      // faces at the ends of the patch
+      for (unsigned int c = 0; c < 2; ++c)
+        {
+          const Point<1> p(c == 0 ? 0. : 1.);
+          const double   normal = c == 0 ? -1. : 1.;
+          for (unsigned int i = 0; i < n; ++i)
+            for (unsigned int j = 0; j < n; ++j)
+              laplace_all(c * n + i, c * n + j) +=
+                (penalty * value(i, p) * value(j, p) -
+                 0.5 * normal * grad(i, p) * value(j, p) -
+                 0.5 * normal * grad(j, p) * value(i, p)) /
+                h[c];
+        }
+
+      // face between the two intervals
+      const double        sigma = penalty / std::min(h[0], h[1]);
+      std::vector<double> jump(2 * n), average(2 * n);
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          jump[i]        = value(i, Point<1>(1.));
+          jump[n + i]    = -value(i, Point<1>(0.));
+          average[i]     = 0.5 * grad(i, Point<1>(1.)) / h[0];
+          average[n + i] = 0.5 * grad(i, Point<1>(0.)) / h[1];
+        }
+      for (unsigned int i = 0; i < 2 * n; ++i)
+        for (unsigned int j = 0; j < 2 * n; ++j)
+          laplace_all(i, j) += -average[i] * jump[j] - average[j] * jump[i] +
+                               sigma * jump[i] * jump[j];
+
+      mass    = mass_all;
+      laplace = laplace_all;
+    }
+  else
+    {
+      mass.reinit(n_all - 2, n_all - 2);
+      laplace.reinit(n_all - 2, n_all - 2);
+      for (unsigned int i = 0; i < n_all - 2; ++i)
+        for (unsigned int j = 0; j < n_all - 2; ++j)
+          {
+            mass(i, j)    = mass_all(i + 1, j + 1);
+            laplace(i, j) = laplace_all(i + 1, j + 1);
+          }
+    }
+}
+
+
+
+template <int dim>
+void
+test(const FiniteElement<dim> &fe, const FiniteElement<1> &fe_1d)
+{
+  const unsigned int n_refinements = 2;
+
+  Point<dim> p1, p2;
+  for (unsigned int d = 0; d < dim; ++d)
+    p2[d] = 2. / (d + 1);
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_rectangle(tria, p1, p2);
+  tria.refine_global(n_refinements);
+
+  // make the mesh graded in the first direction
+  GridTools::transform(
+    [&](const Point<dim> &p) {
+      Point<dim> q = p;
+      q[0]         = p2[0] * Utilities::fixed_power<2>(p[0] / p2[0]);
+      return q;
+    },
+    tria);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_zero_boundary_constraints(dof_handler, constraints);
+  constraints.close();
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(fe.degree + 1),
+                     typename MatrixFree<dim, double>::AdditionalData());
+
+  PreconditionVertexPatchSchwarz<dim, double> preconditioner;
+  preconditioner.initialize(matrix_free);
+
+  LinearAlgebra::distributed::Vector<double> src, dst, sum;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  matrix_free.initialize_dof_vector(sum);
+  for (double &entry : src)
+    entry = random_value<double>();
+
+  // find the patches, i.e., the cells around the interior vertices, and
+  // their unknowns sorted lexicographically by the position of the support
+  // points for FE_Q and by the position of the cell for FE_DGQ
+  const bool is_dg = fe.n_dofs_per_vertex() == 0;
+  std::map<types::global_dof_index, Point<dim>> support_points;
+  DoFTools::map_dofs_to_support_points(MappingQ1<dim>(),
+                                       dof_handler,
+                                       support_points);
+  std::map<unsigned int, std::vector<typename DoFHandler<dim>::cell_iterator>>
+    cells_at_vertex;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    for (const unsigned int v : cell->vertex_indices())
+      cells_at_vertex[cell->vertex_index(v)].push_back(cell);
+
+  std::vector<std::vector<types::global_dof_index>> patch_indices;
+  std::vector<TensorProductMatrixSymmetricSum<dim, double>> patch_matrices;
+  std::vector<types::global_dof_index> cell_indices(fe.n_dofs_per_cell());
+  for (const auto &[vertex_index, cells] : cells_at_vertex)
+    {
+      if (cells.size() < (1U << dim))
+        continue;
+      const Point<dim> &vertex = tria.get_vertices()[vertex_index];
+
+      std::array<std::array<double, 2>, dim> h;
+      for (const auto &cell : cells)
+        for (unsigned int d = 0; d < dim; ++d)
+          h[d][cell->center()[d] > vertex[d]] = cell->extent_in_direction(d);
+
+      std::vector<std::pair<std::vector<double>, types::global_dof_index>>
+        sorted_indices;
+      for (const auto &cell : cells)
+        {
+          cell->get_dof_indices(cell_indices);
+          for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+            {
+              std::vector<double> key(dim + 1);
+              if (is_dg)
+                {
+                  // cell position first, then the lexicographic index
+                  // within the cell
+                  for (unsigned int d = 0; d < dim; ++d)
+                    key[dim - 1 - d] =
+                      (cell->center()[d] > vertex[d]) * (fe.degree + 1) +
+                      (i / Utilities::pow(fe.degree + 1, d)) % (fe.degree + 1);
+                }
+              else
+                {
+                  const Point<dim> &p = support_points[cell_indices[i]];
+                  bool              is_inside = true;
+                  for (unsigned int d = 0; d < dim; ++d)
+                    {
+                      if (std::abs(p[d] - vertex[d]) >
+                          (p[d] > vertex[d] ? h[d][1] : h[d][0]) - 1e-12)
+                        is_inside = false;
+                      // round away roundoff in the coordinates
+                      key[dim - 1 - d] = std::round(p[d] * 1e8);
+                    }
+                  if (!is_inside)
+                    continue;
+                }
+              key[dim] = cell_indices[i];
+              sorted_indices.emplace_back(key, cell_indices[i]);
+            }
+        }
+      std::sort(sorted_indices.begin(), sorted_indices.end());
+      sorted_indices.erase(std::unique(sorted_indices.begin(),
+                                       sorted_indices.end()),
+                           sorted_indices.end());
+
+      std::vector<types::global_dof_index> indices;
+      for (const auto &entry : sorted_indices)
+        indices.push_back(entry.second);
+      patch_indices.push_back(indices);
+
+      std::array<Table<2, double>, dim> mass_matrices, laplace_matrices;
+      for (unsigned int d = 0; d < dim; ++d)
+        assemble_1d(fe_1d, h[d], mass_matrices[d], laplace_matrices[d]);
+      patch_matrices.emplace_back();
+      patch_matrices.back().reinit(mass_matrices, laplace_matrices);
+    }
+
+  std::vector<unsigned int> n_colors_of_patch(patch_indices.size(), 0);
+  for (unsigned int color = 0; color < preconditioner.n_colors(); ++color)
+    {
+      preconditioner.vmult_color(color, dst, src);
+      sum += dst;
+
+      for (unsigned int patch = 0; patch < patch_indices.size(); ++patch)
+        {
+          const std::vector<types::global_dof_index> &indices =
+            patch_indices[patch];
+          std::vector<double> dst_values(indices.size()),
+            product(indices.size());
+          for (unsigned int i = 0; i < indices.size(); ++i)
+            dst_values[i] = dst(indices[i]);
+          patch_matrices[patch].vmult(make_array_view(product),
+                                      make_array_view(
+                                        std::as_const(dst_values)));
+          double error = 0.;
+          for (unsigned int i = 0; i < indices.size(); ++i)
+            error = std::max(error, std::abs(product[i] - src(indices[i])));
+          if (error < 1e-8)
+            ++n_colors_of_patch[patch];
+        }
+    }
+
+  preconditioner.vmult(dst, src);
+  sum -= dst;
+
+  deallog << fe.get_name() << " patches: " << patch_indices.size() << " "
+          << preconditioner.n_patches()
+          << " patch dofs: " << patch_indices[0].size() << std::endl;
+  deallog << "each patch in one color: "
+          << (std::count(n_colors_of_patch.begin(),
+                         n_colors_of_patch.end(),
+                         1U) == static_cast<long>(patch_indices.size()))
+          << " vmult is sum over colors: " << (sum.linfty_norm() < 1e-12)
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(FE_Q<2>(1), FE_Q<1>(1));
+  test<2>(FE_Q<2>(3), FE_Q<1>(3));
+  test<2>(FE_DGQ<2>(2), FE_DGQ<1>(2));
+  test<3>(FE_Q<3>(2), FE_Q<1>(2));
+  test<3>(FE_DGQ<3>(1), FE_DGQ<1>(1));
+}
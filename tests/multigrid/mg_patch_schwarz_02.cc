@@ -0,0 +1,124 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Run MGSmootherSchwarz as a stationary iteration for the Laplacian with
+// FE_Q on a Cartesian mesh, where the vertex patch matrices are exact, and
+// print the number of iterations for the additive and the multiplicative
+// variant.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/multigrid/mg_patch_schwarz.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree>
+void
+test()
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1., 1.);
+  tria.refine_global(2);
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_zero_boundary_constraints(dof_handler, constraints);
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+  const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+  matrix_free->reinit(MappingQ1<dim>(),
+                      dof_handler,
+                      constraints,
+                      QGauss<1>(fe_degree + 1),
+                      additional_data);
+
+  // the smoother is not set up on the coarsest level, so use the same
+  // operator on two levels
+  using LevelMatrixType =
+    MatrixFreeOperators::LaplaceOperator<dim, fe_degree, fe_degree + 1>;
+  MGLevelObject<LevelMatrixType> matrices(0, 1);
+  for (unsigned int level = 0; level < 2; ++level)
+    matrices[level].initialize(matrix_free);
+
+  VectorType rhs, solution, residual;
+  matrix_free->initialize_dof_vector(rhs);
+  matrix_free->initialize_dof_vector(solution);
+  matrix_free->initialize_dof_vector(residual);
+  rhs = 1.;
+  for (const unsigned int i : matrix_free->get_constrained_dofs())
+    rhs.local_element(i) = 0.;
+
+  for (const bool multiplicative : {false, true})
+    {
+      MGSmootherSchwarz<dim, double> smoother(1);
+      smoother.initialize(
+        matrices,
+        typename MGSmootherSchwarz<dim, double>::AdditionalData(
+          multiplicative));
+
+      smoother.apply(1, solution, rhs);
+      unsigned int n_iterations = 1;
+      for (; n_iterations < 1000; ++n_iterations)
+        {
+          matrices[1].vmult(residual, solution);
+          residual.sadd(-1., rhs);
+          if (residual.l2_norm() < 1e-8 * rhs.l2_norm())
+            break;
+          smoother.smooth(1, solution, rhs);
+        }
+
+      deallog << "dim=" << dim << " degree=" << fe_degree
+              << (multiplicative ? " multiplicative" : " additive")
+              << " colors: " << smoother.smoothers[1].n_colors()
+              << " iterations: " << n_iterations << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 2>();
+  test<2, 4>();
+  test<3, 2>();
+}
@@ -0,0 +1,200 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Assemble a Laplace matrix and right hand side with hanging node and
+// inhomogeneous boundary constraints using WorkStream, once by writing into
+// the global objects in the copier and once by writing through
+// ConcurrentSparseMatrixAdder and ConcurrentVectorAdder in the worker.
+// Check that both give the same result.
+
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/work_stream.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/concurrent_assembly.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+namespace
+{
+  template <int dim>
+  struct Scratch
+  {
+    Scratch(const FiniteElement<dim> &fe, const Quadrature<dim> &quadrature)
+      : fe_values(fe, quadrature, update_gradients | update_JxW_values)
+    {}
+
+    Scratch(const Scratch &data)
+      : fe_values(data.fe_values.get_fe(),
+                  data.fe_values.get_quadrature(),
+                  data.fe_values.get_update_flags())
+    {}
+
+    FEValues<dim> fe_values;
+  };
+
+  struct CopyData
+  {
+    FullMatrix<double>                   cell_matrix;
+    Vector<double>                       cell_rhs;
+    std::vector<types::global_dof_index> local_dof_indices;
+  };
+} // namespace
+
+
+
+template <int dim>
+void
+assemble_on_cell(const typename DoFHandler<dim>::active_cell_iterator &cell,
+                 Scratch<dim>                                         &scratch,
+                 CopyData &copy_data)
+{
+  scratch.fe_values.reinit(cell);
+  const unsigned int dofs_per_cell = scratch.fe_values.dofs_per_cell;
+
+  copy_data.cell_matrix.reinit(dofs_per_cell, dofs_per_cell);
+  copy_data.cell_rhs.reinit(dofs_per_cell);
+  copy_data.local_dof_indices.resize(dofs_per_cell);
+  cell->get_dof_indices(copy_data.local_dof_indices);
+
+  for (const unsigned int q : scratch.fe_values.quadrature_point_indices())
+    for (unsigned int i = 0; i < dofs_per_cell; ++i)
+      {
+        for (unsigned int j = 0; j < dofs_per_cell; ++j)
+          copy_data.cell_matrix(i, j) += scratch.fe_values.shape_grad(i, q) *
+                                         scratch.fe_values.shape_grad(j, q) *
+                                         scratch.fe_values.JxW(q);
+        copy_data.cell_rhs(i) += scratch.fe_values.JxW(q);
+      }
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  VectorTools::interpolate_boundary_values(dof_handler,
+                                           0,
+                                           Functions::ConstantFunction<dim>(1.),
+                                           constraints);
+  constraints.close();
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  const QGauss<dim> quadrature(3);
+
+  // assemble in the copier
+  SparseMatrix<double> matrix_1(sparsity);
+  Vector<double>       rhs_1(dof_handler.n_dofs());
+  WorkStream::run(
+    dof_handler.begin_active(),
+    dof_handler.end(),
+    &assemble_on_cell<dim>,
+    [&](const CopyData &copy_data) {
+      constraints.distribute_local_to_global(copy_data.cell_matrix,
+                                             copy_data.cell_rhs,
+                                             copy_data.local_dof_indices,
+                                             matrix_1,
+                                             rhs_1);
+    },
+    Scratch<dim>(fe, quadrature),
+    CopyData());
+
+  // assemble concurrently in the worker
+  SparseMatrix<double>                  matrix_2(sparsity);
+  Vector<double>                        rhs_2(dof_handler.n_dofs());
+  ConcurrentSparseMatrixAdder<double>   matrix_adder(matrix_2);
+  ConcurrentVectorAdder<Vector<double>> rhs_adder(rhs_2);
+  WorkStream::run(
+    dof_handler.begin_active(),
+    dof_handler.end(),
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+        Scratch<dim>                                         &scratch,
+        CopyData                                             &copy_data) {
+      assemble_on_cell<dim>(cell, scratch, copy_data);
+      constraints.distribute_local_to_global(copy_data.cell_matrix,
+                                             copy_data.cell_rhs,
+                                             copy_data.local_dof_indices,
+                                             matrix_adder,
+                                             rhs_adder);
+    },
+    [](const CopyData &) {},
+    Scratch<dim>(fe, quadrature),
+    CopyData());
+
+  // the order of additions is not deterministic, so compare with a
+  // tolerance
+  double matrix_difference = 0;
+  for (const auto &entry : matrix_1)
+    matrix_difference = std::max(matrix_difference,
+                                 std::abs(entry.value() -
+                                          matrix_2.el(entry.row(),
+                                                      entry.column())));
+  rhs_2 -= rhs_1;
+
+  deallog << "Matrix agrees: "
+          << (matrix_difference < 1e-12 * matrix_1.linfty_norm()) << std::endl;
+  deallog << "Right hand side agrees: "
+          << (rhs_2.linfty_norm() < 1e-12 * rhs_1.linfty_norm()) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
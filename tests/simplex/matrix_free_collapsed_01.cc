@@ -0,0 +1,175 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that FEEvaluation uses the factorized evaluation in collapsed
+// coordinates for FE_SimplexP, FE_SimplexDGP and FE_PyramidP with quadrature
+// formulas that are tensor products in the collapsed coordinates, and that a
+// matrix-free operator with values and gradients then gives the same result
+// as the assembled matrix, also for vector-valued elements.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_pyramid_p.h>
+#include <deal.II/fe/fe_simplex_p.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_fe.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+#include "./simplex_grids.h"
+
+
+
+template <int dim, int n_components = 1>
+void
+test(const FiniteElement<dim> &fe, const Quadrature<dim> &quad)
+{
+  Triangulation<dim>                        tria;
+  std::shared_ptr<const FiniteElement<dim>> fe_mapping;
+  if (fe.reference_cell() == ReferenceCells::Pyramid)
+    {
+      GridGenerator::subdivided_hyper_cube_with_pyramids(tria, 2);
+      fe_mapping = std::make_shared<FE_PyramidP<dim>>(1);
+    }
+  else
+    {
+      GridGenerator::subdivided_hyper_cube_with_simplices(tria, 2);
+      fe_mapping = std::make_shared<FE_SimplexP<dim>>(1);
+    }
+  GridTools::distort_random(0.2, tria);
+
+  const MappingFE<dim> mapping(*fe_mapping);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_values | update_gradients;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping, dof_handler, constraints, quad, additional_data);
+
+  deallog << fe.get_name() << " with " << quad.size()
+          << " quadrature points, factorized: "
+          << matrix_free.get_shape_info().collapsed_data.is_initialized()
+          << std::endl;
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  matrix_free.template cell_loop<Vector<double>, Vector<double>>(
+    [](const auto &data, auto &dst, const auto &src, const auto &cells) {
+      FEEvaluation<dim, -1, 0, n_components, double> phi(data);
+      for (unsigned int cell = cells.first; cell < cells.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src,
+                              EvaluationFlags::values |
+                                EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              phi.submit_value(phi.get_value(q), q);
+              phi.submit_gradient(phi.get_gradient(q), q);
+            }
+          phi.integrate_scatter(EvaluationFlags::values |
+                                  EvaluationFlags::gradients,
+                                dst);
+        }
+    },
+    dst,
+    src,
+    true);
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+  SparsityPattern sparsity_pattern;
+  sparsity_pattern.copy_from(dsp);
+  SparseMatrix<double> matrix(sparsity_pattern);
+
+  FEValues<dim> fe_values(mapping,
+                          fe,
+                          quad,
+                          update_values | update_gradients |
+                            update_JxW_values);
+
+  FullMatrix<double>                   cell_matrix(fe.n_dofs_per_cell(),
+                                 fe.n_dofs_per_cell());
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      fe_values.reinit(cell);
+      cell_matrix = 0;
+      for (const unsigned int q : fe_values.quadrature_point_indices())
+        for (const unsigned int i : fe_values.dof_indices())
+          for (const unsigned int j : fe_values.dof_indices())
+            if (fe.system_to_component_index(i).first ==
+                fe.system_to_component_index(j).first)
+              cell_matrix(i, j) +=
+                (fe_values.shape_value(i, q) * fe_values.shape_value(j, q) +
+                 fe_values.shape_grad(i, q) * fe_values.shape_grad(j, q)) *
+                fe_values.JxW(q);
+      cell->get_dof_indices(dof_indices);
+      constraints.distribute_local_to_global(cell_matrix, dof_indices, matrix);
+    }
+
+  Vector<double> reference(dof_handler.n_dofs());
+  matrix.vmult(reference, src);
+  reference -= dst;
+  deallog << "Relative error: "
+          << (reference.linfty_norm() / dst.linfty_norm() < 1e-12 ? "ok" :
+                                                                    "failed")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(FE_SimplexP<2>(1), QCollapsedGaussSimplex<2>(2));
+  test<2>(FE_SimplexP<2>(3), QCollapsedGaussSimplex<2>(4));
+  test<3>(FE_SimplexP<3>(1), QCollapsedGaussSimplex<3>(2));
+  test<3>(FE_SimplexP<3>(2), QCollapsedGaussSimplex<3>(3));
+  test<3>(FE_SimplexP<3>(3), QCollapsedGaussSimplex<3>(4));
+  test<3>(FE_SimplexP<3>(3), QCollapsedGaussSimplex<3>(5));
+  test<3>(FE_SimplexDGP<3>(3), QCollapsedGaussSimplex<3>(4));
+  test<3, 3>(FESystem<3>(FE_SimplexP<3>(2), 3), QCollapsedGaussSimplex<3>(3));
+  test<3>(FE_PyramidP<3>(1), QGaussPyramid<3>(2));
+
+  // the points of QWitherdenVincentSimplex are not a tensor product in the
+  // collapsed coordinates
+  test<3>(FE_SimplexP<3>(2), QWitherdenVincentSimplex<3>(3));
+}